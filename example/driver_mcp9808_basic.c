@@ -55,8 +55,10 @@ uint8_t mcp9808_basic_init(mcp9808_address_t addr)
     DRIVER_MCP9808_LINK_IIC_INIT(&gs_handle, mcp9808_interface_iic_init);
     DRIVER_MCP9808_LINK_IIC_DEINIT(&gs_handle, mcp9808_interface_iic_deinit);
     DRIVER_MCP9808_LINK_IIC_READ(&gs_handle, mcp9808_interface_iic_read);
+    DRIVER_MCP9808_LINK_IIC_READ_CMD(&gs_handle, mcp9808_interface_iic_read_cmd);
     DRIVER_MCP9808_LINK_IIC_WRITE(&gs_handle, mcp9808_interface_iic_write);
     DRIVER_MCP9808_LINK_DELAY_MS(&gs_handle, mcp9808_interface_delay_ms);
+    DRIVER_MCP9808_LINK_GET_TIME_US(&gs_handle, mcp9808_interface_get_time_us);
     DRIVER_MCP9808_LINK_DEBUG_PRINT(&gs_handle, mcp9808_interface_debug_print);
     DRIVER_MCP9808_LINK_RECEIVE_CALLBACK(&gs_handle, mcp9808_interface_receive_callback);
 
@@ -152,12 +154,23 @@ uint8_t mcp9808_basic_init(mcp9808_address_t addr)
 uint8_t mcp9808_basic_read(float *temperature_deg)
 {
     int16_t raw;
+#if (MCP9808_USE_FLOAT != 1)
+    int32_t temperature_mc;
+#endif
    
     /* read data */
+#if (MCP9808_USE_FLOAT == 1)
     if (mcp9808_read(&gs_handle, &raw, temperature_deg) != 0)
     {
         return 1;
     }
+#else
+    if (mcp9808_read_milli_c(&gs_handle, &raw, &temperature_mc) != 0)
+    {
+        return 1;
+    }
+    *temperature_deg = (float)raw * 0.0625f;
+#endif
     
     return 0;
 }
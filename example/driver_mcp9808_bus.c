@@ -0,0 +1,350 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mcp9808_bus.c
+ * @brief     driver mcp9808 bus source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-01-25
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/01/25  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_mcp9808_bus.h"
+
+static mcp9808_handle_t gs_handle[MCP9808_BUS_MAX_DEVICE];        /**< mcp9808 handles */
+static mcp9808_address_t gs_addr[MCP9808_BUS_MAX_DEVICE];         /**< found addresses */
+static uint8_t gs_num;                                            /**< found device number */
+static uint8_t gs_next;                                           /**< next round-robin device */
+
+/**
+ * @brief  shared iic bus init
+ * @return status code
+ *         - 0 success
+ * @note   the bus is opened once by the bus example
+ */
+static uint8_t a_mcp9808_bus_iic_init(void)
+{
+    return 0;
+}
+
+/**
+ * @brief  shared iic bus deinit
+ * @return status code
+ *         - 0 success
+ * @note   the bus is closed once by the bus example
+ */
+static uint8_t a_mcp9808_bus_iic_deinit(void)
+{
+    return 0;
+}
+
+/**
+ * @brief     bus example init one device
+ * @param[in] *handle pointer to a mcp9808 handle structure
+ * @param[in] addr iic device address
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      none
+ */
+static uint8_t a_mcp9808_bus_device_init(mcp9808_handle_t *handle, mcp9808_address_t addr)
+{
+    uint8_t res;
+    
+    /* link interface function */
+    DRIVER_MCP9808_LINK_INIT(handle, mcp9808_handle_t); 
+    DRIVER_MCP9808_LINK_IIC_INIT(handle, a_mcp9808_bus_iic_init);
+    DRIVER_MCP9808_LINK_IIC_DEINIT(handle, a_mcp9808_bus_iic_deinit);
+    DRIVER_MCP9808_LINK_IIC_READ(handle, mcp9808_interface_iic_read);
+    DRIVER_MCP9808_LINK_IIC_READ_CMD(handle, mcp9808_interface_iic_read_cmd);
+    DRIVER_MCP9808_LINK_IIC_READ_BATCH(handle, mcp9808_interface_iic_read_batch);
+    DRIVER_MCP9808_LINK_IIC_WRITE(handle, mcp9808_interface_iic_write);
+    DRIVER_MCP9808_LINK_DELAY_MS(handle, mcp9808_interface_delay_ms);
+    DRIVER_MCP9808_LINK_GET_TIME_US(handle, mcp9808_interface_get_time_us);
+    DRIVER_MCP9808_LINK_DEBUG_PRINT(handle, mcp9808_interface_debug_print);
+    DRIVER_MCP9808_LINK_RECEIVE_CALLBACK(handle, mcp9808_interface_receive_callback);
+    
+    /* set addr */
+    res = mcp9808_set_addr(handle, addr);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* mcp9808 init */
+    res = mcp9808_init(handle);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* enable cache */
+    res = mcp9808_set_cache(handle, MCP9808_BOOL_TRUE);
+    if (res != 0)
+    {
+        (void)mcp9808_deinit(handle);
+        
+        return 1;
+    }
+    
+    /* disable shutdown */
+    res = mcp9808_set_shutdown(handle, MCP9808_BOOL_FALSE);
+    if (res != 0)
+    {
+        mcp9808_interface_debug_print("mcp9808: set shutdown failed.\n");
+        (void)mcp9808_deinit(handle);
+        
+        return 1;
+    }
+    
+    /* set default resolution */
+    res = mcp9808_set_resolution(handle, MCP9808_BUS_DEFAULT_RESOLUTION);
+    if (res != 0)
+    {
+        mcp9808_interface_debug_print("mcp9808: set resolution failed.\n");
+        (void)mcp9808_deinit(handle);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      bus example init
+ * @param[out] *num pointer to a found device number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 init failed
+ * @note       the iic bus is opened once and all eight addresses are probed
+ */
+uint8_t mcp9808_bus_init(uint8_t *num)
+{
+    uint8_t i;
+    
+    /* iic init */
+    if (mcp9808_interface_iic_init() != 0)
+    {
+        mcp9808_interface_debug_print("mcp9808: iic init failed.\n");
+        
+        return 1;
+    }
+    
+    /* probe all addresses */
+    gs_num = 0;
+    gs_next = 0;
+    for (i = 0; i < MCP9808_BUS_MAX_DEVICE; i++)
+    {
+        mcp9808_address_t addr;
+        
+        addr = (mcp9808_address_t)(MCP9808_ADDRESS_A2A1A0_000 + (i << 1));
+        if (a_mcp9808_bus_device_init(&gs_handle[gs_num], addr) == 0)
+        {
+            gs_addr[gs_num] = addr;
+            gs_num++;
+        }
+    }
+    if (gs_num == 0)
+    {
+        mcp9808_interface_debug_print("mcp9808: no device found.\n");
+        (void)mcp9808_interface_iic_deinit();
+        
+        return 1;
+    }
+    *num = gs_num;
+    
+    return 0;
+}
+
+/**
+ * @brief      bus example get the found device addresses
+ * @param[out] *addr pointer to an address buffer
+ * @param[in]  *len pointer to a buffer length
+ * @param[out] *len pointer to a found device number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       none
+ */
+uint8_t mcp9808_bus_get_device(mcp9808_address_t *addr, uint8_t *len)
+{
+    uint8_t i;
+    
+    /* check the buffer */
+    if (*len < gs_num)
+    {
+        mcp9808_interface_debug_print("mcp9808: buffer is too small.\n");
+        
+        return 1;
+    }
+    
+    /* copy the addresses */
+    for (i = 0; i < gs_num; i++)
+    {
+        addr[i] = gs_addr[i];
+    }
+    *len = gs_num;
+    
+    return 0;
+}
+
+/**
+ * @brief      bus example read the next device in the round-robin order
+ * @param[out] *sample pointer to a sample buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       call it at a fixed rate to keep the bus occupancy constant
+ */
+uint8_t mcp9808_bus_poll(mcp9808_bus_sample_t *sample)
+{
+    uint8_t index;
+    int32_t temperature_mc;
+    
+    /* check the device number */
+    if (gs_num == 0)
+    {
+        return 1;
+    }
+    
+    /* get the next device */
+    index = gs_next;
+    gs_next = (uint8_t)((gs_next + 1) % gs_num);
+    
+    /* read data */
+    sample->addr = (uint8_t)gs_addr[index];
+    if (mcp9808_read_milli_c(&gs_handle[index], &sample->raw, &temperature_mc) != 0)
+    {
+        sample->status = 1;
+        sample->raw = 0;
+        
+        return 1;
+    }
+    sample->status = 0;
+    
+    return 0;
+}
+
+/**
+ * @brief      bus example read all found devices once
+ * @param[out] *sample pointer to a sample array
+ * @param[in]  *len pointer to an array length
+ * @param[out] *len pointer to a sample number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 sweep failed
+ * @note       one sample is filled per found device in the address order,
+ *             all devices share one batch read with single reads as the fallback,
+ *             a failed device is marked by the sample status
+ */
+uint8_t mcp9808_bus_sweep(mcp9808_bus_sample_t *sample, uint8_t *len)
+{
+    uint8_t i;
+    int32_t temperature_mc;
+    int16_t raw[MCP9808_BUS_MAX_DEVICE];
+    mcp9808_handle_t *batch[MCP9808_BUS_MAX_DEVICE];
+    
+    /* check the buffer */
+    if ((gs_num == 0) || (*len < gs_num))
+    {
+        mcp9808_interface_debug_print("mcp9808: buffer is too small.\n");
+        
+        return 1;
+    }
+    
+    /* read all devices in one transfer */
+    for (i = 0; i < gs_num; i++)
+    {
+        batch[i] = &gs_handle[i];
+    }
+    if (mcp9808_read_batch(batch, gs_num, raw) == 0)
+    {
+        for (i = 0; i < gs_num; i++)
+        {
+            sample[i].addr = (uint8_t)gs_addr[i];
+            sample[i].raw = raw[i];
+            sample[i].status = 0;
+        }
+        *len = gs_num;
+        gs_next = 0;
+        
+        return 0;
+    }
+    
+    /* read device by device to find the failed one */
+    for (i = 0; i < gs_num; i++)
+    {
+        sample[i].addr = (uint8_t)gs_addr[i];
+        if (mcp9808_read_milli_c(&gs_handle[i], &sample[i].raw, &temperature_mc) != 0)
+        {
+            sample[i].status = 1;
+            sample[i].raw = 0;
+        }
+        else
+        {
+            sample[i].status = 0;
+        }
+    }
+    *len = gs_num;
+    gs_next = 0;
+    
+    return 0;
+}
+
+/**
+ * @brief  bus example deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t mcp9808_bus_deinit(void)
+{
+    uint8_t i;
+    uint8_t res;
+    
+    /* close all devices */
+    res = 0;
+    for (i = 0; i < gs_num; i++)
+    {
+        if (mcp9808_deinit(&gs_handle[i]) != 0)
+        {
+            res = 1;
+        }
+    }
+    gs_num = 0;
+    gs_next = 0;
+    
+    /* iic deinit */
+    if (mcp9808_interface_iic_deinit() != 0)
+    {
+        res = 1;
+    }
+    
+    return res;
+}
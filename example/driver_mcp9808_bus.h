@@ -0,0 +1,132 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mcp9808_bus.h
+ * @brief     driver mcp9808 bus header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-01-25
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/01/25  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_MCP9808_BUS_H
+#define DRIVER_MCP9808_BUS_H
+
+#include "driver_mcp9808_interface.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup mcp9808_example_driver mcp9808 example driver function
+ * @brief    mcp9808 example driver modules
+ * @ingroup  mcp9808_driver
+ * @{
+ */
+
+/**
+ * @brief mcp9808 bus example default definition
+ */
+#define MCP9808_BUS_MAX_DEVICE                  8                                /**< max device number on one bus */
+#define MCP9808_BUS_DEFAULT_RESOLUTION          MCP9808_RESOLUTION_0P0625        /**< 0.0625C */
+
+/**
+ * @brief mcp9808 bus sample structure definition
+ */
+typedef struct mcp9808_bus_sample_s
+{
+    uint8_t addr;          /**< iic device address */
+    uint8_t status;        /**< 0 valid, 1 read failed */
+    int16_t raw;           /**< raw temperature, 0.0625C per lsb */
+} mcp9808_bus_sample_t;
+
+/**
+ * @brief      bus example init
+ * @param[out] *num pointer to a found device number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 init failed
+ * @note       the iic bus is opened once and all eight addresses are probed
+ */
+uint8_t mcp9808_bus_init(uint8_t *num);
+
+/**
+ * @brief  bus example deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t mcp9808_bus_deinit(void);
+
+/**
+ * @brief      bus example get the found device addresses
+ * @param[out] *addr pointer to an address buffer
+ * @param[in]  *len pointer to a buffer length
+ * @param[out] *len pointer to a found device number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       none
+ */
+uint8_t mcp9808_bus_get_device(mcp9808_address_t *addr, uint8_t *len);
+
+/**
+ * @brief      bus example read the next device in the round-robin order
+ * @param[out] *sample pointer to a sample buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       call it at a fixed rate to keep the bus occupancy constant
+ */
+uint8_t mcp9808_bus_poll(mcp9808_bus_sample_t *sample);
+
+/**
+ * @brief      bus example read all found devices once
+ * @param[out] *sample pointer to a sample array
+ * @param[in]  *len pointer to an array length
+ * @param[out] *len pointer to a sample number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 sweep failed
+ * @note       one sample is filled per found device in the address order,
+ *             all devices share one batch read with single reads as the fallback,
+ *             a failed device is marked by the sample status
+ */
+uint8_t mcp9808_bus_sweep(mcp9808_bus_sample_t *sample, uint8_t *len);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
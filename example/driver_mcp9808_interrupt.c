@@ -36,7 +36,32 @@
 
 #include "driver_mcp9808_interrupt.h"
 
-static mcp9808_handle_t gs_handle;        /**< mcp9808 handle */
+static mcp9808_handle_t gs_handle;                                       /**< mcp9808 handle */
+static mcp9808_queue_t gs_queue;                                         /**< mcp9808 event queue */
+static mcp9808_event_t gs_event[MCP9808_INTERRUPT_QUEUE_SIZE];           /**< mcp9808 event buffer */
+static void (*gs_callback)(uint8_t flags, int16_t raw);                  /**< user callback */
+
+/**
+ * @brief     interrupt receive callback
+ * @param[in] flags interrupt flags
+ * @param[in] raw raw temperature
+ * @note      runs in the irq context, it only queues the event and wakes the waiter
+ */
+static void a_mcp9808_interrupt_receive_callback(uint8_t flags, int16_t raw)
+{
+    mcp9808_event_t event;
+    
+    event.time_us = mcp9808_interface_get_time_us();
+    event.raw = raw;
+    event.flags = flags;
+    event.addr = gs_handle.iic_addr;
+    (void)mcp9808_queue_push(&gs_queue, &event);
+    mcp9808_interface_event_notify();
+    if (gs_callback != NULL)
+    {
+        gs_callback(flags, raw);
+    }
+}
 
 /**
  * @brief  interrupt irq handler
@@ -65,10 +90,11 @@ uint8_t mcp9808_interrupt_irq_handler(void)
  * @return    status code
  *            - 0 success
  *            - 1 init failed
- * @note      none
+ * @note      every alert is queued for mcp9808_interrupt_get_events,
+ *            the optional callback gets the mcp9808_status_flag_t flags and the raw temperature in the irq context
  */
 uint8_t mcp9808_interrupt_init(mcp9808_address_t addr, float low, float high,
-                               float critical_temperature, void (*callback)(uint8_t type))
+                               float critical_temperature, void (*callback)(uint8_t flags, int16_t raw))
 {
     uint8_t res;
     uint16_t reg;
@@ -78,10 +104,22 @@ uint8_t mcp9808_interrupt_init(mcp9808_address_t addr, float low, float high,
     DRIVER_MCP9808_LINK_IIC_INIT(&gs_handle, mcp9808_interface_iic_init);
     DRIVER_MCP9808_LINK_IIC_DEINIT(&gs_handle, mcp9808_interface_iic_deinit);
     DRIVER_MCP9808_LINK_IIC_READ(&gs_handle, mcp9808_interface_iic_read);
+    DRIVER_MCP9808_LINK_IIC_READ_CMD(&gs_handle, mcp9808_interface_iic_read_cmd);
     DRIVER_MCP9808_LINK_IIC_WRITE(&gs_handle, mcp9808_interface_iic_write);
     DRIVER_MCP9808_LINK_DELAY_MS(&gs_handle, mcp9808_interface_delay_ms);
+    DRIVER_MCP9808_LINK_GET_TIME_US(&gs_handle, mcp9808_interface_get_time_us);
     DRIVER_MCP9808_LINK_DEBUG_PRINT(&gs_handle, mcp9808_interface_debug_print);
-    DRIVER_MCP9808_LINK_RECEIVE_CALLBACK(&gs_handle, callback);
+    DRIVER_MCP9808_LINK_RECEIVE_CALLBACK_EXT(&gs_handle, a_mcp9808_interrupt_receive_callback);
+    gs_callback = callback;
+    
+    /* init the event queue */
+    res = mcp9808_queue_init(&gs_queue, gs_event, MCP9808_INTERRUPT_QUEUE_SIZE);
+    if (res != 0)
+    {
+        mcp9808_interface_debug_print("mcp9808: queue init failed.\n");
+        
+        return 1;
+    }
 
     /* set addr */
     res = mcp9808_set_addr(&gs_handle, addr);
@@ -101,6 +139,16 @@ uint8_t mcp9808_interrupt_init(mcp9808_address_t addr, float low, float high,
         return 1;
     }
     
+    /* enable cache */
+    res = mcp9808_set_cache(&gs_handle, MCP9808_BOOL_TRUE);
+    if (res != 0)
+    {
+        mcp9808_interface_debug_print("mcp9808: set cache failed.\n");
+        (void)mcp9808_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
     /* disable shutdown */
     res = mcp9808_set_shutdown(&gs_handle, MCP9808_BOOL_FALSE);
     if (res != 0)
@@ -182,7 +230,11 @@ uint8_t mcp9808_interrupt_init(mcp9808_address_t addr, float low, float high,
     }
     
     /* temperature convert to register */
+#if (MCP9808_USE_FLOAT == 1)
     res = mcp9808_temperature_convert_to_register(&gs_handle, high, &reg);
+#else
+    res = mcp9808_temperature_convert_to_register_milli_c(&gs_handle, (int32_t)(high * 1000.0f), &reg);
+#endif
     if (res != 0)
     {
         mcp9808_interface_debug_print("mcp9808: temperature convert to register failed.\n");
@@ -202,7 +254,11 @@ uint8_t mcp9808_interrupt_init(mcp9808_address_t addr, float low, float high,
     }
     
     /* temperature convert to register */
+#if (MCP9808_USE_FLOAT == 1)
     res = mcp9808_temperature_convert_to_register(&gs_handle, low, &reg);
+#else
+    res = mcp9808_temperature_convert_to_register_milli_c(&gs_handle, (int32_t)(low * 1000.0f), &reg);
+#endif
     if (res != 0)
     {
         mcp9808_interface_debug_print("mcp9808: temperature convert to register failed.\n");
@@ -222,7 +278,11 @@ uint8_t mcp9808_interrupt_init(mcp9808_address_t addr, float low, float high,
     }
     
     /* temperature convert to register */
+#if (MCP9808_USE_FLOAT == 1)
     res = mcp9808_temperature_convert_to_register(&gs_handle, critical_temperature, &reg);
+#else
+    res = mcp9808_temperature_convert_to_register_milli_c(&gs_handle, (int32_t)(critical_temperature * 1000.0f), &reg);
+#endif
     if (res != 0)
     {
         mcp9808_interface_debug_print("mcp9808: temperature convert to register failed.\n");
@@ -275,12 +335,89 @@ uint8_t mcp9808_interrupt_init(mcp9808_address_t addr, float low, float high,
 uint8_t mcp9808_interrupt_read(float *temperature_deg)
 {
     int16_t raw;
+#if (MCP9808_USE_FLOAT != 1)
+    int32_t temperature_mc;
+#endif
    
     /* read data */
+#if (MCP9808_USE_FLOAT == 1)
     if (mcp9808_read(&gs_handle, &raw, temperature_deg) != 0)
     {
         return 1;
     }
+#else
+    if (mcp9808_read_milli_c(&gs_handle, &raw, &temperature_mc) != 0)
+    {
+        return 1;
+    }
+    *temperature_deg = (float)raw * 0.0625f;
+#endif
+    
+    return 0;
+}
+
+/**
+ * @brief     interrupt example wait for alert events
+ * @param[in] timeout_ms timeout in ms, MCP9808_INTERFACE_WAIT_FOREVER waits without a timeout
+ * @return    status code
+ *            - 0 success
+ *            - 1 timeout
+ * @note      the caller sleeps until the irq queues an event
+ */
+uint8_t mcp9808_interrupt_wait(uint32_t timeout_ms)
+{
+    uint32_t count;
+    
+    /* check the queued events */
+    if ((mcp9808_queue_get_count(&gs_queue, &count) == 0) && (count != 0))
+    {
+        return 0;
+    }
+    
+    /* sleep until notified */
+    if (mcp9808_interface_event_wait(timeout_ms) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief         interrupt example get the queued alert events
+ * @param[out]    *event pointer to an event buffer
+ * @param[in,out] *len pointer to a length buffer
+ * @return        status code
+ *                - 0 success
+ *                - 1 get failed
+ * @note          len is the buffer length on input and the event number on output
+ */
+uint8_t mcp9808_interrupt_get_events(mcp9808_event_t *event, uint32_t *len)
+{
+    /* drain the queue */
+    if (mcp9808_queue_pop(&gs_queue, event, len) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      interrupt example get the dropped alert event number
+ * @param[out] *dropped pointer to a dropped number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       none
+ */
+uint8_t mcp9808_interrupt_get_dropped(uint32_t *dropped)
+{
+    /* get the dropped number */
+    if (mcp9808_queue_get_dropped(&gs_queue, dropped) != 0)
+    {
+        return 1;
+    }
     
     return 0;
 }
@@ -38,6 +38,7 @@
 #define DRIVER_MCP9808_INTERRUPT_H
 
 #include "driver_mcp9808_interface.h"
+#include "driver_mcp9808_queue.h"
 
 #ifdef __cplusplus
 extern "C"{
@@ -58,6 +59,7 @@ extern "C"{
 #define MCP9808_INTERRUPT_DEFAULT_ALERT_OUTPUT_SELECT          MCP9808_ALERT_OUTPUT_SELECT_ALL            /**< select all */
 #define MCP9808_INTERRUPT_DEFAULT_ALERT_OUTPUT_POLARITY        MCP9808_ALERT_OUTPUT_POLARITY_LOW          /**< active low */
 #define MCP9808_INTERRUPT_DEFAULT_ALERT_OUTPUT_MODE            MCP9808_ALERT_OUTPUT_MODE_INTERRUPT        /**< interrupt mode */
+#define MCP9808_INTERRUPT_QUEUE_SIZE                           32                                         /**< 32 events, a power of two */
 
 /**
  * @brief  interrupt irq handler
@@ -78,10 +80,11 @@ uint8_t mcp9808_interrupt_irq_handler(void);
  * @return    status code
  *            - 0 success
  *            - 1 init failed
- * @note      none
+ * @note      every alert is queued for mcp9808_interrupt_get_events,
+ *            the optional callback gets the mcp9808_status_flag_t flags and the raw temperature in the irq context
  */
 uint8_t mcp9808_interrupt_init(mcp9808_address_t addr, float low, float high,
-                               float critical_temperature, void (*callback)(uint8_t type));
+                               float critical_temperature, void (*callback)(uint8_t flags, int16_t raw));
 
 /**
  * @brief  interrupt example deinit
@@ -102,6 +105,37 @@ uint8_t mcp9808_interrupt_deinit(void);
  */
 uint8_t mcp9808_interrupt_read(float *temperature_deg);
 
+/**
+ * @brief     interrupt example wait for alert events
+ * @param[in] timeout_ms timeout in ms, MCP9808_INTERFACE_WAIT_FOREVER waits without a timeout
+ * @return    status code
+ *            - 0 success
+ *            - 1 timeout
+ * @note      the caller sleeps until the irq queues an event
+ */
+uint8_t mcp9808_interrupt_wait(uint32_t timeout_ms);
+
+/**
+ * @brief         interrupt example get the queued alert events
+ * @param[out]    *event pointer to an event buffer
+ * @param[in,out] *len pointer to a length buffer
+ * @return        status code
+ *                - 0 success
+ *                - 1 get failed
+ * @note          len is the buffer length on input and the event number on output
+ */
+uint8_t mcp9808_interrupt_get_events(mcp9808_event_t *event, uint32_t *len);
+
+/**
+ * @brief      interrupt example get the dropped alert event number
+ * @param[out] *dropped pointer to a dropped number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       none
+ */
+uint8_t mcp9808_interrupt_get_dropped(uint32_t *dropped);
+
 /**
  * @}
  */
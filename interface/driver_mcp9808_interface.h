@@ -50,6 +50,11 @@ extern "C"{
  * @{
  */
 
+/**
+ * @brief mcp9808 interface wait forever definition
+ */
+#define MCP9808_INTERFACE_WAIT_FOREVER        0xFFFFFFFFU        /**< no timeout */
+
 /**
  * @brief  interface iic bus init
  * @return status code
@@ -94,6 +99,142 @@ uint8_t mcp9808_interface_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uin
  */
 uint8_t mcp9808_interface_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);
 
+/**
+ * @brief      interface iic bus read without the register address
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t mcp9808_interface_iic_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief      interface iic bus read from many devices
+ * @param[in]  *addr pointer to an iic device write address array
+ * @param[in]  *reg pointer to an iic register address array
+ * @param[out] *buf pointer to a data buffer, len bytes per device
+ * @param[in]  len data length of one device
+ * @param[in]  num device number
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t mcp9808_interface_iic_read_batch(uint8_t *addr, uint8_t *reg, uint8_t *buf, uint16_t len, uint16_t num);
+
+/**
+ * @brief     interface iic bus context open
+ * @param[in] bus iic bus number
+ * @return    pointer to a bus context, NULL on failure
+ * @note      every bus context owns its own bus handle
+ */
+void *mcp9808_interface_bus_open(uint8_t bus);
+
+/**
+ * @brief     interface iic bus context close
+ * @param[in] *bus pointer to a bus context
+ * @return    status code
+ *            - 0 success
+ *            - 1 close failed
+ * @note      none
+ */
+uint8_t mcp9808_interface_bus_close(void *bus);
+
+/**
+ * @brief     interface iic bus context write
+ * @param[in] *bus pointer to a bus context
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+uint8_t mcp9808_interface_bus_iic_write(void *bus, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief      interface iic bus context read
+ * @param[in]  *bus pointer to a bus context
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t mcp9808_interface_bus_iic_read(void *bus, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief      interface iic bus context read without the register address
+ * @param[in]  *bus pointer to a bus context
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t mcp9808_interface_bus_iic_read_cmd(void *bus, uint8_t addr, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief      interface iic bus context read from many devices
+ * @param[in]  *bus pointer to a bus context
+ * @param[in]  *addr pointer to an iic device write address array
+ * @param[in]  *reg pointer to an iic register address array
+ * @param[out] *buf pointer to a data buffer, len bytes per device
+ * @param[in]  len data length of one device
+ * @param[in]  num device number
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t mcp9808_interface_bus_iic_read_batch(void *bus, uint8_t *addr, uint8_t *reg, uint8_t *buf, uint16_t len, uint16_t num);
+
+/**
+ * @brief      interface iic bus read start
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 start failed
+ * @note       buf must stay valid until iic_status is not busy
+ */
+uint8_t mcp9808_interface_iic_read_start(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief     interface iic bus write start
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ * @note      buf must stay valid until iic_status is not busy
+ */
+uint8_t mcp9808_interface_iic_write_start(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief  interface iic bus transfer status
+ * @return status code
+ *         - 0 done
+ *         - 1 error
+ *         - 2 busy
+ * @note   none
+ */
+uint8_t mcp9808_interface_iic_status(void);
+
 /**
  * @brief     interface delay ms
  * @param[in] ms time
@@ -101,6 +242,29 @@ uint8_t mcp9808_interface_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint
  */
 void mcp9808_interface_delay_ms(uint32_t ms);
 
+/**
+ * @brief  interface get the monotonic time
+ * @return time in microseconds
+ * @note   none
+ */
+uint32_t mcp9808_interface_get_time_us(void);
+
+/**
+ * @brief interface event notify
+ * @note  it is called in the irq context and must not block
+ */
+void mcp9808_interface_event_notify(void);
+
+/**
+ * @brief     interface event wait
+ * @param[in] timeout_ms timeout in ms, MCP9808_INTERFACE_WAIT_FOREVER waits without a timeout
+ * @return    status code
+ *            - 0 success
+ *            - 1 timeout
+ * @note      a notify before the wait is not lost
+ */
+uint8_t mcp9808_interface_event_wait(uint32_t timeout_ms);
+
 /**
  * @brief     interface print format data
  * @param[in] fmt format data
@@ -0,0 +1,431 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mcp9808_interface_simulator.c
+ * @brief     driver mcp9808 interface simulator source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-01-25
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/01/25  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_mcp9808_interface.h"
+#include "driver_mcp9808_simulator.h"
+#include <stdarg.h>
+
+/**
+ * @brief iic transfer status definition
+ */
+static uint8_t gs_status;                /**< status of the last started transfer */
+
+/**
+ * @brief event flag definition
+ */
+static volatile uint8_t gs_event;        /**< pending notify flag */
+
+/**
+ * @brief default waveform definition, 20C to 35C and back every 20s so the default thresholds are crossed
+ */
+static const mcp9808_simulator_point_t gs_waveform[3] =
+{
+    {0, 20000}, {10000, 35000}, {20000, 20000},
+};
+
+/**
+ * @brief     interface populate an empty simulated bus
+ * @param[in] bus bus index
+ * @note      all eight addresses are attached with the default waveform when no device answers yet,
+ *            devices attached by the caller are kept as they are
+ */
+static void a_interface_simulator_populate(uint8_t bus)
+{
+    uint8_t i;
+    uint8_t addr;
+    uint8_t level;
+    
+    for (i = 0; i < 8; i++)
+    {
+        if (mcp9808_simulator_get_alert(bus, (uint8_t)(MCP9808_ADDRESS_A2A1A0_000 + (i << 1)), &level) == 0)
+        {
+            return;
+        }
+    }
+    for (i = 0; i < 8; i++)
+    {
+        addr = (uint8_t)(MCP9808_ADDRESS_A2A1A0_000 + (i << 1));
+        (void)mcp9808_simulator_attach(bus, addr);
+        (void)mcp9808_simulator_set_waveform(bus, addr, gs_waveform, 3, MCP9808_BOOL_TRUE);
+    }
+}
+
+/**
+ * @brief  interface iic bus init
+ * @return status code
+ *         - 0 success
+ *         - 1 iic init failed
+ * @note   bus 0 is populated with all eight addresses when it is empty
+ */
+uint8_t mcp9808_interface_iic_init(void)
+{
+    a_interface_simulator_populate(0);
+    
+    return mcp9808_simulator_iic_init();
+}
+
+/**
+ * @brief  interface iic bus deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 iic deinit failed
+ * @note   none
+ */
+uint8_t mcp9808_interface_iic_deinit(void)
+{
+    return mcp9808_simulator_iic_deinit();
+}
+
+/**
+ * @brief     interface iic bus write
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+uint8_t mcp9808_interface_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    return mcp9808_simulator_iic_write(addr, reg, buf, len);
+}
+
+/**
+ * @brief      interface iic bus read
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t mcp9808_interface_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    return mcp9808_simulator_iic_read(addr, reg, buf, len);
+}
+
+/**
+ * @brief      interface iic bus read without the register address
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t mcp9808_interface_iic_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    return mcp9808_simulator_iic_read_cmd(addr, buf, len);
+}
+
+/**
+ * @brief      interface iic bus read from many devices
+ * @param[in]  *addr pointer to an iic device write address array
+ * @param[in]  *reg pointer to an iic register address array
+ * @param[out] *buf pointer to a data buffer, len bytes per device
+ * @param[in]  len data length of one device
+ * @param[in]  num device number
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t mcp9808_interface_iic_read_batch(uint8_t *addr, uint8_t *reg, uint8_t *buf, uint16_t len, uint16_t num)
+{
+    return mcp9808_simulator_iic_read_batch(addr, reg, buf, len, num);
+}
+
+/**
+ * @brief     interface iic bus context open
+ * @param[in] bus iic bus number
+ * @return    pointer to a bus context, NULL on failure
+ * @note      every bus context owns its own bus handle, an empty bus is populated with all eight addresses
+ */
+void *mcp9808_interface_bus_open(uint8_t bus)
+{
+    if (bus < MCP9808_SIMULATOR_MAX_BUS)
+    {
+        a_interface_simulator_populate(bus);
+    }
+    
+    return mcp9808_simulator_get_bus(bus);
+}
+
+/**
+ * @brief     interface iic bus context close
+ * @param[in] *bus pointer to a bus context
+ * @return    status code
+ *            - 0 success
+ *            - 1 close failed
+ * @note      none
+ */
+uint8_t mcp9808_interface_bus_close(void *bus)
+{
+    return (bus != NULL) ? 0 : 1;
+}
+
+/**
+ * @brief     interface iic bus context write
+ * @param[in] *bus pointer to a bus context
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+uint8_t mcp9808_interface_bus_iic_write(void *bus, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    return mcp9808_simulator_bus_iic_write(bus, addr, reg, buf, len);
+}
+
+/**
+ * @brief      interface iic bus context read
+ * @param[in]  *bus pointer to a bus context
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t mcp9808_interface_bus_iic_read(void *bus, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    return mcp9808_simulator_bus_iic_read(bus, addr, reg, buf, len);
+}
+
+/**
+ * @brief      interface iic bus context read without the register address
+ * @param[in]  *bus pointer to a bus context
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t mcp9808_interface_bus_iic_read_cmd(void *bus, uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    return mcp9808_simulator_bus_iic_read_cmd(bus, addr, buf, len);
+}
+
+/**
+ * @brief      interface iic bus context read from many devices
+ * @param[in]  *bus pointer to a bus context
+ * @param[in]  *addr pointer to an iic device write address array
+ * @param[in]  *reg pointer to an iic register address array
+ * @param[out] *buf pointer to a data buffer, len bytes per device
+ * @param[in]  len data length of one device
+ * @param[in]  num device number
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t mcp9808_interface_bus_iic_read_batch(void *bus, uint8_t *addr, uint8_t *reg, uint8_t *buf, uint16_t len, uint16_t num)
+{
+    return mcp9808_simulator_bus_iic_read_batch(bus, addr, reg, buf, len, num);
+}
+
+/**
+ * @brief      interface iic bus read start
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 start failed
+ * @note       buf must stay valid until iic_status is not busy
+ */
+uint8_t mcp9808_interface_iic_read_start(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    gs_status = mcp9808_simulator_iic_read(addr, reg, buf, len);
+    
+    return 0;
+}
+
+/**
+ * @brief     interface iic bus write start
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ * @note      buf must stay valid until iic_status is not busy
+ */
+uint8_t mcp9808_interface_iic_write_start(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    gs_status = mcp9808_simulator_iic_write(addr, reg, buf, len);
+    
+    return 0;
+}
+
+/**
+ * @brief  interface iic bus transfer status
+ * @return status code
+ *         - 0 done
+ *         - 1 error
+ *         - 2 busy
+ * @note   none
+ */
+uint8_t mcp9808_interface_iic_status(void)
+{
+    return gs_status;
+}
+
+/**
+ * @brief     interface delay ms
+ * @param[in] ms time
+ * @note      the virtual clock is advanced without sleeping
+ */
+void mcp9808_interface_delay_ms(uint32_t ms)
+{
+    mcp9808_simulator_delay_ms(ms);
+}
+
+/**
+ * @brief  interface get the monotonic time
+ * @return time in microseconds
+ * @note   every query costs MCP9808_SIMULATOR_POLL_US of virtual time so busy polling loops make progress
+ */
+uint32_t mcp9808_interface_get_time_us(void)
+{
+    mcp9808_simulator_advance_us(MCP9808_SIMULATOR_POLL_US);
+    
+    return mcp9808_simulator_time_us();
+}
+
+/**
+ * @brief interface event notify
+ * @note  it is called in the irq context and must not block
+ */
+void mcp9808_interface_event_notify(void)
+{
+    gs_event = 1;
+}
+
+/**
+ * @brief     interface event wait
+ * @param[in] timeout_ms timeout in ms, MCP9808_INTERFACE_WAIT_FOREVER waits without a timeout
+ * @return    status code
+ *            - 0 success
+ *            - 1 timeout
+ * @note      a notify before the wait is not lost, the virtual clock runs in 1ms steps while waiting
+ */
+uint8_t mcp9808_interface_event_wait(uint32_t timeout_ms)
+{
+    uint32_t i;
+    
+    /* let the virtual time run until the alert callback notifies */
+    for (i = 0; gs_event == 0; i++)
+    {
+        if ((timeout_ms != MCP9808_INTERFACE_WAIT_FOREVER) && (i >= timeout_ms))
+        {
+            return 1;
+        }
+        mcp9808_simulator_delay_ms(1);
+    }
+    gs_event = 0;
+    
+    return 0;
+}
+
+/**
+ * @brief     interface print format data
+ * @param[in] fmt format data
+ * @note      none
+ */
+void mcp9808_interface_debug_print(const char *const fmt, ...)
+{
+    char str[256];
+    va_list args;
+    
+    memset((char *)str, 0, sizeof(char) * 256); 
+    va_start(args, fmt);
+    vsnprintf((char *)str, 255, (char const *)fmt, args);
+    va_end(args);
+    
+    (void)printf("%s", str);
+}
+
+/**
+ * @brief     interface receive callback
+ * @param[in] type interrupt type
+ * @note      none
+ */
+void mcp9808_interface_receive_callback(uint8_t type)
+{
+    switch (type)
+    {
+        case MCP9808_STATUS_CRIT:
+        {
+            mcp9808_interface_debug_print("mcp9808: irq critical temperature.\n");
+            
+            break;
+        }
+        case MCP9808_STATUS_T_UPPER:
+        {
+            mcp9808_interface_debug_print("mcp9808: irq temperature upper boundary.\n");
+            
+            break;
+        }
+        case MCP9808_STATUS_T_LOWER:
+        {
+            mcp9808_interface_debug_print("mcp9808: irq temperature lower boundary.\n");
+            
+            break;
+        }
+        default:
+        {
+            mcp9808_interface_debug_print("mcp9808: unknown code.\n");
+            
+            break;
+        }
+    }
+}
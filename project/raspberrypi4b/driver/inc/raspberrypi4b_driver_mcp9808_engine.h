@@ -0,0 +1,127 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      raspberrypi4b_driver_mcp9808_engine.h
+ * @brief     driver mcp9808 engine header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-01-25
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/01/25  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef RASPBERRYPI4B_DRIVER_MCP9808_ENGINE_H
+#define RASPBERRYPI4B_DRIVER_MCP9808_ENGINE_H
+
+#include "driver_mcp9808_interface.h"
+#include "driver_mcp9808_queue.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup mcp9808_engine mcp9808 engine function
+ * @brief    mcp9808 linux sampling engine modules
+ * @{
+ */
+
+/**
+ * @brief mcp9808 engine default definition
+ */
+#define MCP9808_ENGINE_MAX_BUS              4                                /**< max bus number */
+#define MCP9808_ENGINE_MAX_DEVICE           8                                /**< max device number on one bus */
+#define MCP9808_ENGINE_QUEUE_SIZE           256                              /**< event queue size of one bus, power of two */
+#define MCP9808_ENGINE_DEFAULT_RESOLUTION   MCP9808_RESOLUTION_0P0625        /**< 0.0625C */
+
+/**
+ * @brief mcp9808 engine status structure definition
+ */
+typedef struct mcp9808_engine_status_s
+{
+    uint8_t bus;            /**< iic bus number */
+    uint8_t cpu;            /**< pinned cpu */
+    uint8_t device;         /**< found device number */
+    uint32_t sweep;         /**< finished sweep number */
+    uint32_t error;         /**< failed sweep number */
+    uint32_t dropped;       /**< dropped event number */
+} mcp9808_engine_status_t;
+
+/**
+ * @brief     engine start
+ * @param[in] *bus pointer to an iic bus number array
+ * @param[in] num bus number
+ * @param[in] period_ms sweep period in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ * @note      every bus is opened with its own context and sampled by its own pinned worker thread,
+ *            num is 1 to MCP9808_ENGINE_MAX_BUS
+ */
+uint8_t mcp9808_engine_start(uint8_t *bus, uint8_t num, uint32_t period_ms);
+
+/**
+ * @brief         engine get the events of one bus
+ * @param[in]     index bus index
+ * @param[out]    *event pointer to an event buffer
+ * @param[in,out] *len pointer to a length buffer
+ * @return        status code
+ *                - 0 success
+ *                - 1 get failed
+ * @note          one consumer only, len is the buffer length on input and the popped number on output
+ */
+uint8_t mcp9808_engine_get_events(uint8_t index, mcp9808_event_t *event, uint32_t *len);
+
+/**
+ * @brief      engine get the status of one bus
+ * @param[in]  index bus index
+ * @param[out] *status pointer to a status structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       none
+ */
+uint8_t mcp9808_engine_get_status(uint8_t index, mcp9808_engine_status_t *status);
+
+/**
+ * @brief  engine stop
+ * @return status code
+ *         - 0 success
+ *         - 1 stop failed
+ * @note   all worker threads are joined and all buses are closed
+ */
+uint8_t mcp9808_engine_stop(void);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,120 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      raspberrypi4b_driver_mcp9808_periodic.h
+ * @brief     driver mcp9808 periodic header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-01-25
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/01/25  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef RASPBERRYPI4B_DRIVER_MCP9808_PERIODIC_H
+#define RASPBERRYPI4B_DRIVER_MCP9808_PERIODIC_H
+
+#include "driver_mcp9808_interface.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup mcp9808_periodic mcp9808 periodic function
+ * @brief    mcp9808 absolute time periodic sampling modules
+ * @{
+ */
+
+/**
+ * @brief mcp9808 periodic default definition
+ */
+#define MCP9808_PERIODIC_NO_CPU        (-1)        /**< do not pin the thread */
+
+/**
+ * @brief mcp9808 periodic config structure definition
+ */
+typedef struct mcp9808_periodic_config_s
+{
+    uint32_t period_us;          /**< sampling period in us */
+    int16_t cpu;                 /**< pinned cpu or MCP9808_PERIODIC_NO_CPU */
+    uint8_t priority;            /**< SCHED_FIFO priority, 0 keeps the normal policy */
+    uint8_t lock_memory;         /**< mlockall the process before sampling */
+} mcp9808_periodic_config_t;
+
+/**
+ * @brief mcp9808 periodic sample structure definition
+ */
+typedef struct mcp9808_periodic_sample_s
+{
+    uint32_t index;              /**< sample index */
+    uint8_t status;              /**< 0 valid, 1 read failed */
+    float temperature_deg;       /**< temperature */
+    uint64_t scheduled_ns;       /**< scheduled CLOCK_MONOTONIC time */
+    uint64_t actual_ns;          /**< CLOCK_MONOTONIC time at wake up */
+} mcp9808_periodic_sample_t;
+
+/**
+ * @brief mcp9808 periodic statistics structure definition
+ */
+typedef struct mcp9808_periodic_stats_s
+{
+    uint32_t count;              /**< sample number */
+    uint32_t missed;             /**< deadlines skipped after an overrun */
+    uint64_t min_ns;             /**< min wake up latency */
+    uint64_t max_ns;             /**< max wake up latency */
+    double mean_ns;              /**< mean wake up latency */
+    double stddev_ns;            /**< wake up latency standard deviation */
+} mcp9808_periodic_stats_t;
+
+/**
+ * @brief      periodic run
+ * @param[in]  *config pointer to a config structure
+ * @param[in]  times sample number
+ * @param[in]  *read pointer to a read function
+ * @param[in]  *callback pointer to a sample callback, it can be NULL
+ * @param[out] *stats pointer to a statistics structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 run failed
+ * @note       deadlines are absolute so the period never drifts, latency is the wake up time minus the scheduled time,
+ *             the scheduling policy and affinity of the calling thread are restored at the end,
+ *             stats is cleared before any other check
+ */
+uint8_t mcp9808_periodic_run(const mcp9808_periodic_config_t *config, uint32_t times,
+                             uint8_t (*read)(float *temperature_deg),
+                             void (*callback)(const mcp9808_periodic_sample_t *sample),
+                             mcp9808_periodic_stats_t *stats);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,152 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      raspberrypi4b_driver_mcp9808_server.h
+ * @brief     driver mcp9808 server header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-01-25
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/01/25  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef RASPBERRYPI4B_DRIVER_MCP9808_SERVER_H
+#define RASPBERRYPI4B_DRIVER_MCP9808_SERVER_H
+
+#include "driver_mcp9808_interface.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup mcp9808_server mcp9808 server function
+ * @brief    mcp9808 unix domain socket streaming server modules
+ * @{
+ */
+
+/**
+ * @brief mcp9808 server default definition
+ */
+#define MCP9808_SERVER_DEFAULT_PATH      "/tmp/mcp9808.sock"        /**< default socket path */
+#define MCP9808_SERVER_MAX_CLIENT        8                          /**< max client number */
+#define MCP9808_SERVER_RING_SIZE         4096                       /**< ring size of one client, power of two */
+#define MCP9808_SERVER_FRAME_SIZE        12                         /**< frame size in bytes */
+#define MCP9808_SERVER_REQUEST_SIZE      4                          /**< request size in bytes */
+#define MCP9808_SERVER_ANY               0xFF                       /**< match any bus or address */
+
+/**
+ * @brief mcp9808 server frame type enumeration definition
+ */
+typedef enum
+{
+    MCP9808_SERVER_TYPE_SAMPLE = 0x00,        /**< periodic sample */
+    MCP9808_SERVER_TYPE_ALERT  = 0x01,        /**< alert event */
+} mcp9808_server_type_t;
+
+/**
+ * @brief mcp9808 server request command enumeration definition
+ */
+typedef enum
+{
+    MCP9808_SERVER_COMMAND_SUBSCRIBE = 0x01,        /**< set the client filter */
+} mcp9808_server_command_t;
+
+/**
+ * @brief mcp9808 server frame structure definition
+ * @note  a frame is sent as type, bus, addr, flags, raw (le16), reserved (le16), time_us (le32),
+ *        a request is sent as command, bus, addr, type mask (bit 0 sample, bit 1 alert)
+ */
+typedef struct mcp9808_server_frame_s
+{
+    uint8_t type;             /**< frame type */
+    uint8_t bus;              /**< iic bus number */
+    uint8_t addr;             /**< iic device address */
+    uint8_t flags;            /**< alert flags */
+    int16_t raw;              /**< raw temperature, 0.0625C per lsb */
+    uint32_t time_us;         /**< timestamp */
+} mcp9808_server_frame_t;
+
+/**
+ * @brief mcp9808 server status structure definition
+ */
+typedef struct mcp9808_server_status_s
+{
+    uint32_t client;          /**< connected client number */
+    uint32_t published;       /**< published frame number */
+    uint32_t dropped;         /**< frames dropped on full client rings */
+} mcp9808_server_status_t;
+
+/**
+ * @brief     server init
+ * @param[in] *path pointer to a socket path
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      the server thread accepts clients and flushes their rings
+ */
+uint8_t mcp9808_server_init(const char *path);
+
+/**
+ * @brief  server deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   all clients are closed and the socket path is removed
+ */
+uint8_t mcp9808_server_deinit(void);
+
+/**
+ * @brief     server publish one frame
+ * @param[in] *frame pointer to a frame structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 publish failed
+ * @note      the frame is copied into every matching client ring and never waits for a socket,
+ *            a client whose ring is full loses the frame
+ */
+uint8_t mcp9808_server_publish(const mcp9808_server_frame_t *frame);
+
+/**
+ * @brief      server get the status
+ * @param[out] *status pointer to a status structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       none
+ */
+uint8_t mcp9808_server_get_status(mcp9808_server_status_t *status);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,182 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      raspberrypi4b_driver_mcp9808_shm.h
+ * @brief     driver mcp9808 shm header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-01-25
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/01/25  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef RASPBERRYPI4B_DRIVER_MCP9808_SHM_H
+#define RASPBERRYPI4B_DRIVER_MCP9808_SHM_H
+
+#include "raspberrypi4b_driver_mcp9808_engine.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup mcp9808_shm mcp9808 shared memory function
+ * @brief    mcp9808 shared memory latest sample table modules
+ * @{
+ */
+
+/**
+ * @brief mcp9808 shared memory default definition
+ */
+#define MCP9808_SHM_DEFAULT_NAME    "/mcp9808"                                               /**< default segment name */
+#define MCP9808_SHM_MAX_SLOT        (MCP9808_ENGINE_MAX_BUS * MCP9808_ENGINE_MAX_DEVICE)     /**< one slot per bus and address */
+#define MCP9808_SHM_MAGIC           0x4D434839U                                              /**< table magic */
+#define MCP9808_SHM_VERSION         1                                                        /**< table layout version */
+#define MCP9808_SHM_READ_RETRY      64                                                       /**< max read retry number */
+
+/**
+ * @brief mcp9808 shared memory sample structure definition
+ */
+typedef struct mcp9808_shm_sample_s
+{
+    uint32_t sequence;             /**< sample number of this slot, 0 is never written */
+    uint32_t time_us;              /**< sample timestamp */
+    int32_t temperature_mc;        /**< temperature in millidegrees celsius */
+    int16_t raw;                   /**< raw temperature, 0.0625C per lsb */
+    uint8_t flags;                 /**< alert flags */
+    uint8_t bus;                   /**< iic bus number */
+    uint8_t addr;                  /**< iic device address */
+} mcp9808_shm_sample_t;
+
+/**
+ * @brief mcp9808 shared memory slot structure definition
+ */
+typedef struct mcp9808_shm_slot_s
+{
+    volatile uint32_t lock;                   /**< seqlock, odd while the writer is updating */
+    volatile mcp9808_shm_sample_t sample;     /**< latest sample */
+    uint8_t reserved[40];                     /**< pad to one cache line */
+} mcp9808_shm_slot_t;
+
+/**
+ * @brief mcp9808 shared memory table structure definition
+ */
+typedef struct mcp9808_shm_table_s
+{
+    uint32_t magic;                                  /**< table magic */
+    uint32_t version;                                /**< table layout version */
+    uint32_t slot_num;                               /**< slot number */
+    uint8_t reserved[52];                            /**< pad to one cache line */
+    mcp9808_shm_slot_t slot[MCP9808_SHM_MAX_SLOT];   /**< sample slots */
+} mcp9808_shm_table_t;
+
+/**
+ * @brief mcp9808 shared memory handle structure definition
+ */
+typedef struct mcp9808_shm_s
+{
+    int fd;                            /**< segment handle */
+    uint8_t writer;                    /**< opened by the writer */
+    char name[32];                     /**< segment name */
+    mcp9808_shm_table_t *table;        /**< mapped table */
+} mcp9808_shm_t;
+
+/**
+ * @brief     shared memory create the table
+ * @param[in] *shm pointer to a shared memory handle structure
+ * @param[in] *name pointer to a segment name
+ * @return    status code
+ *            - 0 success
+ *            - 1 create failed
+ * @note      only one writer process may create the table
+ */
+uint8_t mcp9808_shm_create(mcp9808_shm_t *shm, const char *name);
+
+/**
+ * @brief     shared memory open the table
+ * @param[in] *shm pointer to a shared memory handle structure
+ * @param[in] *name pointer to a segment name
+ * @return    status code
+ *            - 0 success
+ *            - 1 open failed
+ * @note      the table is mapped read only
+ */
+uint8_t mcp9808_shm_open(mcp9808_shm_t *shm, const char *name);
+
+/**
+ * @brief     shared memory close the table
+ * @param[in] *shm pointer to a shared memory handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 close failed
+ * @note      the writer also removes the segment name
+ */
+uint8_t mcp9808_shm_close(mcp9808_shm_t *shm);
+
+/**
+ * @brief     shared memory write one slot
+ * @param[in] *shm pointer to a shared memory handle structure
+ * @param[in] index slot index
+ * @param[in] *sample pointer to a sample structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      sequence is set by the writer
+ */
+uint8_t mcp9808_shm_write(mcp9808_shm_t *shm, uint8_t index, const mcp9808_shm_sample_t *sample);
+
+/**
+ * @brief      shared memory read one slot
+ * @param[in]  *shm pointer to a shared memory handle structure
+ * @param[in]  index slot index
+ * @param[out] *sample pointer to a sample structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 4 slot is busy
+ * @note       the read never blocks, it gives up after MCP9808_SHM_READ_RETRY torn copies
+ */
+uint8_t mcp9808_shm_read(mcp9808_shm_t *shm, uint8_t index, mcp9808_shm_sample_t *sample);
+
+/**
+ * @brief     shared memory get the slot index
+ * @param[in] bus_index engine bus index
+ * @param[in] addr iic device address
+ * @return    slot index
+ * @note      none
+ */
+uint8_t mcp9808_shm_slot_index(uint8_t bus_index, uint8_t addr);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
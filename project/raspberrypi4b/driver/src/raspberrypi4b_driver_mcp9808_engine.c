@@ -0,0 +1,457 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      raspberrypi4b_driver_mcp9808_engine.c
+ * @brief     driver mcp9808 engine source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-01-25
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/01/25  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef _GNU_SOURCE
+    #define _GNU_SOURCE
+#endif
+
+#include "raspberrypi4b_driver_mcp9808_engine.h"
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#include <unistd.h>
+
+/**
+ * @brief mcp9808 engine worker structure definition
+ */
+typedef struct mcp9808_engine_worker_s
+{
+    pthread_t thread;                                          /**< worker thread */
+    void *bus;                                                 /**< bus context */
+    uint8_t bus_num;                                           /**< iic bus number */
+    uint8_t cpu;                                               /**< pinned cpu */
+    uint8_t num;                                               /**< found device number */
+    uint8_t running;                                           /**< thread is running */
+    mcp9808_handle_t handle[MCP9808_ENGINE_MAX_DEVICE];        /**< mcp9808 handles */
+    mcp9808_queue_t queue;                                     /**< published events */
+    mcp9808_event_t event[MCP9808_ENGINE_QUEUE_SIZE];          /**< event buffer */
+    volatile uint32_t sweep;                                   /**< finished sweep number */
+    volatile uint32_t error;                                   /**< failed sweep number */
+} mcp9808_engine_worker_t;
+
+static mcp9808_engine_worker_t gs_worker[MCP9808_ENGINE_MAX_BUS];        /**< engine workers */
+static uint8_t gs_num;                                                   /**< worker number */
+static uint32_t gs_period_ms;                                            /**< sweep period */
+static volatile uint8_t gs_stop;                                         /**< stop request */
+
+/**
+ * @brief  engine iic bus init
+ * @return status code
+ *         - 0 success
+ * @note   the bus context is opened once by the engine
+ */
+static uint8_t a_mcp9808_engine_iic_init(void)
+{
+    return 0;
+}
+
+/**
+ * @brief  engine iic bus deinit
+ * @return status code
+ *         - 0 success
+ * @note   the bus context is closed once by the engine
+ */
+static uint8_t a_mcp9808_engine_iic_deinit(void)
+{
+    return 0;
+}
+
+/**
+ * @brief     engine init one device
+ * @param[in] *handle pointer to a mcp9808 handle structure
+ * @param[in] *bus pointer to a bus context
+ * @param[in] addr iic device address
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      the pointer only read is not linked, another master such as the alert handle
+ *            can move the register pointer of a shared device between two sweeps
+ */
+static uint8_t a_mcp9808_engine_device_init(mcp9808_handle_t *handle, void *bus, mcp9808_address_t addr)
+{
+    /* link interface function */
+    DRIVER_MCP9808_LINK_INIT(handle, mcp9808_handle_t);
+    DRIVER_MCP9808_LINK_BUS(handle, bus);
+    DRIVER_MCP9808_LINK_IIC_INIT(handle, a_mcp9808_engine_iic_init);
+    DRIVER_MCP9808_LINK_IIC_DEINIT(handle, a_mcp9808_engine_iic_deinit);
+    DRIVER_MCP9808_LINK_IIC_READ_CTX(handle, mcp9808_interface_bus_iic_read);
+    DRIVER_MCP9808_LINK_IIC_READ_BATCH_CTX(handle, mcp9808_interface_bus_iic_read_batch);
+    DRIVER_MCP9808_LINK_IIC_WRITE_CTX(handle, mcp9808_interface_bus_iic_write);
+    DRIVER_MCP9808_LINK_DELAY_MS(handle, mcp9808_interface_delay_ms);
+    DRIVER_MCP9808_LINK_GET_TIME_US(handle, mcp9808_interface_get_time_us);
+    DRIVER_MCP9808_LINK_DEBUG_PRINT(handle, mcp9808_interface_debug_print);
+    DRIVER_MCP9808_LINK_RECEIVE_CALLBACK(handle, mcp9808_interface_receive_callback);
+    
+    /* mcp9808 init */
+    if (mcp9808_set_addr(handle, addr) != 0)
+    {
+        return 1;
+    }
+    if (mcp9808_init(handle) != 0)
+    {
+        return 1;
+    }
+    
+    /* enable cache, disable shutdown and set the default resolution */
+    if ((mcp9808_set_cache(handle, MCP9808_BOOL_TRUE) != 0) ||
+        (mcp9808_set_shutdown(handle, MCP9808_BOOL_FALSE) != 0) ||
+        (mcp9808_set_resolution(handle, MCP9808_ENGINE_DEFAULT_RESOLUTION) != 0))
+    {
+        (void)mcp9808_deinit(handle);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     engine close one worker
+ * @param[in] *worker pointer to a worker structure
+ * @note      none
+ */
+static void a_mcp9808_engine_worker_close(mcp9808_engine_worker_t *worker)
+{
+    uint8_t i;
+    
+    for (i = 0; i < worker->num; i++)
+    {
+        (void)mcp9808_deinit(&worker->handle[i]);
+    }
+    worker->num = 0;
+    if (worker->bus != NULL)
+    {
+        (void)mcp9808_interface_bus_close(worker->bus);
+        worker->bus = NULL;
+    }
+}
+
+/**
+ * @brief     engine open one worker
+ * @param[in] *worker pointer to a worker structure
+ * @param[in] bus iic bus number
+ * @return    status code
+ *            - 0 success
+ *            - 1 open failed
+ * @note      all eight addresses are probed
+ */
+static uint8_t a_mcp9808_engine_worker_open(mcp9808_engine_worker_t *worker, uint8_t bus)
+{
+    uint8_t i;
+    
+    worker->bus_num = bus;
+    worker->num = 0;
+    worker->running = 0;
+    worker->sweep = 0;
+    worker->error = 0;
+    worker->bus = mcp9808_interface_bus_open(bus);
+    if (worker->bus == NULL)
+    {
+        mcp9808_interface_debug_print("mcp9808: open bus %d failed.\n", bus);
+        
+        return 1;
+    }
+    if (mcp9808_queue_init(&worker->queue, worker->event, MCP9808_ENGINE_QUEUE_SIZE) != 0)
+    {
+        a_mcp9808_engine_worker_close(worker);
+        
+        return 1;
+    }
+    for (i = 0; i < MCP9808_ENGINE_MAX_DEVICE; i++)
+    {
+        mcp9808_address_t addr;
+        
+        addr = (mcp9808_address_t)(MCP9808_ADDRESS_A2A1A0_000 + (i << 1));
+        if (a_mcp9808_engine_device_init(&worker->handle[worker->num], worker->bus, addr) == 0)
+        {
+            worker->num++;
+        }
+    }
+    if (worker->num == 0)
+    {
+        mcp9808_interface_debug_print("mcp9808: no device found on bus %d.\n", bus);
+        a_mcp9808_engine_worker_close(worker);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      engine sweep all devices of one worker
+ * @param[in]  *worker pointer to a worker structure
+ * @param[out] *raw pointer to a raw temperature array
+ * @return     status code
+ *             - 0 success
+ *             - 1 sweep failed
+ * @note       failed devices are read one by one and left out
+ */
+static uint8_t a_mcp9808_engine_sweep(mcp9808_engine_worker_t *worker, int16_t *raw)
+{
+    uint8_t i;
+    uint8_t res;
+    int32_t temperature_mc;
+    uint32_t time_us;
+    mcp9808_event_t event;
+    mcp9808_handle_t *batch[MCP9808_ENGINE_MAX_DEVICE];
+    
+    res = 0;
+    for (i = 0; i < worker->num; i++)
+    {
+        batch[i] = &worker->handle[i];
+    }
+    if (mcp9808_read_batch(batch, worker->num, raw) != 0)
+    {
+        for (i = 0; i < worker->num; i++)
+        {
+            if (mcp9808_read_milli_c(&worker->handle[i], &raw[i], &temperature_mc) != 0)
+            {
+                raw[i] = INT16_MIN;
+                res = 1;
+            }
+        }
+    }
+    time_us = mcp9808_interface_get_time_us();
+    for (i = 0; i < worker->num; i++)
+    {
+        if (raw[i] == INT16_MIN)
+        {
+            continue;
+        }
+        event.time_us = time_us;
+        event.raw = raw[i];
+        event.flags = 0;
+        event.addr = worker->handle[i].iic_addr;
+        (void)mcp9808_queue_push(&worker->queue, &event);
+    }
+    
+    return res;
+}
+
+/**
+ * @brief     engine worker thread
+ * @param[in] *arg pointer to a worker structure
+ * @return    NULL
+ * @note      the sweep is scheduled on absolute deadlines so the period does not drift
+ */
+static void *a_mcp9808_engine_worker(void *arg)
+{
+    mcp9808_engine_worker_t *worker = (mcp9808_engine_worker_t *)arg;
+    int16_t raw[MCP9808_ENGINE_MAX_DEVICE];
+    struct timespec next;
+    
+    (void)clock_gettime(CLOCK_MONOTONIC, &next);
+    while (gs_stop == 0)
+    {
+        next.tv_sec += gs_period_ms / 1000;
+        next.tv_nsec += (long)(gs_period_ms % 1000) * 1000000L;
+        if (next.tv_nsec >= 1000000000L)
+        {
+            next.tv_sec++;
+            next.tv_nsec -= 1000000000L;
+        }
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL) == EINTR)
+        {
+        }
+        if (gs_stop != 0)
+        {
+            break;
+        }
+        if (a_mcp9808_engine_sweep(worker, raw) != 0)
+        {
+            worker->error++;
+        }
+        worker->sweep++;
+    }
+    
+    return NULL;
+}
+
+/**
+ * @brief     engine start
+ * @param[in] *bus pointer to an iic bus number array
+ * @param[in] num bus number
+ * @param[in] period_ms sweep period in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ * @note      every bus is opened with its own context and sampled by its own pinned worker thread,
+ *            num is 1 to MCP9808_ENGINE_MAX_BUS
+ */
+uint8_t mcp9808_engine_start(uint8_t *bus, uint8_t num, uint32_t period_ms)
+{
+    uint8_t i;
+    long cpus;
+    
+    /* check the params */
+    if ((bus == NULL) || (num == 0) || (num > MCP9808_ENGINE_MAX_BUS) || (period_ms == 0) || (gs_num != 0))
+    {
+        mcp9808_interface_debug_print("mcp9808: engine param is invalid.\n");
+        
+        return 1;
+    }
+    
+    /* open all buses before any thread runs */
+    for (i = 0; i < num; i++)
+    {
+        if (a_mcp9808_engine_worker_open(&gs_worker[i], bus[i]) != 0)
+        {
+            while (i > 0)
+            {
+                i--;
+                a_mcp9808_engine_worker_close(&gs_worker[i]);
+            }
+            
+            return 1;
+        }
+    }
+    
+    /* start one pinned worker per bus */
+    cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    if (cpus < 1)
+    {
+        cpus = 1;
+    }
+    gs_stop = 0;
+    gs_period_ms = period_ms;
+    gs_num = num;
+    for (i = 0; i < num; i++)
+    {
+        cpu_set_t set;
+        
+        gs_worker[i].cpu = (uint8_t)(i % cpus);
+        if (pthread_create(&gs_worker[i].thread, NULL, a_mcp9808_engine_worker, &gs_worker[i]) != 0)
+        {
+            mcp9808_interface_debug_print("mcp9808: create worker failed.\n");
+            (void)mcp9808_engine_stop();
+            
+            return 1;
+        }
+        gs_worker[i].running = 1;
+        CPU_ZERO(&set);
+        CPU_SET(gs_worker[i].cpu, &set);
+        if (pthread_setaffinity_np(gs_worker[i].thread, sizeof(set), &set) != 0)
+        {
+            mcp9808_interface_debug_print("mcp9808: pin worker to cpu %d failed.\n", gs_worker[i].cpu);
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief         engine get the events of one bus
+ * @param[in]     index bus index
+ * @param[out]    *event pointer to an event buffer
+ * @param[in,out] *len pointer to a length buffer
+ * @return        status code
+ *                - 0 success
+ *                - 1 get failed
+ * @note          one consumer only, len is the buffer length on input and the popped number on output
+ */
+uint8_t mcp9808_engine_get_events(uint8_t index, mcp9808_event_t *event, uint32_t *len)
+{
+    if (index >= gs_num)
+    {
+        return 1;
+    }
+    if (mcp9808_queue_pop(&gs_worker[index].queue, event, len) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      engine get the status of one bus
+ * @param[in]  index bus index
+ * @param[out] *status pointer to a status structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       none
+ */
+uint8_t mcp9808_engine_get_status(uint8_t index, mcp9808_engine_status_t *status)
+{
+    if ((index >= gs_num) || (status == NULL))
+    {
+        return 1;
+    }
+    status->bus = gs_worker[index].bus_num;
+    status->cpu = gs_worker[index].cpu;
+    status->device = gs_worker[index].num;
+    status->sweep = gs_worker[index].sweep;
+    status->error = gs_worker[index].error;
+    if (mcp9808_queue_get_dropped(&gs_worker[index].queue, &status->dropped) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  engine stop
+ * @return status code
+ *         - 0 success
+ *         - 1 stop failed
+ * @note   all worker threads are joined and all buses are closed
+ */
+uint8_t mcp9808_engine_stop(void)
+{
+    uint8_t i;
+    
+    if (gs_num == 0)
+    {
+        return 1;
+    }
+    gs_stop = 1;
+    for (i = 0; i < gs_num; i++)
+    {
+        if (gs_worker[i].running != 0)
+        {
+            (void)pthread_join(gs_worker[i].thread, NULL);
+            gs_worker[i].running = 0;
+        }
+        a_mcp9808_engine_worker_close(&gs_worker[i]);
+    }
+    gs_num = 0;
+    
+    return 0;
+}
@@ -37,6 +37,13 @@
 #include "driver_mcp9808_interface.h"
 #include "iic.h"
 #include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <errno.h>
+#include <poll.h>
+#include <pthread.h>
+#include <sys/eventfd.h>
 
 /**
  * @brief iic device name definition
@@ -47,6 +54,36 @@
  * @brief iic device handle definition
  */
 static int gs_fd;                           /**< iic handle */
+static iic_context_t gs_ctx;                /**< iic context shared by all threads, serialized by its mutex */
+
+/**
+ * @brief bus context structure definition
+ */
+typedef struct bus_context_s
+{
+    int fd;                                 /**< iic handle */
+    iic_context_t ctx;                      /**< iic context */
+} bus_context_t;
+
+/**
+ * @brief iic transfer status definition
+ */
+static uint8_t gs_status;                   /**< iic transfer status */
+
+/**
+ * @brief event handle definition
+ */
+static int gs_event_fd = -1;                              /**< event handle */
+static pthread_once_t gs_event_once = PTHREAD_ONCE_INIT;  /**< event init once */
+
+/**
+ * @brief event open
+ * @note  none
+ */
+static void a_event_open(void)
+{
+    gs_event_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+}
 
 /**
  * @brief  interface iic bus init
@@ -57,7 +94,18 @@ static int gs_fd;                           /**< iic handle */
  */
 uint8_t mcp9808_interface_iic_init(void)
 {
-    return iic_init(IIC_DEVICE_NAME, &gs_fd);
+    if (iic_init(IIC_DEVICE_NAME, &gs_fd) != 0)
+    {
+        return 1;
+    }
+    if (iic_context_init(&gs_ctx, gs_fd) != 0)
+    {
+        (void)iic_deinit(gs_fd);
+        
+        return 1;
+    }
+    
+    return 0;
 }
 
 /**
@@ -69,6 +117,11 @@ uint8_t mcp9808_interface_iic_init(void)
  */
 uint8_t mcp9808_interface_iic_deinit(void)
 {
+    if (iic_context_deinit(&gs_ctx) != 0)
+    {
+        return 1;
+    }
+    
     return iic_deinit(gs_fd);
 }
 
@@ -85,7 +138,7 @@ uint8_t mcp9808_interface_iic_deinit(void)
  */
 uint8_t mcp9808_interface_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
 {
-    return iic_write(gs_fd, addr, reg, buf, len);
+    return iic_context_write(&gs_ctx, addr, reg, buf, len);
 }
 
 /**
@@ -101,7 +154,217 @@ uint8_t mcp9808_interface_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uin
  */
 uint8_t mcp9808_interface_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
 {
-    return iic_read(gs_fd, addr, reg, buf, len);
+    return iic_context_read(&gs_ctx, addr, reg, buf, len);
+}
+
+/**
+ * @brief      interface iic bus read without the register address
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t mcp9808_interface_iic_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    return iic_read_cmd(gs_fd, addr, buf, len);
+}
+
+/**
+ * @brief      interface iic bus read from many devices
+ * @param[in]  *addr pointer to an iic device write address array
+ * @param[in]  *reg pointer to an iic register address array
+ * @param[out] *buf pointer to a data buffer, len bytes per device
+ * @param[in]  len data length of one device
+ * @param[in]  num device number
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t mcp9808_interface_iic_read_batch(uint8_t *addr, uint8_t *reg, uint8_t *buf, uint16_t len, uint16_t num)
+{
+    return iic_read_batch(gs_fd, addr, reg, buf, len, num);
+}
+
+/**
+ * @brief     interface iic bus context open
+ * @param[in] bus iic bus number
+ * @return    pointer to a bus context, NULL on failure
+ * @note      every bus context owns its own bus handle
+ */
+void *mcp9808_interface_bus_open(uint8_t bus)
+{
+    char name[32];
+    bus_context_t *context;
+    
+    context = (bus_context_t *)malloc(sizeof(bus_context_t));
+    if (context == NULL)
+    {
+        return NULL;
+    }
+    (void)snprintf(name, sizeof(name), "/dev/i2c-%d", bus);
+    if (iic_init(name, &context->fd) != 0)
+    {
+        free(context);
+        
+        return NULL;
+    }
+    if (iic_context_init(&context->ctx, context->fd) != 0)
+    {
+        (void)iic_deinit(context->fd);
+        free(context);
+        
+        return NULL;
+    }
+    
+    return context;
+}
+
+/**
+ * @brief     interface iic bus context close
+ * @param[in] *bus pointer to a bus context
+ * @return    status code
+ *            - 0 success
+ *            - 1 close failed
+ * @note      none
+ */
+uint8_t mcp9808_interface_bus_close(void *bus)
+{
+    uint8_t res;
+    bus_context_t *context = (bus_context_t *)bus;
+    
+    if (context == NULL)
+    {
+        return 1;
+    }
+    res = iic_context_deinit(&context->ctx);
+    if (iic_deinit(context->fd) != 0)
+    {
+        res = 1;
+    }
+    free(context);
+    
+    return res;
+}
+
+/**
+ * @brief     interface iic bus context write
+ * @param[in] *bus pointer to a bus context
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+uint8_t mcp9808_interface_bus_iic_write(void *bus, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    return iic_context_write(&((bus_context_t *)bus)->ctx, addr, reg, buf, len);
+}
+
+/**
+ * @brief      interface iic bus context read
+ * @param[in]  *bus pointer to a bus context
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t mcp9808_interface_bus_iic_read(void *bus, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    return iic_context_read(&((bus_context_t *)bus)->ctx, addr, reg, buf, len);
+}
+
+/**
+ * @brief      interface iic bus context read without the register address
+ * @param[in]  *bus pointer to a bus context
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t mcp9808_interface_bus_iic_read_cmd(void *bus, uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    return iic_read_cmd(((bus_context_t *)bus)->fd, addr, buf, len);
+}
+
+/**
+ * @brief      interface iic bus context read from many devices
+ * @param[in]  *bus pointer to a bus context
+ * @param[in]  *addr pointer to an iic device write address array
+ * @param[in]  *reg pointer to an iic register address array
+ * @param[out] *buf pointer to a data buffer, len bytes per device
+ * @param[in]  len data length of one device
+ * @param[in]  num device number
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t mcp9808_interface_bus_iic_read_batch(void *bus, uint8_t *addr, uint8_t *reg, uint8_t *buf, uint16_t len, uint16_t num)
+{
+    return iic_read_batch(((bus_context_t *)bus)->fd, addr, reg, buf, len, num);
+}
+
+/**
+ * @brief      interface iic bus read start
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 start failed
+ * @note       buf must stay valid until iic_status is not busy
+ */
+uint8_t mcp9808_interface_iic_read_start(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    gs_status = iic_context_read(&gs_ctx, addr, reg, buf, len);
+    
+    return 0;
+}
+
+/**
+ * @brief     interface iic bus write start
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ * @note      buf must stay valid until iic_status is not busy
+ */
+uint8_t mcp9808_interface_iic_write_start(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    gs_status = iic_context_write(&gs_ctx, addr, reg, buf, len);
+    
+    return 0;
+}
+
+/**
+ * @brief  interface iic bus transfer status
+ * @return status code
+ *         - 0 done
+ *         - 1 error
+ *         - 2 busy
+ * @note   none
+ */
+uint8_t mcp9808_interface_iic_status(void)
+{
+    return gs_status;
 }
 
 /**
@@ -114,6 +377,77 @@ void mcp9808_interface_delay_ms(uint32_t ms)
     usleep(1000 * ms);
 }
 
+/**
+ * @brief  interface get the monotonic time
+ * @return time in microseconds
+ * @note   none
+ */
+uint32_t mcp9808_interface_get_time_us(void)
+{
+    struct timespec ts;
+    
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000 + (uint64_t)ts.tv_nsec / 1000);
+}
+
+/**
+ * @brief interface event notify
+ * @note  it is called in the irq context and must not block
+ */
+void mcp9808_interface_event_notify(void)
+{
+    uint64_t value = 1;
+    
+    (void)pthread_once(&gs_event_once, a_event_open);
+    if (gs_event_fd >= 0)
+    {
+        if (write(gs_event_fd, &value, sizeof(value)) < 0)
+        {
+            return;
+        }
+    }
+}
+
+/**
+ * @brief     interface event wait
+ * @param[in] timeout_ms timeout in ms, MCP9808_INTERFACE_WAIT_FOREVER waits without a timeout
+ * @return    status code
+ *            - 0 success
+ *            - 1 timeout
+ * @note      a notify before the wait is not lost
+ */
+uint8_t mcp9808_interface_event_wait(uint32_t timeout_ms)
+{
+    int res;
+    uint64_t value;
+    struct pollfd fds;
+    
+    (void)pthread_once(&gs_event_once, a_event_open);
+    if (gs_event_fd < 0)
+    {
+        return 1;
+    }
+    fds.fd = gs_event_fd;
+    fds.events = POLLIN;
+    fds.revents = 0;
+    do
+    {
+        res = poll(&fds, 1, (timeout_ms == MCP9808_INTERFACE_WAIT_FOREVER) ? -1 :
+                           ((timeout_ms > 0x7FFFFFFFU) ? 0x7FFFFFFF : (int)timeout_ms));
+    } while ((res < 0) && (errno == EINTR));
+    if (res <= 0)
+    {
+        return 1;
+    }
+    if (read(gs_event_fd, &value, sizeof(value)) < 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
 /**
  * @brief     interface print format data
  * @param[in] fmt format data
@@ -129,7 +463,7 @@ void mcp9808_interface_debug_print(const char *const fmt, ...)
     vsnprintf((char *)str, 255, (char const *)fmt, args);
     va_end(args);
     
-    (void)printf((uint8_t *)str);
+    (void)printf("%s", str);
 }
 
 /**
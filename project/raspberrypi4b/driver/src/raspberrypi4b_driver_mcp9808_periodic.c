@@ -0,0 +1,229 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      raspberrypi4b_driver_mcp9808_periodic.c
+ * @brief     driver mcp9808 periodic source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-01-25
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/01/25  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef _GNU_SOURCE
+    #define _GNU_SOURCE
+#endif
+
+#include "raspberrypi4b_driver_mcp9808_periodic.h"
+#include <errno.h>
+#include <math.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#include <sys/mman.h>
+
+/**
+ * @brief  periodic get the monotonic time
+ * @return time in ns
+ * @note   none
+ */
+static uint64_t a_mcp9808_periodic_now_ns(void)
+{
+    struct timespec ts;
+    
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief     periodic sleep until an absolute time
+ * @param[in] ns CLOCK_MONOTONIC time in ns
+ * @note      none
+ */
+static void a_mcp9808_periodic_sleep_until(uint64_t ns)
+{
+    struct timespec ts;
+    
+    ts.tv_sec = (time_t)(ns / 1000000000ULL);
+    ts.tv_nsec = (long)(ns % 1000000000ULL);
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR)
+    {
+    }
+}
+
+/**
+ * @brief      periodic run
+ * @param[in]  *config pointer to a config structure
+ * @param[in]  times sample number
+ * @param[in]  *read pointer to a read function
+ * @param[in]  *callback pointer to a sample callback, it can be NULL
+ * @param[out] *stats pointer to a statistics structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 run failed
+ * @note       deadlines are absolute so the period never drifts, latency is the wake up time minus the scheduled time,
+ *             the scheduling policy and affinity of the calling thread are restored at the end,
+ *             stats is cleared before any other check
+ */
+uint8_t mcp9808_periodic_run(const mcp9808_periodic_config_t *config, uint32_t times,
+                             uint8_t (*read)(float *temperature_deg),
+                             void (*callback)(const mcp9808_periodic_sample_t *sample),
+                             mcp9808_periodic_stats_t *stats)
+{
+    uint8_t res;
+    uint32_t i;
+    int policy;
+    uint64_t now;
+    uint64_t next;
+    uint64_t period;
+    uint64_t latency;
+    double delta;
+    double m2;
+    cpu_set_t cpus;
+    cpu_set_t set;
+    struct sched_param param;
+    struct sched_param fifo;
+    mcp9808_periodic_sample_t sample;
+    pthread_t self = pthread_self();
+    
+    /* check the params */
+    if (stats == NULL)
+    {
+        mcp9808_interface_debug_print("mcp9808: periodic param is invalid.\n");
+        
+        return 1;
+    }
+    memset(stats, 0, sizeof(mcp9808_periodic_stats_t));
+    if ((config == NULL) || (read == NULL) || (config->period_us == 0))
+    {
+        mcp9808_interface_debug_print("mcp9808: periodic param is invalid.\n");
+        
+        return 1;
+    }
+    
+    /* save the thread settings */
+    if ((pthread_getschedparam(self, &policy, &param) != 0) ||
+        (pthread_getaffinity_np(self, sizeof(cpus), &cpus) != 0))
+    {
+        mcp9808_interface_debug_print("mcp9808: get thread settings failed.\n");
+        
+        return 1;
+    }
+    
+    /* keep every page resident so no fault lands inside a period */
+    if ((config->lock_memory != 0) && (mlockall(MCL_CURRENT | MCL_FUTURE) != 0))
+    {
+        perror("mcp9808: mlockall failed.\n");
+        
+        return 1;
+    }
+    
+    /* pin the thread */
+    res = 0;
+    if (config->cpu != MCP9808_PERIODIC_NO_CPU)
+    {
+        CPU_ZERO(&set);
+        CPU_SET(config->cpu, &set);
+        if (pthread_setaffinity_np(self, sizeof(set), &set) != 0)
+        {
+            mcp9808_interface_debug_print("mcp9808: pin to cpu %d failed.\n", config->cpu);
+            res = 1;
+        }
+    }
+    
+    /* run as a realtime thread */
+    if ((res == 0) && (config->priority != 0))
+    {
+        memset(&fifo, 0, sizeof(fifo));
+        fifo.sched_priority = config->priority;
+        if (pthread_setschedparam(self, SCHED_FIFO, &fifo) != 0)
+        {
+            mcp9808_interface_debug_print("mcp9808: set SCHED_FIFO %d failed.\n", config->priority);
+            res = 1;
+        }
+    }
+    
+    /* sample on absolute deadlines */
+    m2 = 0.0;
+    period = (uint64_t)config->period_us * 1000ULL;
+    next = a_mcp9808_periodic_now_ns() + period;
+    for (i = 0; (res == 0) && (i < times); i++)
+    {
+        a_mcp9808_periodic_sleep_until(next);
+        now = a_mcp9808_periodic_now_ns();
+        sample.index = i;
+        sample.scheduled_ns = next;
+        sample.actual_ns = now;
+        sample.temperature_deg = 0.0f;
+        sample.status = (read(&sample.temperature_deg) != 0) ? 1 : 0;
+        if (callback != NULL)
+        {
+            callback(&sample);
+        }
+        
+        /* update the latency statistics */
+        latency = (now > next) ? (now - next) : 0;
+        if ((stats->count == 0) || (latency < stats->min_ns))
+        {
+            stats->min_ns = latency;
+        }
+        if (latency > stats->max_ns)
+        {
+            stats->max_ns = latency;
+        }
+        stats->count++;
+        delta = (double)latency - stats->mean_ns;
+        stats->mean_ns += delta / (double)stats->count;
+        m2 += delta * ((double)latency - stats->mean_ns);
+        
+        /* skip the deadlines already passed by an overrun */
+        next += period;
+        now = a_mcp9808_periodic_now_ns();
+        if (now > next)
+        {
+            uint64_t skip = (now - next) / period + 1;
+            
+            stats->missed += (uint32_t)skip;
+            next += skip * period;
+        }
+    }
+    if (stats->count > 1)
+    {
+        stats->stddev_ns = sqrt(m2 / (double)(stats->count - 1));
+    }
+    
+    /* restore the thread settings */
+    (void)pthread_setschedparam(self, policy, &param);
+    (void)pthread_setaffinity_np(self, sizeof(cpus), &cpus);
+    if (config->lock_memory != 0)
+    {
+        (void)munlockall();
+    }
+    
+    return res;
+}
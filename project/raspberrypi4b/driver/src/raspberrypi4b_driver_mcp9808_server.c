@@ -0,0 +1,545 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      raspberrypi4b_driver_mcp9808_server.c
+ * @brief     driver mcp9808 server source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-01-25
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/01/25  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef _GNU_SOURCE
+    #define _GNU_SOURCE
+#endif
+
+#include "raspberrypi4b_driver_mcp9808_server.h"
+#include <errno.h>
+#include <poll.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <sys/un.h>
+
+/**
+ * @brief mcp9808 server client structure definition
+ */
+typedef struct mcp9808_server_client_s
+{
+    int fd;                                               /**< client socket, -1 when free */
+    uint8_t bus;                                          /**< subscribed bus */
+    uint8_t addr;                                         /**< subscribed address */
+    uint8_t mask;                                         /**< subscribed type mask */
+    uint8_t request[MCP9808_SERVER_REQUEST_SIZE];         /**< partial request */
+    uint8_t request_len;                                  /**< partial request length */
+    uint32_t head;                                        /**< ring write position */
+    uint32_t tail;                                        /**< ring send position */
+    uint8_t ring[MCP9808_SERVER_RING_SIZE];               /**< pending frames */
+} mcp9808_server_client_t;
+
+static mcp9808_server_client_t gs_client[MCP9808_SERVER_MAX_CLIENT];        /**< clients */
+static pthread_mutex_t gs_mutex = PTHREAD_MUTEX_INITIALIZER;                /**< client table lock */
+static pthread_t gs_pid;                                                    /**< server pthread pid */
+static int gs_listen_fd = -1;                                               /**< listening socket */
+static int gs_event_fd = -1;                                                /**< wake event */
+static volatile uint8_t gs_stop;                                            /**< stop request */
+static uint8_t gs_inited;                                                   /**< server is running */
+static char gs_path[sizeof(((struct sockaddr_un *)0)->sun_path)];           /**< socket path */
+static uint32_t gs_published;                                               /**< published frame number */
+static uint32_t gs_dropped;                                                 /**< dropped frame number */
+
+/**
+ * @brief     server close one client
+ * @param[in] *client pointer to a client structure
+ * @note      none
+ */
+static void a_mcp9808_server_client_close(mcp9808_server_client_t *client)
+{
+    int fd;
+    
+    (void)pthread_mutex_lock(&gs_mutex);
+    fd = client->fd;
+    client->fd = -1;
+    (void)pthread_mutex_unlock(&gs_mutex);
+    if (fd >= 0)
+    {
+        (void)close(fd);
+    }
+}
+
+/**
+ * @brief  server accept one client
+ * @note   the client gets every frame until it subscribes
+ */
+static void a_mcp9808_server_accept(void)
+{
+    int fd;
+    uint8_t i;
+    
+    fd = accept4(gs_listen_fd, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+    if (fd < 0)
+    {
+        return;
+    }
+    (void)pthread_mutex_lock(&gs_mutex);
+    for (i = 0; i < MCP9808_SERVER_MAX_CLIENT; i++)
+    {
+        if (gs_client[i].fd < 0)
+        {
+            gs_client[i].bus = MCP9808_SERVER_ANY;
+            gs_client[i].addr = MCP9808_SERVER_ANY;
+            gs_client[i].mask = (1 << MCP9808_SERVER_TYPE_SAMPLE) | (1 << MCP9808_SERVER_TYPE_ALERT);
+            gs_client[i].request_len = 0;
+            gs_client[i].head = 0;
+            gs_client[i].tail = 0;
+            gs_client[i].fd = fd;
+            (void)pthread_mutex_unlock(&gs_mutex);
+            
+            return;
+        }
+    }
+    (void)pthread_mutex_unlock(&gs_mutex);
+    (void)close(fd);
+}
+
+/**
+ * @brief      server receive the client requests
+ * @param[in]  *client pointer to a client structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 the client is gone
+ * @note       none
+ */
+static uint8_t a_mcp9808_server_receive(mcp9808_server_client_t *client)
+{
+    ssize_t n;
+    
+    while (1)
+    {
+        n = recv(client->fd, &client->request[client->request_len],
+                 MCP9808_SERVER_REQUEST_SIZE - client->request_len, MSG_DONTWAIT);
+        if (n == 0)
+        {
+            return 1;
+        }
+        if (n < 0)
+        {
+            return ((errno == EAGAIN) || (errno == EWOULDBLOCK) || (errno == EINTR)) ? 0 : 1;
+        }
+        client->request_len += (uint8_t)n;
+        if (client->request_len < MCP9808_SERVER_REQUEST_SIZE)
+        {
+            continue;
+        }
+        client->request_len = 0;
+        if (client->request[0] == MCP9808_SERVER_COMMAND_SUBSCRIBE)
+        {
+            (void)pthread_mutex_lock(&gs_mutex);
+            client->bus = client->request[1];
+            client->addr = client->request[2];
+            client->mask = client->request[3];
+            (void)pthread_mutex_unlock(&gs_mutex);
+        }
+    }
+}
+
+/**
+ * @brief      server flush one client ring
+ * @param[in]  *client pointer to a client structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 the client is gone
+ * @note       all pending bytes are sent with one gathered write,
+ *             only the producers move head so the pending bytes are read without the lock
+ */
+static uint8_t a_mcp9808_server_flush(mcp9808_server_client_t *client)
+{
+    uint32_t head;
+    uint32_t tail;
+    uint32_t len;
+    uint32_t first;
+    ssize_t n;
+    struct iovec iov[2];
+    struct msghdr msg;
+    
+    (void)pthread_mutex_lock(&gs_mutex);
+    head = client->head;
+    tail = client->tail;
+    (void)pthread_mutex_unlock(&gs_mutex);
+    if (head == tail)
+    {
+        return 0;
+    }
+    len = head - tail;
+    first = MCP9808_SERVER_RING_SIZE - (tail & (MCP9808_SERVER_RING_SIZE - 1));
+    if (first > len)
+    {
+        first = len;
+    }
+    iov[0].iov_base = &client->ring[tail & (MCP9808_SERVER_RING_SIZE - 1)];
+    iov[0].iov_len = first;
+    iov[1].iov_base = &client->ring[0];
+    iov[1].iov_len = len - first;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = iov;
+    msg.msg_iovlen = (len > first) ? 2 : 1;
+    n = sendmsg(client->fd, &msg, MSG_DONTWAIT | MSG_NOSIGNAL);
+    if (n < 0)
+    {
+        return ((errno == EAGAIN) || (errno == EWOULDBLOCK) || (errno == EINTR)) ? 0 : 1;
+    }
+    (void)pthread_mutex_lock(&gs_mutex);
+    client->tail += (uint32_t)n;
+    (void)pthread_mutex_unlock(&gs_mutex);
+    
+    return 0;
+}
+
+/**
+ * @brief  server pthread
+ * @param  *p pointer to an args buffer
+ * @return NULL
+ * @note   none
+ */
+static void *a_mcp9808_server_pthread(void *p)
+{
+    uint8_t i;
+    nfds_t num;
+    uint64_t value;
+    struct pollfd fds[MCP9808_SERVER_MAX_CLIENT + 2];
+    int8_t index[MCP9808_SERVER_MAX_CLIENT + 2];
+    
+    (void)p;
+    while (gs_stop == 0)
+    {
+        /* watch the listening socket, the wake event and every client */
+        fds[0].fd = gs_listen_fd;
+        fds[0].events = POLLIN;
+        fds[1].fd = gs_event_fd;
+        fds[1].events = POLLIN;
+        num = 2;
+        (void)pthread_mutex_lock(&gs_mutex);
+        for (i = 0; i < MCP9808_SERVER_MAX_CLIENT; i++)
+        {
+            if (gs_client[i].fd >= 0)
+            {
+                fds[num].fd = gs_client[i].fd;
+                fds[num].events = POLLIN;
+                if (gs_client[i].head != gs_client[i].tail)
+                {
+                    fds[num].events |= POLLOUT;
+                }
+                index[num] = (int8_t)i;
+                num++;
+            }
+        }
+        (void)pthread_mutex_unlock(&gs_mutex);
+        if (poll(fds, num, -1) < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            
+            break;
+        }
+        if (gs_stop != 0)
+        {
+            break;
+        }
+        if ((fds[1].revents & POLLIN) != 0)
+        {
+            if (read(gs_event_fd, &value, sizeof(value)) < 0)
+            {
+                value = 0;
+            }
+        }
+        if ((fds[0].revents & POLLIN) != 0)
+        {
+            a_mcp9808_server_accept();
+        }
+        
+        /* serve the clients */
+        for (i = 2; i < num; i++)
+        {
+            mcp9808_server_client_t *client = &gs_client[index[i]];
+            
+            if ((fds[i].revents & (POLLERR | POLLHUP | POLLNVAL)) != 0)
+            {
+                a_mcp9808_server_client_close(client);
+                
+                continue;
+            }
+            if (((fds[i].revents & POLLIN) != 0) && (a_mcp9808_server_receive(client) != 0))
+            {
+                a_mcp9808_server_client_close(client);
+                
+                continue;
+            }
+            if (a_mcp9808_server_flush(client) != 0)
+            {
+                a_mcp9808_server_client_close(client);
+            }
+        }
+    }
+    
+    return NULL;
+}
+
+/**
+ * @brief     server init
+ * @param[in] *path pointer to a socket path
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      the server thread accepts clients and flushes their rings
+ */
+uint8_t mcp9808_server_init(const char *path)
+{
+    uint8_t i;
+    struct sockaddr_un addr;
+    
+    /* check the params */
+    if ((gs_inited != 0) || (path == NULL) || (strlen(path) >= sizeof(gs_path)))
+    {
+        mcp9808_interface_debug_print("mcp9808: server param is invalid.\n");
+        
+        return 1;
+    }
+    (void)strcpy(gs_path, path);
+    
+    /* listen on the path */
+    gs_listen_fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (gs_listen_fd < 0)
+    {
+        perror("mcp9808: socket failed.\n");
+        
+        return 1;
+    }
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    (void)strcpy(addr.sun_path, gs_path);
+    (void)unlink(gs_path);
+    if ((bind(gs_listen_fd, (struct sockaddr *)&addr, sizeof(addr)) != 0) ||
+        (listen(gs_listen_fd, MCP9808_SERVER_MAX_CLIENT) != 0))
+    {
+        perror("mcp9808: bind failed.\n");
+        (void)close(gs_listen_fd);
+        
+        return 1;
+    }
+    
+    /* create the wake event */
+    gs_event_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (gs_event_fd < 0)
+    {
+        perror("mcp9808: eventfd failed.\n");
+        (void)close(gs_listen_fd);
+        (void)unlink(gs_path);
+        
+        return 1;
+    }
+    
+    /* start the server */
+    for (i = 0; i < MCP9808_SERVER_MAX_CLIENT; i++)
+    {
+        gs_client[i].fd = -1;
+    }
+    gs_published = 0;
+    gs_dropped = 0;
+    gs_stop = 0;
+    if (pthread_create(&gs_pid, NULL, a_mcp9808_server_pthread, NULL) != 0)
+    {
+        perror("mcp9808: creat pthread failed.\n");
+        (void)close(gs_event_fd);
+        (void)close(gs_listen_fd);
+        (void)unlink(gs_path);
+        
+        return 1;
+    }
+    gs_inited = 1;
+    
+    return 0;
+}
+
+/**
+ * @brief  server deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   all clients are closed and the socket path is removed
+ */
+uint8_t mcp9808_server_deinit(void)
+{
+    uint8_t i;
+    uint64_t value = 1;
+    
+    if (gs_inited == 0)
+    {
+        return 1;
+    }
+    
+    /* stop the server */
+    gs_stop = 1;
+    if (write(gs_event_fd, &value, sizeof(value)) != (ssize_t)sizeof(value))
+    {
+        perror("mcp9808: wake pthread failed.\n");
+        
+        return 1;
+    }
+    (void)pthread_join(gs_pid, NULL);
+    
+    /* close all sockets */
+    for (i = 0; i < MCP9808_SERVER_MAX_CLIENT; i++)
+    {
+        a_mcp9808_server_client_close(&gs_client[i]);
+    }
+    (void)close(gs_listen_fd);
+    (void)close(gs_event_fd);
+    (void)unlink(gs_path);
+    gs_listen_fd = -1;
+    gs_event_fd = -1;
+    gs_inited = 0;
+    
+    return 0;
+}
+
+/**
+ * @brief     server publish one frame
+ * @param[in] *frame pointer to a frame structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 publish failed
+ * @note      the frame is copied into every matching client ring and never waits for a socket,
+ *            a client whose ring is full loses the frame
+ */
+uint8_t mcp9808_server_publish(const mcp9808_server_frame_t *frame)
+{
+    uint8_t i;
+    uint8_t j;
+    uint8_t wake;
+    uint8_t buf[MCP9808_SERVER_FRAME_SIZE];
+    uint64_t value = 1;
+    
+    if ((gs_inited == 0) || (frame == NULL))
+    {
+        return 1;
+    }
+    
+    /* encode the frame */
+    buf[0] = frame->type;
+    buf[1] = frame->bus;
+    buf[2] = frame->addr;
+    buf[3] = frame->flags;
+    buf[4] = (uint8_t)(((uint16_t)frame->raw >> 0) & 0xFF);
+    buf[5] = (uint8_t)(((uint16_t)frame->raw >> 8) & 0xFF);
+    buf[6] = 0;
+    buf[7] = 0;
+    buf[8] = (uint8_t)((frame->time_us >> 0) & 0xFF);
+    buf[9] = (uint8_t)((frame->time_us >> 8) & 0xFF);
+    buf[10] = (uint8_t)((frame->time_us >> 16) & 0xFF);
+    buf[11] = (uint8_t)((frame->time_us >> 24) & 0xFF);
+    
+    /* copy into every matching ring */
+    wake = 0;
+    (void)pthread_mutex_lock(&gs_mutex);
+    gs_published++;
+    for (i = 0; i < MCP9808_SERVER_MAX_CLIENT; i++)
+    {
+        mcp9808_server_client_t *client = &gs_client[i];
+        
+        if ((client->fd < 0) ||
+            ((client->bus != MCP9808_SERVER_ANY) && (client->bus != frame->bus)) ||
+            ((client->addr != MCP9808_SERVER_ANY) && (client->addr != frame->addr)) ||
+            ((client->mask & (1 << frame->type)) == 0))
+        {
+            continue;
+        }
+        if ((MCP9808_SERVER_RING_SIZE - (client->head - client->tail)) < MCP9808_SERVER_FRAME_SIZE)
+        {
+            gs_dropped++;
+            
+            continue;
+        }
+        if (client->head == client->tail)
+        {
+            wake = 1;
+        }
+        for (j = 0; j < MCP9808_SERVER_FRAME_SIZE; j++)
+        {
+            client->ring[(client->head + j) & (MCP9808_SERVER_RING_SIZE - 1)] = buf[j];
+        }
+        client->head += MCP9808_SERVER_FRAME_SIZE;
+    }
+    (void)pthread_mutex_unlock(&gs_mutex);
+    
+    /* only an empty ring needs a wake, a busy one is flushed anyway */
+    if (wake != 0)
+    {
+        if (write(gs_event_fd, &value, sizeof(value)) != (ssize_t)sizeof(value))
+        {
+            return 1;
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      server get the status
+ * @param[out] *status pointer to a status structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       none
+ */
+uint8_t mcp9808_server_get_status(mcp9808_server_status_t *status)
+{
+    uint8_t i;
+    
+    if ((gs_inited == 0) || (status == NULL))
+    {
+        return 1;
+    }
+    (void)pthread_mutex_lock(&gs_mutex);
+    status->client = 0;
+    for (i = 0; i < MCP9808_SERVER_MAX_CLIENT; i++)
+    {
+        if (gs_client[i].fd >= 0)
+        {
+            status->client++;
+        }
+    }
+    status->published = gs_published;
+    status->dropped = gs_dropped;
+    (void)pthread_mutex_unlock(&gs_mutex);
+    
+    return 0;
+}
@@ -0,0 +1,290 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      raspberrypi4b_driver_mcp9808_shm.c
+ * @brief     driver mcp9808 shm source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-01-25
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/01/25  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "raspberrypi4b_driver_mcp9808_shm.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * @brief     shared memory copy one sample
+ * @param[in] *dst pointer to a destination sample
+ * @param[in] *src pointer to a source sample
+ * @note      volatile fields are copied one by one
+ */
+static void a_mcp9808_shm_copy(volatile mcp9808_shm_sample_t *dst, const volatile mcp9808_shm_sample_t *src)
+{
+    dst->sequence = src->sequence;
+    dst->time_us = src->time_us;
+    dst->temperature_mc = src->temperature_mc;
+    dst->raw = src->raw;
+    dst->flags = src->flags;
+    dst->bus = src->bus;
+    dst->addr = src->addr;
+}
+
+/**
+ * @brief     shared memory create the table
+ * @param[in] *shm pointer to a shared memory handle structure
+ * @param[in] *name pointer to a segment name
+ * @return    status code
+ *            - 0 success
+ *            - 1 create failed
+ * @note      only one writer process may create the table
+ */
+uint8_t mcp9808_shm_create(mcp9808_shm_t *shm, const char *name)
+{
+    void *addr;
+    
+    /* create the segment */
+    (void)strncpy(shm->name, name, sizeof(shm->name) - 1);
+    shm->name[sizeof(shm->name) - 1] = '\0';
+    shm->fd = shm_open(shm->name, O_CREAT | O_RDWR, 0644);
+    if (shm->fd < 0)
+    {
+        perror("mcp9808: shm open failed.\n");
+        
+        return 1;
+    }
+    if (ftruncate(shm->fd, sizeof(mcp9808_shm_table_t)) != 0)
+    {
+        perror("mcp9808: shm truncate failed.\n");
+        (void)close(shm->fd);
+        (void)shm_unlink(shm->name);
+        
+        return 1;
+    }
+    
+    /* map the table */
+    addr = mmap(NULL, sizeof(mcp9808_shm_table_t), PROT_READ | PROT_WRITE, MAP_SHARED, shm->fd, 0);
+    if (addr == MAP_FAILED)
+    {
+        perror("mcp9808: shm map failed.\n");
+        (void)close(shm->fd);
+        (void)shm_unlink(shm->name);
+        
+        return 1;
+    }
+    shm->table = (mcp9808_shm_table_t *)addr;
+    shm->writer = 1;
+    
+    /* publish an empty table, the magic is written last */
+    memset(shm->table, 0, sizeof(mcp9808_shm_table_t));
+    shm->table->version = MCP9808_SHM_VERSION;
+    shm->table->slot_num = MCP9808_SHM_MAX_SLOT;
+    MCP9808_QUEUE_BARRIER();
+    shm->table->magic = MCP9808_SHM_MAGIC;
+    
+    return 0;
+}
+
+/**
+ * @brief     shared memory open the table
+ * @param[in] *shm pointer to a shared memory handle structure
+ * @param[in] *name pointer to a segment name
+ * @return    status code
+ *            - 0 success
+ *            - 1 open failed
+ * @note      the table is mapped read only
+ */
+uint8_t mcp9808_shm_open(mcp9808_shm_t *shm, const char *name)
+{
+    void *addr;
+    struct stat st;
+    
+    /* open the segment */
+    (void)strncpy(shm->name, name, sizeof(shm->name) - 1);
+    shm->name[sizeof(shm->name) - 1] = '\0';
+    shm->fd = shm_open(shm->name, O_RDONLY, 0);
+    if (shm->fd < 0)
+    {
+        perror("mcp9808: shm open failed.\n");
+        
+        return 1;
+    }
+    if ((fstat(shm->fd, &st) != 0) || (st.st_size < (off_t)sizeof(mcp9808_shm_table_t)))
+    {
+        mcp9808_interface_debug_print("mcp9808: shm size is invalid.\n");
+        (void)close(shm->fd);
+        
+        return 1;
+    }
+    
+    /* map the table */
+    addr = mmap(NULL, sizeof(mcp9808_shm_table_t), PROT_READ, MAP_SHARED, shm->fd, 0);
+    if (addr == MAP_FAILED)
+    {
+        perror("mcp9808: shm map failed.\n");
+        (void)close(shm->fd);
+        
+        return 1;
+    }
+    shm->table = (mcp9808_shm_table_t *)addr;
+    shm->writer = 0;
+    
+    /* check the layout */
+    if ((shm->table->magic != MCP9808_SHM_MAGIC) || (shm->table->version != MCP9808_SHM_VERSION))
+    {
+        mcp9808_interface_debug_print("mcp9808: shm table is invalid.\n");
+        (void)munmap(shm->table, sizeof(mcp9808_shm_table_t));
+        (void)close(shm->fd);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     shared memory close the table
+ * @param[in] *shm pointer to a shared memory handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 close failed
+ * @note      the writer also removes the segment name
+ */
+uint8_t mcp9808_shm_close(mcp9808_shm_t *shm)
+{
+    uint8_t res = 0;
+    
+    if (munmap(shm->table, sizeof(mcp9808_shm_table_t)) != 0)
+    {
+        res = 1;
+    }
+    if (close(shm->fd) != 0)
+    {
+        res = 1;
+    }
+    if ((shm->writer != 0) && (shm_unlink(shm->name) != 0))
+    {
+        res = 1;
+    }
+    shm->table = NULL;
+    
+    return res;
+}
+
+/**
+ * @brief     shared memory write one slot
+ * @param[in] *shm pointer to a shared memory handle structure
+ * @param[in] index slot index
+ * @param[in] *sample pointer to a sample structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      sequence is set by the writer
+ */
+uint8_t mcp9808_shm_write(mcp9808_shm_t *shm, uint8_t index, const mcp9808_shm_sample_t *sample)
+{
+    mcp9808_shm_slot_t *slot;
+    uint32_t sequence;
+    
+    if ((shm->writer == 0) || (index >= MCP9808_SHM_MAX_SLOT))
+    {
+        return 1;
+    }
+    slot = &shm->table->slot[index];
+    sequence = slot->sample.sequence + 1;
+    
+    /* odd lock while the slot is updated */
+    slot->lock++;
+    MCP9808_QUEUE_BARRIER();
+    a_mcp9808_shm_copy(&slot->sample, sample);
+    slot->sample.sequence = sequence;
+    MCP9808_QUEUE_BARRIER();
+    slot->lock++;
+    
+    return 0;
+}
+
+/**
+ * @brief      shared memory read one slot
+ * @param[in]  *shm pointer to a shared memory handle structure
+ * @param[in]  index slot index
+ * @param[out] *sample pointer to a sample structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 4 slot is busy
+ * @note       the read never blocks, it gives up after MCP9808_SHM_READ_RETRY torn copies
+ */
+uint8_t mcp9808_shm_read(mcp9808_shm_t *shm, uint8_t index, mcp9808_shm_sample_t *sample)
+{
+    uint32_t i;
+    uint32_t begin;
+    uint32_t end;
+    const mcp9808_shm_slot_t *slot;
+    
+    if (index >= MCP9808_SHM_MAX_SLOT)
+    {
+        return 1;
+    }
+    slot = &shm->table->slot[index];
+    for (i = 0; i < MCP9808_SHM_READ_RETRY; i++)
+    {
+        /* skip the copy while the writer holds the slot */
+        begin = slot->lock;
+        if ((begin & 1) != 0)
+        {
+            continue;
+        }
+        MCP9808_QUEUE_BARRIER();
+        a_mcp9808_shm_copy(sample, &slot->sample);
+        MCP9808_QUEUE_BARRIER();
+        end = slot->lock;
+        
+        /* the copy is consistent if no write started meanwhile */
+        if (begin == end)
+        {
+            return 0;
+        }
+    }
+    
+    return 4;
+}
+
+/**
+ * @brief     shared memory get the slot index
+ * @param[in] bus_index engine bus index
+ * @param[in] addr iic device address
+ * @return    slot index
+ * @note      none
+ */
+uint8_t mcp9808_shm_slot_index(uint8_t bus_index, uint8_t addr)
+{
+    return (uint8_t)(bus_index * MCP9808_ENGINE_MAX_DEVICE + (((addr >> 1) - (MCP9808_ADDRESS_A2A1A0_000 >> 1)) & 0x07));
+}
@@ -51,6 +51,66 @@
  * @{
  */
 
+/**
+ * @brief gpio event loop definition
+ */
+#define GPIO_LOOP_MAX_SOURCE        8         /**< max line and timer number */
+#define GPIO_LOOP_MAX_LINE_EVENT    16        /**< max line events read at once */
+
+/**
+ * @brief gpio line handler type definition
+ * @note  timestamp_ns is the kernel timestamp of the edge
+ */
+typedef void (*gpio_line_handler_t)(void *arg, uint32_t line, uint64_t timestamp_ns);
+
+/**
+ * @brief gpio timer handler type definition
+ * @note  expirations is the elapsed period number since the last call
+ */
+typedef void (*gpio_timer_handler_t)(void *arg, uint64_t expirations);
+
+/**
+ * @brief  gpio event loop init
+ * @return status code
+ *         - 0 success
+ *         - 1 init failed
+ * @note   the loop thread waits on one epoll set for all lines, timers and the shutdown event
+ */
+uint8_t gpio_loop_init(void);
+
+/**
+ * @brief  gpio event loop deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   the loop thread finishes the running handler before it exits
+ */
+uint8_t gpio_loop_deinit(void);
+
+/**
+ * @brief     gpio event loop add a falling edge line
+ * @param[in] line gpio line offset
+ * @param[in] handler pointer to a line handler
+ * @param[in] *arg pointer to a handler argument
+ * @return    status code
+ *            - 0 success
+ *            - 1 add failed
+ * @note      sources are added from one thread only
+ */
+uint8_t gpio_loop_add_line(uint32_t line, gpio_line_handler_t handler, void *arg);
+
+/**
+ * @brief     gpio event loop add a periodic timer
+ * @param[in] period_us timer period in us
+ * @param[in] handler pointer to a timer handler
+ * @param[in] *arg pointer to a handler argument
+ * @return    status code
+ *            - 0 success
+ *            - 1 add failed
+ * @note      sources are added from one thread only
+ */
+uint8_t gpio_loop_add_timer(uint32_t period_us, gpio_timer_handler_t handler, void *arg);
+
 /**
  * @brief  gpio interrupt init
  * @return status code
@@ -42,6 +42,9 @@
 #include <stdint.h>
 #include <stdio.h>
 #include <string.h>
+#include <pthread.h>
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -53,6 +56,24 @@ extern "C" {
  * @{
  */
 
+/**
+ * @brief iic context scratch definition
+ */
+#define IIC_CONTEXT_SCRATCH_SIZE 32        /**< max copied write length */
+
+/**
+ * @brief iic context structure definition
+ */
+typedef struct iic_context_s
+{
+    int fd;                                                 /**< iic handle */
+    uint8_t nostart;                                        /**< adapter supports I2C_M_NOSTART */
+    struct i2c_msg msgs[2];                                 /**< reused messages */
+    struct i2c_rdwr_ioctl_data data;                        /**< reused ioctl data */
+    uint8_t scratch[IIC_CONTEXT_SCRATCH_SIZE + 1];          /**< register byte and copied data */
+    pthread_mutex_t mutex;                                  /**< guards the reused messages and scratch */
+} iic_context_t;
+
 /**
  * @brief      iic bus init
  * @param[in]  *name pointer to an iic device name buffer
@@ -115,6 +136,22 @@ uint8_t iic_read(int fd, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);
  */
 uint8_t iic_read_address16(int fd, uint8_t addr, uint16_t reg, uint8_t *buf, uint16_t len);
 
+/**
+ * @brief      iic bus read from many devices in one transfer
+ * @param[in]  fd iic handle
+ * @param[in]  *addr pointer to an iic device write address array
+ * @param[in]  *reg pointer to an iic register address array
+ * @param[out] *buf pointer to a data buffer, len bytes per device
+ * @param[in]  len data length of one device
+ * @param[in]  num device number
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       addr = device_address_7bits << 1,
+ *             up to IIC_BATCH_MAX_MSGS / 2 reads share one I2C_RDWR ioctl
+ */
+uint8_t iic_read_batch(int fd, uint8_t *addr, uint8_t *reg, uint8_t *buf, uint16_t len, uint16_t num);
+
 /**
  * @brief     iic bus write command
  * @param[in] fd iic handle
@@ -156,6 +193,59 @@ uint8_t iic_write(int fd, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
  */
 uint8_t iic_write_address16(int fd, uint8_t addr, uint16_t reg, uint8_t *buf, uint16_t len);
 
+/**
+ * @brief      iic context init
+ * @param[out] *ctx pointer to an iic context structure
+ * @param[in]  fd iic handle
+ * @return     status code
+ *             - 0 success
+ *             - 1 init failed
+ * @note       the constant message fields are set once here
+ */
+uint8_t iic_context_init(iic_context_t *ctx, int fd);
+
+/**
+ * @brief     iic context deinit
+ * @param[in] *ctx pointer to an iic context structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      the iic handle is not closed
+ */
+uint8_t iic_context_deinit(iic_context_t *ctx);
+
+/**
+ * @brief      iic context read
+ * @param[in]  *ctx pointer to an iic context structure
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       addr = device_address_7bits << 1,
+ *             calls on one context from many threads are serialized by the context mutex
+ */
+uint8_t iic_context_read(iic_context_t *ctx, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief     iic context write
+ * @param[in] *ctx pointer to an iic context structure
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      addr = device_address_7bits << 1,
+ *            the register byte and the data are sent as two segments of one message,
+ *            adapters without I2C_FUNC_NOSTART copy up to IIC_CONTEXT_SCRATCH_SIZE bytes,
+ *            calls on one context from many threads are serialized by the context mutex
+ */
+uint8_t iic_context_write(iic_context_t *ctx, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);
+
 /**
  * @}
  */
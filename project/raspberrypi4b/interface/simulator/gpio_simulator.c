@@ -0,0 +1,86 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      gpio_simulator.c
+ * @brief     gpio simulator source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-01-25
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/01/25  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "gpio.h"
+#include "driver_mcp9808_simulator.h"
+
+extern uint8_t (*g_gpio_irq)(void);        /**< gpio irq */
+
+/**
+ * @brief     gpio simulated alert line handler
+ * @param[in] bus bus index
+ * @param[in] addr iic device write address
+ * @param[in] level alert pin level
+ * @note      the falling edge of any simulated alert pin runs the irq
+ */
+static void a_gpio_simulator_alert(uint8_t bus, uint8_t addr, uint8_t level)
+{
+    (void)bus;
+    (void)addr;
+    
+    /* check the falling edge and the g_gpio_irq */
+    if ((level == 0) && (g_gpio_irq != NULL))
+    {
+        /* run the callback */
+        g_gpio_irq();
+    }
+}
+
+/**
+ * @brief  gpio interrupt init
+ * @return status code
+ *         - 0 success
+ * @note   the simulated alert pins replace the gpio line, the irq runs inside the simulated transfer or delay
+ */
+uint8_t gpio_interrupt_init(void)
+{
+    mcp9808_simulator_set_alert_callback(a_gpio_simulator_alert);
+    
+    return 0;
+}
+
+/**
+ * @brief  gpio interrupt deinit
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+uint8_t gpio_interrupt_deinit(void)
+{
+    mcp9808_simulator_set_alert_callback(NULL);
+    
+    return 0;
+}
@@ -37,6 +37,10 @@
 #include "gpio.h"
 #include <gpiod.h>
 #include <pthread.h>
+#include <errno.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
 
 /**
  * @brief gpio device name definition
@@ -48,132 +52,448 @@
  */
 #define GPIO_DEVICE_LINE 17                      /**< gpio device line */
 
+/**
+ * @brief gpio source type definition
+ */
+#define GPIO_SOURCE_LINE  0                      /**< line source */
+#define GPIO_SOURCE_TIMER 1                      /**< timer source */
+
+/**
+ * @brief gpio source structure definition
+ */
+typedef struct gpio_source_s
+{
+    uint8_t type;                                /**< source type */
+    int fd;                                      /**< source fd */
+    uint32_t line_offset;                        /**< gpio line offset */
+    struct gpiod_line *line;                     /**< gpio line handle */
+    gpio_line_handler_t line_handler;            /**< line handler */
+    gpio_timer_handler_t timer_handler;          /**< timer handler */
+    void *arg;                                   /**< handler argument */
+} gpio_source_t;
+
 /**
  * @brief global var definition
  */
-static struct gpiod_chip *gs_chip;        /**< gpio chip handle */
-static struct gpiod_line *gs_line;        /**< gpio line handle */
-static pthread_t gs_pid;                  /**< gpio pthread pid */
-extern uint8_t (*g_gpio_irq)(void);       /**< gpio irq */
+static struct gpiod_chip *gs_chip;                        /**< gpio chip handle */
+static pthread_t gs_pid;                                  /**< gpio pthread pid */
+static int gs_epoll_fd = -1;                              /**< epoll handle */
+static int gs_stop_fd = -1;                               /**< shutdown event handle */
+static gpio_source_t gs_source[GPIO_LOOP_MAX_SOURCE];     /**< event sources */
+static uint8_t gs_source_num;                             /**< event source number */
+extern uint8_t (*g_gpio_irq)(void);                       /**< gpio irq */
+
+/**
+ * @brief     gpio line dispatch
+ * @param[in] *source pointer to a source structure
+ * @note      all pending edges are read at once
+ */
+static void a_gpio_line_dispatch(gpio_source_t *source)
+{
+    int i;
+    int num;
+    struct gpiod_line_event event[GPIO_LOOP_MAX_LINE_EVENT];
+    
+    /* read all pending events */
+    num = gpiod_line_event_read_multiple(source->line, event, GPIO_LOOP_MAX_LINE_EVENT);
+    for (i = 0; i < num; i++)
+    {
+        /* if the falling edge */
+        if (event[i].event_type == GPIOD_LINE_EVENT_FALLING_EDGE)
+        {
+            /* run the handler with the kernel timestamp */
+            source->line_handler(source->arg, source->line_offset,
+                                 (uint64_t)event[i].ts.tv_sec * 1000000000ULL + (uint64_t)event[i].ts.tv_nsec);
+        }
+    }
+}
 
 /**
- * @brief  gpio interrupt pthread
+ * @brief     gpio timer dispatch
+ * @param[in] *source pointer to a source structure
+ * @note      none
+ */
+static void a_gpio_timer_dispatch(gpio_source_t *source)
+{
+    uint64_t expirations;
+    
+    /* read the expiration number */
+    if (read(source->fd, &expirations, sizeof(expirations)) == (ssize_t)sizeof(expirations))
+    {
+        /* run the handler */
+        source->timer_handler(source->arg, expirations);
+    }
+}
+
+/**
+ * @brief  gpio event loop pthread
  * @param  *p pointer to an args buffer
  * @return NULL
  * @note   none
  */
-static void *a_gpio_interrupt_pthread(void *p)
+static void *a_gpio_loop_pthread(void *p)
 {
-    int res;
-    struct gpiod_line_event event;
+    int i;
+    int num;
+    struct epoll_event event[GPIO_LOOP_MAX_SOURCE + 1];
+    
+    (void)p;
     
-    /* enable catching cancel signal */
-    pthread_setcancelstate(PTHREAD_CANCEL_ENABLE, NULL);
-
-    /* cancel the pthread at once */
-    pthread_setcanceltype(PTHREAD_CANCEL_ASYNCHRONOUS, NULL);
-
     /* loop */
     while (1)
     {
-        /* wait for the event */
-        res = gpiod_line_event_wait(gs_line, NULL);
-        if (res == 1)
+        /* wait for any source */
+        num = epoll_wait(gs_epoll_fd, event, GPIO_LOOP_MAX_SOURCE + 1, -1);
+        if (num < 0)
         {
-            /* read the event */
-            if (gpiod_line_event_read(gs_line, &event) != 0)
+            if (errno == EINTR)
             {
                 continue;
             }
-
-            /* if the falling edge */
-            if (event.event_type == GPIOD_LINE_EVENT_FALLING_EDGE)
+            perror("gpio: epoll wait failed.\n");
+            
+            return NULL;
+        }
+        
+        /* the shutdown event has no source */
+        for (i = 0; i < num; i++)
+        {
+            if (event[i].data.ptr == NULL)
             {
-                /* check the g_gpio_irq */
-                if (g_gpio_irq != NULL)
-                {
-                    /* run the callback */
-                    g_gpio_irq();
-                }
+                return NULL;
+            }
+        }
+        
+        /* dispatch */
+        for (i = 0; i < num; i++)
+        {
+            gpio_source_t *source = (gpio_source_t *)event[i].data.ptr;
+            
+            if (source->type == GPIO_SOURCE_LINE)
+            {
+                a_gpio_line_dispatch(source);
+            }
+            else
+            {
+                a_gpio_timer_dispatch(source);
             }
         }
     }
 }
 
 /**
- * @brief  gpio interrupt init
+ * @brief     gpio event loop add a source fd
+ * @param[in] *source pointer to a source structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 add failed
+ * @note      none
+ */
+static uint8_t a_gpio_loop_add(gpio_source_t *source)
+{
+    struct epoll_event event;
+    
+    /* the source is complete before the loop can see it */
+    event.events = EPOLLIN;
+    event.data.ptr = source;
+    if (epoll_ctl(gs_epoll_fd, EPOLL_CTL_ADD, source->fd, &event) != 0)
+    {
+        perror("gpio: epoll add failed.\n");
+        
+        return 1;
+    }
+    gs_source_num++;
+    
+    return 0;
+}
+
+/**
+ * @brief  gpio event loop init
  * @return status code
  *         - 0 success
  *         - 1 init failed
- * @note   none
+ * @note   the loop thread waits on one epoll set for all lines, timers and the shutdown event
  */
-uint8_t gpio_interrupt_init(void)
+uint8_t gpio_loop_init(void)
 {
-    uint8_t res;
+    struct epoll_event event;
     
     /* open the gpio group */
     gs_chip = gpiod_chip_open(GPIO_DEVICE_NAME);
     if (gs_chip == NULL)
     {
         perror("gpio: open failed.\n");
-
+        
         return 1;
     }
     
-    /* get the gpio line */
-    gs_line = gpiod_chip_get_line(gs_chip, GPIO_DEVICE_LINE);
-    if (gs_line == NULL) 
+    /* create the epoll set */
+    gs_epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    if (gs_epoll_fd < 0)
     {
-        perror("gpio: get line failed.\n");
+        perror("gpio: epoll create failed.\n");
         gpiod_chip_close(gs_chip);
-
+        
         return 1;
     }
-
-    /* catch the falling edge */
-    if (gpiod_line_request_falling_edge_events(gs_line, "gpiointerrupt") < 0)
+    
+    /* create the shutdown event */
+    gs_stop_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (gs_stop_fd < 0)
     {
-        perror("gpio: set edge events failed.\n");
+        perror("gpio: eventfd create failed.\n");
+        (void)close(gs_epoll_fd);
         gpiod_chip_close(gs_chip);
-
+        
         return 1;
     }
-
-    /* creat a gpio interrupt pthread */
-    res = pthread_create(&gs_pid, NULL, a_gpio_interrupt_pthread, NULL);
-    if (res != 0)
+    event.events = EPOLLIN;
+    event.data.ptr = NULL;
+    if (epoll_ctl(gs_epoll_fd, EPOLL_CTL_ADD, gs_stop_fd, &event) != 0)
+    {
+        perror("gpio: epoll add failed.\n");
+        (void)close(gs_stop_fd);
+        (void)close(gs_epoll_fd);
+        gpiod_chip_close(gs_chip);
+        
+        return 1;
+    }
+    gs_source_num = 0;
+    
+    /* creat the event loop pthread */
+    if (pthread_create(&gs_pid, NULL, a_gpio_loop_pthread, NULL) != 0)
     {
         perror("gpio: creat pthread failed.\n");
+        (void)close(gs_stop_fd);
+        (void)close(gs_epoll_fd);
         gpiod_chip_close(gs_chip);
-
+        
         return 1;
     }
-
+    
     return 0;
 }
 
 /**
- * @brief  gpio interrupt deinit
+ * @brief  gpio event loop deinit
  * @return status code
  *         - 0 success
  *         - 1 deinit failed
- * @note   none
+ * @note   the loop thread finishes the running handler before it exits
  */
-uint8_t gpio_interrupt_deinit(void)
+uint8_t gpio_loop_deinit(void)
 {
-    uint8_t res;
+    uint8_t i;
+    uint64_t value = 1;
     
-    /* close the gpio interrupt pthread */
-    res = pthread_cancel(gs_pid);
-    if (res != 0)
+    /* wake the loop */
+    if (write(gs_stop_fd, &value, sizeof(value)) != (ssize_t)sizeof(value))
     {
-        perror("gpio: delete pthread failed.\n");
-
+        perror("gpio: wake pthread failed.\n");
+        
         return 1;
     }
-
+    
+    /* wait for the loop */
+    if (pthread_join(gs_pid, NULL) != 0)
+    {
+        perror("gpio: join pthread failed.\n");
+        
+        return 1;
+    }
+    
+    /* close all sources */
+    for (i = 0; i < gs_source_num; i++)
+    {
+        if (gs_source[i].type == GPIO_SOURCE_LINE)
+        {
+            gpiod_line_release(gs_source[i].line);
+        }
+        else
+        {
+            (void)close(gs_source[i].fd);
+        }
+    }
+    gs_source_num = 0;
+    (void)close(gs_stop_fd);
+    (void)close(gs_epoll_fd);
+    gs_stop_fd = -1;
+    gs_epoll_fd = -1;
+    
     /* close the gpio */
     gpiod_chip_close(gs_chip);
     
     return 0;
 }
+
+/**
+ * @brief     gpio event loop add a falling edge line
+ * @param[in] line gpio line offset
+ * @param[in] handler pointer to a line handler
+ * @param[in] *arg pointer to a handler argument
+ * @return    status code
+ *            - 0 success
+ *            - 1 add failed
+ * @note      sources are added from one thread only
+ */
+uint8_t gpio_loop_add_line(uint32_t line, gpio_line_handler_t handler, void *arg)
+{
+    gpio_source_t *source;
+    
+    /* check the table */
+    if ((handler == NULL) || (gs_source_num >= GPIO_LOOP_MAX_SOURCE))
+    {
+        perror("gpio: add line failed.\n");
+        
+        return 1;
+    }
+    source = &gs_source[gs_source_num];
+    
+    /* get the gpio line */
+    source->line = gpiod_chip_get_line(gs_chip, line);
+    if (source->line == NULL)
+    {
+        perror("gpio: get line failed.\n");
+        
+        return 1;
+    }
+    
+    /* catch the falling edge */
+    if (gpiod_line_request_falling_edge_events(source->line, "gpiointerrupt") < 0)
+    {
+        perror("gpio: set edge events failed.\n");
+        
+        return 1;
+    }
+    source->type = GPIO_SOURCE_LINE;
+    source->fd = gpiod_line_event_get_fd(source->line);
+    source->line_offset = line;
+    source->line_handler = handler;
+    source->timer_handler = NULL;
+    source->arg = arg;
+    if (a_gpio_loop_add(source) != 0)
+    {
+        gpiod_line_release(source->line);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     gpio event loop add a periodic timer
+ * @param[in] period_us timer period in us
+ * @param[in] handler pointer to a timer handler
+ * @param[in] *arg pointer to a handler argument
+ * @return    status code
+ *            - 0 success
+ *            - 1 add failed
+ * @note      sources are added from one thread only
+ */
+uint8_t gpio_loop_add_timer(uint32_t period_us, gpio_timer_handler_t handler, void *arg)
+{
+    gpio_source_t *source;
+    struct itimerspec spec;
+    
+    /* check the table */
+    if ((handler == NULL) || (period_us == 0) || (gs_source_num >= GPIO_LOOP_MAX_SOURCE))
+    {
+        perror("gpio: add timer failed.\n");
+        
+        return 1;
+    }
+    source = &gs_source[gs_source_num];
+    
+    /* create the timer */
+    source->fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    if (source->fd < 0)
+    {
+        perror("gpio: timerfd create failed.\n");
+        
+        return 1;
+    }
+    spec.it_interval.tv_sec = period_us / 1000000;
+    spec.it_interval.tv_nsec = (long)(period_us % 1000000) * 1000L;
+    spec.it_value = spec.it_interval;
+    if (timerfd_settime(source->fd, 0, &spec, NULL) != 0)
+    {
+        perror("gpio: timerfd set failed.\n");
+        (void)close(source->fd);
+        
+        return 1;
+    }
+    source->type = GPIO_SOURCE_TIMER;
+    source->line_offset = 0;
+    source->line = NULL;
+    source->line_handler = NULL;
+    source->timer_handler = handler;
+    source->arg = arg;
+    if (a_gpio_loop_add(source) != 0)
+    {
+        (void)close(source->fd);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     gpio interrupt handler
+ * @param[in] *arg pointer to a handler argument
+ * @param[in] line gpio line offset
+ * @param[in] timestamp_ns kernel timestamp of the edge
+ * @note      none
+ */
+static void a_gpio_interrupt_handler(void *arg, uint32_t line, uint64_t timestamp_ns)
+{
+    (void)arg;
+    (void)line;
+    (void)timestamp_ns;
+    
+    /* check the g_gpio_irq */
+    if (g_gpio_irq != NULL)
+    {
+        /* run the callback */
+        g_gpio_irq();
+    }
+}
+
+/**
+ * @brief  gpio interrupt init
+ * @return status code
+ *         - 0 success
+ *         - 1 init failed
+ * @note   none
+ */
+uint8_t gpio_interrupt_init(void)
+{
+    /* start the event loop */
+    if (gpio_loop_init() != 0)
+    {
+        return 1;
+    }
+    
+    /* watch the alert line */
+    if (gpio_loop_add_line(GPIO_DEVICE_LINE, a_gpio_interrupt_handler, NULL) != 0)
+    {
+        (void)gpio_loop_deinit();
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  gpio interrupt deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t gpio_interrupt_deinit(void)
+{
+    return gpio_loop_deinit();
+}
@@ -40,6 +40,16 @@
 #include <sys/ioctl.h>
 #include <fcntl.h>
 
+/**
+ * @brief iic batch definition
+ */
+#define IIC_BATCH_MAX_MSGS 42        /**< I2C_RDWR_IOCTL_MAX_MSGS */
+
+/**
+ * @brief iic write stack buffer definition
+ */
+#define IIC_WRITE_STACK_SIZE 32      /**< longer writes use the heap */
+
 /**
  * @brief      iic bus init
  * @param[in]  *name pointer to an iic device name buffer
@@ -226,6 +236,63 @@ uint8_t iic_read_address16(int fd, uint8_t addr, uint16_t reg, uint8_t *buf, uin
     return 0;
 }
 
+/**
+ * @brief      iic bus read from many devices in one transfer
+ * @param[in]  fd iic handle
+ * @param[in]  *addr pointer to an iic device write address array
+ * @param[in]  *reg pointer to an iic register address array
+ * @param[out] *buf pointer to a data buffer, len bytes per device
+ * @param[in]  len data length of one device
+ * @param[in]  num device number
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       addr = device_address_7bits << 1,
+ *             up to IIC_BATCH_MAX_MSGS / 2 reads share one I2C_RDWR ioctl
+ */
+uint8_t iic_read_batch(int fd, uint8_t *addr, uint8_t *reg, uint8_t *buf, uint16_t len, uint16_t num)
+{
+    struct i2c_rdwr_ioctl_data i2c_rdwr_data;
+    struct i2c_msg msgs[IIC_BATCH_MAX_MSGS];
+    uint16_t i;
+    uint16_t n;
+    
+    while (num != 0)
+    {
+        /* fill one ioctl */
+        n = (num > (IIC_BATCH_MAX_MSGS / 2)) ? (IIC_BATCH_MAX_MSGS / 2) : num;
+        for (i = 0; i < n; i++)
+        {
+            msgs[i * 2 + 0].addr = addr[i] >> 1;
+            msgs[i * 2 + 0].flags = 0;
+            msgs[i * 2 + 0].buf = &reg[i];
+            msgs[i * 2 + 0].len = 1;
+            msgs[i * 2 + 1].addr = addr[i] >> 1;
+            msgs[i * 2 + 1].flags = I2C_M_RD;
+            msgs[i * 2 + 1].buf = &buf[i * len];
+            msgs[i * 2 + 1].len = len;
+        }
+        i2c_rdwr_data.msgs = msgs;
+        i2c_rdwr_data.nmsgs = n * 2;
+        
+        /* transmit */
+        if (ioctl(fd, I2C_RDWR, &i2c_rdwr_data) < 0)
+        {
+            perror("iic: read batch failed.\n");
+            
+            return 1;
+        }
+        
+        /* next devices */
+        addr += n;
+        reg += n;
+        buf += n * len;
+        num -= n;
+    }
+     
+    return 0;
+}
+
 /**
  * @brief     iic bus write command
  * @param[in] fd iic handle
@@ -283,16 +350,18 @@ uint8_t iic_write(int fd, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
 {
     struct i2c_rdwr_ioctl_data i2c_rdwr_data;
     struct i2c_msg msgs[1];
-    uint8_t buf_send[len + 1];
+    uint8_t buf_stack[IIC_WRITE_STACK_SIZE + 1];
+    uint8_t *buf_send;
+    uint8_t res;
     
-    /* clear ioctl data */
-    memset(&i2c_rdwr_data, 0, sizeof(struct i2c_rdwr_ioctl_data));
-    
-    /* clear msgs data */
-    memset(msgs, 0, sizeof(struct i2c_msg) * 1);
-    
-    /* clear sent buf */
-    memset(buf_send, 0, sizeof(uint8_t) * (len + 1));
+    /* get the sent buf */
+    buf_send = (len <= IIC_WRITE_STACK_SIZE) ? buf_stack : (uint8_t *)malloc(len + 1);
+    if (buf_send == NULL)
+    {
+        perror("iic: malloc failed.\n");
+        
+        return 1;
+    }
     
     /* set the param */
     msgs[0].addr = addr >> 1;
@@ -305,14 +374,20 @@ uint8_t iic_write(int fd, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
     i2c_rdwr_data.nmsgs = 1;
     
     /* transmit */
+    res = 0;
     if (ioctl(fd, I2C_RDWR, &i2c_rdwr_data) < 0)
     {
         perror("iic: write failed.\n");
-        
-        return 1;
+        res = 1;
+    }
+    
+    /* free the sent buf */
+    if (buf_send != buf_stack)
+    {
+        free(buf_send);
     }
      
-    return 0;
+    return res;
 }
 
 /**
@@ -331,16 +406,18 @@ uint8_t iic_write_address16(int fd, uint8_t addr, uint16_t reg, uint8_t *buf, ui
 {
     struct i2c_rdwr_ioctl_data i2c_rdwr_data;
     struct i2c_msg msgs[1];
-    uint8_t buf_send[len + 2];
-    
-    /* clear ioctl data */
-    memset(&i2c_rdwr_data, 0, sizeof(struct i2c_rdwr_ioctl_data));
-    
-    /* clear msgs data */
-    memset(msgs, 0, sizeof(struct i2c_msg) * 1);
+    uint8_t buf_stack[IIC_WRITE_STACK_SIZE + 2];
+    uint8_t *buf_send;
+    uint8_t res;
     
-    /* clear sent buf */
-    memset(buf_send, 0, sizeof(uint8_t) * (len + 2));
+    /* get the sent buf */
+    buf_send = (len <= IIC_WRITE_STACK_SIZE) ? buf_stack : (uint8_t *)malloc(len + 2);
+    if (buf_send == NULL)
+    {
+        perror("iic: malloc failed.\n");
+        
+        return 1;
+    }
     
     /* set the param */
     msgs[0].addr = addr >> 1;
@@ -354,12 +431,186 @@ uint8_t iic_write_address16(int fd, uint8_t addr, uint16_t reg, uint8_t *buf, ui
     i2c_rdwr_data.nmsgs = 1;
     
     /* transmit */
+    res = 0;
     if (ioctl(fd, I2C_RDWR, &i2c_rdwr_data) < 0)
     {
         perror("iic: write failed.\n");
+        res = 1;
+    }
+    
+    /* free the sent buf */
+    if (buf_send != buf_stack)
+    {
+        free(buf_send);
+    }
+     
+    return res;
+}
+
+/**
+ * @brief      iic context init
+ * @param[out] *ctx pointer to an iic context structure
+ * @param[in]  fd iic handle
+ * @return     status code
+ *             - 0 success
+ *             - 1 init failed
+ * @note       the constant message fields are set once here
+ */
+uint8_t iic_context_init(iic_context_t *ctx, int fd)
+{
+    unsigned long funcs;
+    
+    /* check the adapter */
+    if (ioctl(fd, I2C_FUNCS, &funcs) < 0)
+    {
+        perror("iic: get funcs failed.\n");
         
         return 1;
     }
-     
+    
+    /* init the mutex */
+    if (pthread_mutex_init(&ctx->mutex, NULL) != 0)
+    {
+        perror("iic: init mutex failed.\n");
+        
+        return 1;
+    }
+    
+    /* set the param */
+    ctx->fd = fd;
+    ctx->nostart = ((funcs & I2C_FUNC_NOSTART) != 0) ? 1 : 0;
+    ctx->msgs[0].flags = 0;
+    ctx->msgs[0].len = 1;
+    ctx->msgs[0].buf = &ctx->scratch[0];
+    ctx->msgs[1].flags = 0;
+    ctx->data.msgs = ctx->msgs;
+    ctx->data.nmsgs = 0;
+    
+    return 0;
+}
+
+/**
+ * @brief     iic context deinit
+ * @param[in] *ctx pointer to an iic context structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      the iic handle is not closed
+ */
+uint8_t iic_context_deinit(iic_context_t *ctx)
+{
+    /* destroy the mutex */
+    if (pthread_mutex_destroy(&ctx->mutex) != 0)
+    {
+        perror("iic: destroy mutex failed.\n");
+        
+        return 1;
+    }
+    
     return 0;
 }
+
+/**
+ * @brief      iic context read
+ * @param[in]  *ctx pointer to an iic context structure
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       addr = device_address_7bits << 1,
+ *             calls on one context from many threads are serialized by the context mutex
+ */
+uint8_t iic_context_read(iic_context_t *ctx, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    uint8_t res;
+    
+    /* lock the context */
+    (void)pthread_mutex_lock(&ctx->mutex);
+    
+    /* set the param */
+    ctx->scratch[0] = reg;
+    ctx->msgs[0].addr = addr >> 1;
+    ctx->msgs[0].len = 1;
+    ctx->msgs[1].addr = addr >> 1;
+    ctx->msgs[1].flags = I2C_M_RD;
+    ctx->msgs[1].buf = buf;
+    ctx->msgs[1].len = len;
+    ctx->data.nmsgs = 2;
+    
+    /* transmit */
+    res = 0;
+    if (ioctl(ctx->fd, I2C_RDWR, &ctx->data) < 0)
+    {
+        perror("iic: read failed.\n");
+        res = 1;
+    }
+    
+    /* unlock the context */
+    (void)pthread_mutex_unlock(&ctx->mutex);
+    
+    return res;
+}
+
+/**
+ * @brief     iic context write
+ * @param[in] *ctx pointer to an iic context structure
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      addr = device_address_7bits << 1,
+ *            the register byte and the data are sent as two segments of one message,
+ *            adapters without I2C_FUNC_NOSTART copy up to IIC_CONTEXT_SCRATCH_SIZE bytes,
+ *            calls on one context from many threads are serialized by the context mutex
+ */
+uint8_t iic_context_write(iic_context_t *ctx, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    uint8_t res;
+    
+    /* check the length */
+    if ((ctx->nostart == 0) && (len > IIC_CONTEXT_SCRATCH_SIZE))
+    {
+        return iic_write(ctx->fd, addr, reg, buf, len);
+    }
+    
+    /* lock the context */
+    (void)pthread_mutex_lock(&ctx->mutex);
+    
+    /* set the param */
+    ctx->scratch[0] = reg;
+    ctx->msgs[0].addr = addr >> 1;
+    if (ctx->nostart != 0)
+    {
+        ctx->msgs[0].len = 1;
+        ctx->msgs[1].addr = addr >> 1;
+        ctx->msgs[1].flags = I2C_M_NOSTART;
+        ctx->msgs[1].buf = buf;
+        ctx->msgs[1].len = len;
+        ctx->data.nmsgs = 2;
+    }
+    else
+    {
+        memcpy(&ctx->scratch[1], buf, len);
+        ctx->msgs[0].len = len + 1;
+        ctx->data.nmsgs = 1;
+    }
+    
+    /* transmit */
+    res = 0;
+    if (ioctl(ctx->fd, I2C_RDWR, &ctx->data) < 0)
+    {
+        perror("iic: write failed.\n");
+        res = 1;
+    }
+    
+    /* unlock the context */
+    (void)pthread_mutex_unlock(&ctx->mutex);
+    
+    return res;
+}
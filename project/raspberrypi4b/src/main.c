@@ -37,8 +37,18 @@
 #include "driver_mcp9808_register_test.h"
 #include "driver_mcp9808_read_test.h"
 #include "driver_mcp9808_interrupt_test.h"
+#include "driver_mcp9808_benchmark_test.h"
+#include "driver_mcp9808_budget_test.h"
+#include "driver_mcp9808_trace_test.h"
+#include "driver_mcp9808_fault_test.h"
+#include "driver_mcp9808_stats_test.h"
 #include "driver_mcp9808_basic.h"
 #include "driver_mcp9808_interrupt.h"
+#include "driver_mcp9808_bus.h"
+#include "raspberrypi4b_driver_mcp9808_engine.h"
+#include "raspberrypi4b_driver_mcp9808_shm.h"
+#include "raspberrypi4b_driver_mcp9808_server.h"
+#include "raspberrypi4b_driver_mcp9808_periodic.h"
 #include "gpio.h"
 #include <getopt.h>
 #include <stdlib.h>
@@ -47,64 +57,47 @@
  * @brief global var definition
  */
 uint8_t (*g_gpio_irq)(void) = NULL;        /**< gpio irq */
-volatile static uint8_t gs_flag;           /**< flag */
 
 /**
- * @brief     interface receive callback
- * @param[in] type interrupt type
+ * @brief     print an alert event
+ * @param[in] *event pointer to an event structure
  * @note      none
  */
-static void a_callback(uint8_t type)
+static void a_event_print(const mcp9808_event_t *event)
 {
-    float temperature_deg;
+    if ((event->flags & MCP9808_STATUS_FLAG_CRIT) != 0)
+    {
+        mcp9808_interface_debug_print("mcp9808: irq critical temperature.\n");
+    }
+    if ((event->flags & MCP9808_STATUS_FLAG_T_UPPER) != 0)
+    {
+        mcp9808_interface_debug_print("mcp9808: irq temperature upper boundary.\n");
+    }
+    if ((event->flags & MCP9808_STATUS_FLAG_T_LOWER) != 0)
+    {
+        mcp9808_interface_debug_print("mcp9808: irq temperature lower boundary.\n");
+    }
     
-    switch (type)
+    /* output */
+    mcp9808_interface_debug_print("mcp9808: temperature is %0.2fC.\n", (float)(event->raw) * 0.0625f);
+}
+
+/**
+ * @brief     periodic sample print
+ * @param[in] *sample pointer to a periodic sample
+ * @note      none
+ */
+static void a_periodic_print(const mcp9808_periodic_sample_t *sample)
+{
+    if (sample->status != 0)
     {
-        case MCP9808_STATUS_CRIT:
-        {
-            mcp9808_interface_debug_print("mcp9808: irq critical temperature.\n");
-            gs_flag = 1;
-            
-            /* read temperature */
-            (void)mcp9808_interrupt_read(&temperature_deg);
-            
-            /* output */
-            mcp9808_interface_debug_print("mcp9808: temperature is %0.2fC.\n", temperature_deg);
-            
-            break;
-        }
-        case MCP9808_STATUS_T_UPPER:
-        {
-            mcp9808_interface_debug_print("mcp9808: irq temperature upper boundary.\n");
-            gs_flag = 1;
-            
-            /* read temperature */
-            (void)mcp9808_interrupt_read(&temperature_deg);
-            
-            /* output */
-            mcp9808_interface_debug_print("mcp9808: temperature is %0.2fC.\n", temperature_deg);
-            
-            break;
-        }
-        case MCP9808_STATUS_T_LOWER:
-        {
-            mcp9808_interface_debug_print("mcp9808: irq temperature lower boundary.\n");
-            gs_flag = 1;
-            
-            /* read temperature */
-            (void)mcp9808_interrupt_read(&temperature_deg);
-            
-            /* output */
-            mcp9808_interface_debug_print("mcp9808: temperature is %0.2fC.\n", temperature_deg);
-            
-            break;
-        }
-        default:
-        {
-            mcp9808_interface_debug_print("mcp9808: unknown code.\n");
-            
-            break;
-        }
+        mcp9808_interface_debug_print("mcp9808: %d read failed.\n", sample->index + 1);
+    }
+    else
+    {
+        mcp9808_interface_debug_print("mcp9808: %d scheduled %lluns actual %lluns temperature is %0.2fC.\n",
+                                      sample->index + 1, (unsigned long long)sample->scheduled_ns,
+                                      (unsigned long long)sample->actual_ns, sample->temperature_deg);
     }
 }
 
@@ -135,14 +128,26 @@ uint8_t mcp9808(uint8_t argc, char **argv)
         {"high", required_argument, NULL, 3},
         {"low", required_argument, NULL, 4},
         {"times", required_argument, NULL, 5},
+        {"bus", required_argument, NULL, 6},
+        {"period", required_argument, NULL, 7},
+        {"cpu", required_argument, NULL, 8},
+        {"fifo", required_argument, NULL, 9},
+        {"mlock", no_argument, NULL, 10},
+        {"format", required_argument, NULL, 11},
+        {"file", required_argument, NULL, 12},
         {NULL, 0, NULL, 0},
     };
     char type[33] = "unknown";
+    char file[257] = "/tmp/mcp9808.trace";
     uint32_t times = 3;
     float low_threshold = 25.0f;
     float high_threshold = 30.0f;
     float critical_temperature = 27.0f;
     mcp9808_address_t addr = MCP9808_ADDRESS_A2A1A0_000;
+    uint8_t bus[MCP9808_ENGINE_MAX_BUS] = {1};
+    uint8_t bus_num = 1;
+    mcp9808_periodic_config_t periodic = {1000000, MCP9808_PERIODIC_NO_CPU, 0, 0};
+    mcp9808_benchmark_format_t format = MCP9808_BENCHMARK_FORMAT_JSON;
     
     /* if no params */
     if (argc == 1)
@@ -293,6 +298,104 @@ uint8_t mcp9808(uint8_t argc, char **argv)
                 break;
             } 
             
+            /* bus list */
+            case 6 :
+            {
+                char *p = optarg;
+                
+                /* set the buses */
+                bus_num = 0;
+                while (*p != '\0')
+                {
+                    if (bus_num >= MCP9808_ENGINE_MAX_BUS)
+                    {
+                        return 5;
+                    }
+                    bus[bus_num] = (uint8_t)strtol(p, &p, 10);
+                    bus_num++;
+                    if (*p == ',')
+                    {
+                        p++;
+                    }
+                    else if (*p != '\0')
+                    {
+                        return 5;
+                    }
+                }
+                if (bus_num == 0)
+                {
+                    return 5;
+                }
+                
+                break;
+            } 
+            
+            /* sampling period */
+            case 7 :
+            {
+                /* set the period */
+                periodic.period_us = (uint32_t)atol(optarg);
+                
+                break;
+            } 
+            
+            /* pinned cpu */
+            case 8 :
+            {
+                /* set the cpu */
+                periodic.cpu = (int16_t)atoi(optarg);
+                
+                break;
+            } 
+            
+            /* SCHED_FIFO priority */
+            case 9 :
+            {
+                /* set the priority */
+                periodic.priority = (uint8_t)atoi(optarg);
+                
+                break;
+            } 
+            
+            /* lock memory */
+            case 10 :
+            {
+                /* enable mlockall */
+                periodic.lock_memory = 1;
+                
+                break;
+            } 
+            
+            /* benchmark format */
+            case 11 :
+            {
+                /* set the format */
+                if (strcmp("json", optarg) == 0)
+                {
+                    format = MCP9808_BENCHMARK_FORMAT_JSON;
+                }
+                else if (strcmp("csv", optarg) == 0)
+                {
+                    format = MCP9808_BENCHMARK_FORMAT_CSV;
+                }
+                else
+                {
+                    return 5;
+                }
+                
+                break;
+            } 
+            
+            /* trace file */
+            case 12 :
+            {
+                /* set the file */
+                memset(file, 0, sizeof(char) * 257);
+                snprintf(file, 256, "%s", optarg);
+                
+                break;
+            } 
+            
             /* the end */
             case -1 :
             {
@@ -358,6 +461,66 @@ uint8_t mcp9808(uint8_t argc, char **argv)
         
         return 0;
     }
+    else if (strcmp("t_bench", type) == 0)
+    {
+        /* run benchmark test */
+        if (mcp9808_benchmark_test(format, times) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_budget", type) == 0)
+    {
+        /* run budget test */
+        if (mcp9808_budget_test() != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_record", type) == 0)
+    {
+        /* run trace record test */
+        if (mcp9808_trace_record_test(addr, file, times) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_replay", type) == 0)
+    {
+        /* run trace replay test */
+        if (mcp9808_trace_replay_test(addr, file, times) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_fault", type) == 0)
+    {
+        /* run fault test */
+        if (mcp9808_fault_test(times) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_stats", type) == 0)
+    {
+        /* run stats test */
+        if (mcp9808_stats_test(times) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
     else if (strcmp("e_read", type) == 0)
     {
         uint8_t res;
@@ -396,6 +559,36 @@ uint8_t mcp9808(uint8_t argc, char **argv)
         
         return 0;
     }
+    else if (strcmp("e_periodic", type) == 0)
+    {
+        uint8_t res;
+        mcp9808_periodic_stats_t stats;
+        
+        /* basic init */
+        res = mcp9808_basic_init(addr);
+        if (res != 0)
+        {
+            return 1;
+        }
+        
+        /* sample on absolute deadlines */
+        res = mcp9808_periodic_run(&periodic, times, mcp9808_basic_read, a_periodic_print, &stats);
+        
+        /* output the jitter */
+        if (res == 0)
+        {
+            mcp9808_interface_debug_print("mcp9808: period %dus samples %d missed %d.\n",
+                                          periodic.period_us, stats.count, stats.missed);
+            mcp9808_interface_debug_print("mcp9808: latency min %lluns max %lluns mean %0.0fns stddev %0.0fns.\n",
+                                          (unsigned long long)stats.min_ns, (unsigned long long)stats.max_ns,
+                                          stats.mean_ns, stats.stddev_ns);
+        }
+        
+        /* basic deinit */
+        (void)mcp9808_basic_deinit();
+        
+        return res;
+    }
     else if (strcmp("e_int", type) == 0)
     {
         uint8_t res;
@@ -413,7 +606,7 @@ uint8_t mcp9808(uint8_t argc, char **argv)
         
         /* run interrupt test */
         if (mcp9808_interrupt_init(addr, low_threshold, high_threshold,
-                                   critical_temperature, a_callback) != 0)
+                                   critical_temperature, NULL) != 0)
         {
             (void)gpio_interrupt_deinit();
             g_gpio_irq = NULL;
@@ -421,16 +614,48 @@ uint8_t mcp9808(uint8_t argc, char **argv)
             return 1;
         }
         
-        gs_flag = 0;
-        for (i = 0; i < times; i++)
+        i = 0;
+        while (i < times)
         {
-            while (gs_flag == 0)
+            mcp9808_event_t event[8];
+            uint32_t len;
+            uint32_t j;
+            
+            /* sleep until an alert */
+            if (mcp9808_interrupt_wait(MCP9808_INTERFACE_WAIT_FOREVER) != 0)
             {
-                gs_flag = 0;
+                mcp9808_interface_debug_print("mcp9808: wait interrupt failed.\n");
+                (void)mcp9808_interrupt_deinit();
+                (void)gpio_interrupt_deinit();
+                g_gpio_irq = NULL;
+                
+                return 1;
             }
             
-            /* output */
-            mcp9808_interface_debug_print("mcp9808: find interrupt.\n");
+            /* drain the queued events */
+            len = 8;
+            res = mcp9808_interrupt_get_events(event, &len);
+            if (res != 0)
+            {
+                (void)mcp9808_interrupt_deinit();
+                (void)gpio_interrupt_deinit();
+                g_gpio_irq = NULL;
+                
+                return 1;
+            }
+            for (j = 0; j < len; j++)
+            {
+                /* output */
+                mcp9808_interface_debug_print("mcp9808: find interrupt.\n");
+                a_event_print(&event[j]);
+                i++;
+            }
+        }
+        
+        /* output the dropped events */
+        if (mcp9808_interrupt_get_dropped(&i) == 0)
+        {
+            mcp9808_interface_debug_print("mcp9808: dropped %d events.\n", (uint32_t)i);
         }
         
         /* gpio deinit */
@@ -440,6 +665,344 @@ uint8_t mcp9808(uint8_t argc, char **argv)
         
         return 0;
     }
+    else if (strcmp("e_bus", type) == 0)
+    {
+        uint8_t res;
+        uint8_t j;
+        uint8_t num;
+        uint8_t len;
+        uint32_t i;
+        mcp9808_bus_sample_t sample[MCP9808_BUS_MAX_DEVICE];
+        
+        /* bus init */
+        res = mcp9808_bus_init(&num);
+        if (res != 0)
+        {
+            return 1;
+        }
+        
+        /* output */
+        mcp9808_interface_debug_print("mcp9808: find %d device(s).\n", num);
+        
+        /* loop */
+        for (i = 0; i < times; i++)
+        {
+            /* delay 1000ms */
+            mcp9808_interface_delay_ms(1000);
+            
+            /* sweep all devices */
+            len = MCP9808_BUS_MAX_DEVICE;
+            res = mcp9808_bus_sweep(sample, &len);
+            if (res != 0)
+            {
+                (void)mcp9808_bus_deinit();
+                
+                return 1;
+            }
+            
+            /* output */
+            mcp9808_interface_debug_print("mcp9808: %d/%d.\n", (uint32_t)(i + 1), (uint32_t)times);
+            for (j = 0; j < len; j++)
+            {
+                if (sample[j].status != 0)
+                {
+                    mcp9808_interface_debug_print("mcp9808: addr 0x%02X read failed.\n", sample[j].addr);
+                }
+                else
+                {
+                    mcp9808_interface_debug_print("mcp9808: addr 0x%02X temperature is %0.2fC.\n", sample[j].addr, (float)(sample[j].raw) * 0.0625f);
+                }
+            }
+        }
+        
+        /* bus deinit */
+        (void)mcp9808_bus_deinit();
+        
+        return 0;
+    }
+    else if (strcmp("e_engine", type) == 0)
+    {
+        uint8_t j;
+        uint32_t i;
+        uint32_t k;
+        uint32_t len;
+        mcp9808_event_t event[8];
+        mcp9808_engine_status_t status;
+        
+        /* start one worker per bus */
+        if (mcp9808_engine_start(bus, bus_num, 100) != 0)
+        {
+            return 1;
+        }
+        
+        /* loop */
+        for (i = 0; i < times; i++)
+        {
+            /* delay 1000ms */
+            mcp9808_interface_delay_ms(1000);
+            
+            /* output */
+            mcp9808_interface_debug_print("mcp9808: %d/%d.\n", (uint32_t)(i + 1), (uint32_t)times);
+            for (j = 0; j < bus_num; j++)
+            {
+                /* drain the events */
+                do
+                {
+                    len = 8;
+                    if (mcp9808_engine_get_events(j, event, &len) != 0)
+                    {
+                        (void)mcp9808_engine_stop();
+                        
+                        return 1;
+                    }
+                    for (k = 0; k < len; k++)
+                    {
+                        mcp9808_interface_debug_print("mcp9808: bus %d addr 0x%02X temperature is %0.2fC.\n",
+                                                      bus[j], event[k].addr, (float)(event[k].raw) * 0.0625f);
+                    }
+                } while (len == 8);
+                
+                /* output the status */
+                if (mcp9808_engine_get_status(j, &status) == 0)
+                {
+                    mcp9808_interface_debug_print("mcp9808: bus %d cpu %d device %d sweep %d error %d dropped %d.\n",
+                                                  status.bus, status.cpu, status.device, status.sweep, status.error, status.dropped);
+                }
+            }
+        }
+        
+        /* stop all workers */
+        (void)mcp9808_engine_stop();
+        
+        return 0;
+    }
+    else if (strcmp("e_daemon", type) == 0)
+    {
+        uint8_t j;
+        uint32_t i;
+        uint32_t k;
+        uint32_t len;
+        mcp9808_event_t event[8];
+        mcp9808_shm_sample_t sample;
+        mcp9808_shm_t shm;
+        
+        /* start one worker per bus */
+        if (mcp9808_engine_start(bus, bus_num, 100) != 0)
+        {
+            return 1;
+        }
+        
+        /* create the shared table */
+        if (mcp9808_shm_create(&shm, MCP9808_SHM_DEFAULT_NAME) != 0)
+        {
+            (void)mcp9808_engine_stop();
+            
+            return 1;
+        }
+        
+        /* output */
+        mcp9808_interface_debug_print("mcp9808: publish to %s for %d second(s).\n", MCP9808_SHM_DEFAULT_NAME, times);
+        
+        /* loop */
+        for (i = 0; i < times * 10; i++)
+        {
+            /* delay 100ms */
+            mcp9808_interface_delay_ms(100);
+            
+            /* move the latest events into the table */
+            for (j = 0; j < bus_num; j++)
+            {
+                do
+                {
+                    len = 8;
+                    if (mcp9808_engine_get_events(j, event, &len) != 0)
+                    {
+                        (void)mcp9808_shm_close(&shm);
+                        (void)mcp9808_engine_stop();
+                        
+                        return 1;
+                    }
+                    for (k = 0; k < len; k++)
+                    {
+                        sample.time_us = event[k].time_us;
+                        sample.raw = event[k].raw;
+                        sample.temperature_mc = (int32_t)event[k].raw * 125 / 2;
+                        sample.flags = event[k].flags;
+                        sample.bus = bus[j];
+                        sample.addr = event[k].addr;
+                        (void)mcp9808_shm_write(&shm, mcp9808_shm_slot_index(j, event[k].addr), &sample);
+                    }
+                } while (len == 8);
+            }
+        }
+        
+        /* close the shared table */
+        (void)mcp9808_shm_close(&shm);
+        
+        /* stop all workers */
+        (void)mcp9808_engine_stop();
+        
+        return 0;
+    }
+    else if (strcmp("e_shm", type) == 0)
+    {
+        uint8_t j;
+        uint32_t i;
+        mcp9808_shm_sample_t sample;
+        mcp9808_shm_t shm;
+        
+        /* open the shared table */
+        if (mcp9808_shm_open(&shm, MCP9808_SHM_DEFAULT_NAME) != 0)
+        {
+            return 1;
+        }
+        
+        /* loop */
+        for (i = 0; i < times; i++)
+        {
+            /* delay 1000ms */
+            mcp9808_interface_delay_ms(1000);
+            
+            /* output */
+            mcp9808_interface_debug_print("mcp9808: %d/%d.\n", (uint32_t)(i + 1), (uint32_t)times);
+            for (j = 0; j < MCP9808_SHM_MAX_SLOT; j++)
+            {
+                if ((mcp9808_shm_read(&shm, j, &sample) != 0) || (sample.sequence == 0))
+                {
+                    continue;
+                }
+                mcp9808_interface_debug_print("mcp9808: bus %d addr 0x%02X temperature is %0.3fC sequence %d.\n",
+                                              sample.bus, sample.addr, (float)(sample.temperature_mc) / 1000.0f, sample.sequence);
+            }
+        }
+        
+        /* close the shared table */
+        (void)mcp9808_shm_close(&shm);
+        
+        return 0;
+    }
+    else if (strcmp("e_server", type) == 0)
+    {
+        uint8_t j;
+        uint8_t alert;
+        uint32_t i;
+        uint32_t k;
+        uint32_t len;
+        mcp9808_event_t event[8];
+        mcp9808_server_frame_t frame;
+        mcp9808_server_status_t status;
+        
+        /* start the server */
+        if (mcp9808_server_init(MCP9808_SERVER_DEFAULT_PATH) != 0)
+        {
+            return 1;
+        }
+        
+        /* start one worker per bus */
+        if (mcp9808_engine_start(bus, bus_num, 100) != 0)
+        {
+            (void)mcp9808_server_deinit();
+            
+            return 1;
+        }
+        
+        /* alerts are optional */
+        alert = 0;
+        g_gpio_irq = mcp9808_interrupt_irq_handler;
+        if (gpio_interrupt_init() == 0)
+        {
+            if (mcp9808_interrupt_init(addr, low_threshold, high_threshold,
+                                       critical_temperature, NULL) == 0)
+            {
+                alert = 1;
+            }
+            else
+            {
+                (void)gpio_interrupt_deinit();
+            }
+        }
+        if (alert == 0)
+        {
+            g_gpio_irq = NULL;
+            mcp9808_interface_debug_print("mcp9808: alerts are disabled.\n");
+        }
+        
+        /* output */
+        mcp9808_interface_debug_print("mcp9808: serve %s for %d second(s).\n", MCP9808_SERVER_DEFAULT_PATH, times);
+        
+        /* loop */
+        for (i = 0; i < times * 10; i++)
+        {
+            /* delay 100ms */
+            mcp9808_interface_delay_ms(100);
+            
+            /* publish the samples */
+            for (j = 0; j < bus_num; j++)
+            {
+                do
+                {
+                    len = 8;
+                    if (mcp9808_engine_get_events(j, event, &len) != 0)
+                    {
+                        len = 0;
+                    }
+                    for (k = 0; k < len; k++)
+                    {
+                        frame.type = MCP9808_SERVER_TYPE_SAMPLE;
+                        frame.bus = bus[j];
+                        frame.addr = event[k].addr;
+                        frame.flags = event[k].flags;
+                        frame.raw = event[k].raw;
+                        frame.time_us = event[k].time_us;
+                        (void)mcp9808_server_publish(&frame);
+                    }
+                } while (len == 8);
+            }
+            
+            /* publish the alerts */
+            while (alert != 0)
+            {
+                len = 8;
+                if (mcp9808_interrupt_get_events(event, &len) != 0)
+                {
+                    len = 0;
+                }
+                for (k = 0; k < len; k++)
+                {
+                    frame.type = MCP9808_SERVER_TYPE_ALERT;
+                    frame.bus = 1;
+                    frame.addr = event[k].addr;
+                    frame.flags = event[k].flags;
+                    frame.raw = event[k].raw;
+                    frame.time_us = event[k].time_us;
+                    (void)mcp9808_server_publish(&frame);
+                }
+                if (len != 8)
+                {
+                    break;
+                }
+            }
+        }
+        
+        /* output the status */
+        if (mcp9808_server_get_status(&status) == 0)
+        {
+            mcp9808_interface_debug_print("mcp9808: client %d published %d dropped %d.\n",
+                                          status.client, status.published, status.dropped);
+        }
+        
+        /* stop all */
+        if (alert != 0)
+        {
+            (void)mcp9808_interrupt_deinit();
+            (void)gpio_interrupt_deinit();
+            g_gpio_irq = NULL;
+        }
+        (void)mcp9808_engine_stop();
+        (void)mcp9808_server_deinit();
+        
+        return 0;
+    }
     else if (strcmp("h", type) == 0)
     {
         help:
@@ -451,25 +1014,50 @@ uint8_t mcp9808(uint8_t argc, char **argv)
         mcp9808_interface_debug_print("  mcp9808 (-t read | --test=read) [--addr=<0 | 1 | 2 | 3 | 4 | 5 | 6 | 7>] [--times=<num>]\n");
         mcp9808_interface_debug_print("  mcp9808 (-t int | --test=int) [--addr=<0 | 1 | 2 | 3 | 4 | 5 | 6 | 7>]\n");
         mcp9808_interface_debug_print("                                [--crit=<temperature>] [--high=<threshold>] [--low=<threshold>] [--times=<num>]\n");
+        mcp9808_interface_debug_print("  mcp9808 (-t bench | --test=bench) [--format=<json | csv>] [--times=<num>]\n");
+        mcp9808_interface_debug_print("  mcp9808 (-t budget | --test=budget)\n");
+        mcp9808_interface_debug_print("  mcp9808 (-t record | --test=record) [--addr=<0 | 1 | 2 | 3 | 4 | 5 | 6 | 7>] [--file=<path>] [--times=<num>]\n");
+        mcp9808_interface_debug_print("  mcp9808 (-t replay | --test=replay) [--addr=<0 | 1 | 2 | 3 | 4 | 5 | 6 | 7>] [--file=<path>] [--times=<num>]\n");
+        mcp9808_interface_debug_print("  mcp9808 (-t fault | --test=fault) [--times=<num>]\n");
+        mcp9808_interface_debug_print("  mcp9808 (-t stats | --test=stats) [--times=<num>]\n");
         mcp9808_interface_debug_print("  mcp9808 (-e read | --example=read) [--addr=<0 | 1 | 2 | 3 | 4 | 5 | 6 | 7>] [--times=<num>]\n");
         mcp9808_interface_debug_print("  mcp9808 (-e int | --example=int) [--addr=<0 | 1 | 2 | 3 | 4 | 5 | 6 | 7>]\n");
         mcp9808_interface_debug_print("                                   [--crit=<temperature>] [--high=<threshold>] [--low=<threshold>] [--times=<num>]\n");
+        mcp9808_interface_debug_print("  mcp9808 (-e periodic | --example=periodic) [--addr=<0 | 1 | 2 | 3 | 4 | 5 | 6 | 7>] [--period=<us>]\n");
+        mcp9808_interface_debug_print("                                             [--cpu=<num>] [--fifo=<priority>] [--mlock] [--times=<num>]\n");
+        mcp9808_interface_debug_print("  mcp9808 (-e bus | --example=bus) [--times=<num>]\n");
+        mcp9808_interface_debug_print("  mcp9808 (-e engine | --example=engine) [--bus=<num[,num]>] [--times=<num>]\n");
+        mcp9808_interface_debug_print("  mcp9808 (-e daemon | --example=daemon) [--bus=<num[,num]>] [--times=<num>]\n");
+        mcp9808_interface_debug_print("  mcp9808 (-e shm | --example=shm) [--times=<num>]\n");
+        mcp9808_interface_debug_print("  mcp9808 (-e server | --example=server) [--bus=<num[,num]>] [--addr=<0 | 1 | 2 | 3 | 4 | 5 | 6 | 7>]\n");
+        mcp9808_interface_debug_print("                                         [--crit=<temperature>] [--high=<threshold>] [--low=<threshold>] [--times=<num>]\n");
         mcp9808_interface_debug_print("\n");
         mcp9808_interface_debug_print("Options:\n");
         mcp9808_interface_debug_print("      --addr=<0 | 1 | 2 | 3 | 4 | 5 | 6 | 7>\n");
         mcp9808_interface_debug_print("                        Set the addr.([default: 0])\n");
+        mcp9808_interface_debug_print("      --bus=<num[,num]>\n");
+        mcp9808_interface_debug_print("                        Set the iic bus list, up to four buses.([default: 1])\n");
+        mcp9808_interface_debug_print("      --cpu=<num>       Pin the periodic sampling to one cpu.\n");
         mcp9808_interface_debug_print("      --crit=<temperature>\n");
         mcp9808_interface_debug_print("                        Set the critical temperature.([default: 27.0])\n");
-        mcp9808_interface_debug_print("  -e <read | int>, --example=<read | int>\n");
+        mcp9808_interface_debug_print("  -e <read | int | periodic | bus | engine | daemon | shm | server>,\n");
+        mcp9808_interface_debug_print("  --example=<read | int | periodic | bus | engine | daemon | shm | server>\n");
         mcp9808_interface_debug_print("                        Run the driver example.\n");
         mcp9808_interface_debug_print("      --low=<threshold>\n");
         mcp9808_interface_debug_print("                        Set the low temperature threshold.([default: 25.0])\n");
+        mcp9808_interface_debug_print("      --fifo=<priority> Run the periodic sampling as SCHED_FIFO with the priority.\n");
+        mcp9808_interface_debug_print("      --file=<path>     Set the trace file.([default: /tmp/mcp9808.trace])\n");
+        mcp9808_interface_debug_print("      --format=<json | csv>\n");
+        mcp9808_interface_debug_print("                        Set the benchmark output format.([default: json])\n");
         mcp9808_interface_debug_print("  -h, --help            Show the help.\n");
         mcp9808_interface_debug_print("      --high=<threshold>\n");
         mcp9808_interface_debug_print("                        Set the high temperature threshold.([default: 30.0])\n");
         mcp9808_interface_debug_print("  -i, --information     Show the chip information.\n");
+        mcp9808_interface_debug_print("      --mlock           Lock all pages in memory before the periodic sampling.\n");
         mcp9808_interface_debug_print("  -p, --port            Display the pin connections of the current board.\n");
-        mcp9808_interface_debug_print("  -t <reg | read | int>, --test=<reg | read | int>\n");
+        mcp9808_interface_debug_print("      --period=<us>     Set the periodic sampling period.([default: 1000000])\n");
+        mcp9808_interface_debug_print("  -t <reg | read | int | bench | budget | record | replay | fault | stats>,\n");
+        mcp9808_interface_debug_print("  --test=<reg | read | int | bench | budget | record | replay | fault | stats>\n");
         mcp9808_interface_debug_print("                        Run the driver test.\n");
         mcp9808_interface_debug_print("      --times=<num>     Set the running times.([default: 3])\n");
         
@@ -40,6 +40,21 @@
 #include "iic.h"
 #include <stdarg.h>
 
+/**
+ * @brief iic transfer status definition
+ */
+static uint8_t gs_status;                   /**< iic transfer status */
+
+/**
+ * @brief bus context definition
+ */
+static uint8_t gs_bus;                      /**< bus context token */
+
+/**
+ * @brief event flag definition
+ */
+static volatile uint8_t gs_event;           /**< event flag */
+
 /**
  * @brief  interface iic bus init
  * @return status code
@@ -96,6 +111,211 @@ uint8_t mcp9808_interface_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint
     return iic_read(addr, reg, buf, len);
 }
 
+/**
+ * @brief      interface iic bus read without the register address
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t mcp9808_interface_iic_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    return iic_read_cmd(addr, buf, len);
+}
+
+/**
+ * @brief      interface iic bus read from many devices
+ * @param[in]  *addr pointer to an iic device write address array
+ * @param[in]  *reg pointer to an iic register address array
+ * @param[out] *buf pointer to a data buffer, len bytes per device
+ * @param[in]  len data length of one device
+ * @param[in]  num device number
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t mcp9808_interface_iic_read_batch(uint8_t *addr, uint8_t *reg, uint8_t *buf, uint16_t len, uint16_t num)
+{
+    uint16_t i;
+    
+    for (i = 0; i < num; i++)
+    {
+        if (iic_read(addr[i], reg[i], &buf[i * len], len) != 0)
+        {
+            return 1;
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     interface iic bus context open
+ * @param[in] bus iic bus number
+ * @return    pointer to a bus context, NULL on failure
+ * @note      only bus 0 is wired on this board
+ */
+void *mcp9808_interface_bus_open(uint8_t bus)
+{
+    if (bus != 0)
+    {
+        return NULL;
+    }
+    if (iic_init() != 0)
+    {
+        return NULL;
+    }
+    
+    return &gs_bus;
+}
+
+/**
+ * @brief     interface iic bus context close
+ * @param[in] *bus pointer to a bus context
+ * @return    status code
+ *            - 0 success
+ *            - 1 close failed
+ * @note      none
+ */
+uint8_t mcp9808_interface_bus_close(void *bus)
+{
+    if (bus != &gs_bus)
+    {
+        return 1;
+    }
+    
+    return iic_deinit();
+}
+
+/**
+ * @brief     interface iic bus context write
+ * @param[in] *bus pointer to a bus context
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+uint8_t mcp9808_interface_bus_iic_write(void *bus, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    (void)bus;
+    
+    return iic_write(addr, reg, buf, len);
+}
+
+/**
+ * @brief      interface iic bus context read
+ * @param[in]  *bus pointer to a bus context
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t mcp9808_interface_bus_iic_read(void *bus, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    (void)bus;
+    
+    return iic_read(addr, reg, buf, len);
+}
+
+/**
+ * @brief      interface iic bus context read without the register address
+ * @param[in]  *bus pointer to a bus context
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t mcp9808_interface_bus_iic_read_cmd(void *bus, uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    (void)bus;
+    
+    return iic_read_cmd(addr, buf, len);
+}
+
+/**
+ * @brief      interface iic bus context read from many devices
+ * @param[in]  *bus pointer to a bus context
+ * @param[in]  *addr pointer to an iic device write address array
+ * @param[in]  *reg pointer to an iic register address array
+ * @param[out] *buf pointer to a data buffer, len bytes per device
+ * @param[in]  len data length of one device
+ * @param[in]  num device number
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t mcp9808_interface_bus_iic_read_batch(void *bus, uint8_t *addr, uint8_t *reg, uint8_t *buf, uint16_t len, uint16_t num)
+{
+    (void)bus;
+    
+    return mcp9808_interface_iic_read_batch(addr, reg, buf, len, num);
+}
+
+/**
+ * @brief      interface iic bus read start
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 start failed
+ * @note       buf must stay valid until iic_status is not busy
+ */
+uint8_t mcp9808_interface_iic_read_start(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    gs_status = iic_read(addr, reg, buf, len);
+    
+    return 0;
+}
+
+/**
+ * @brief     interface iic bus write start
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ * @note      buf must stay valid until iic_status is not busy
+ */
+uint8_t mcp9808_interface_iic_write_start(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    gs_status = iic_write(addr, reg, buf, len);
+    
+    return 0;
+}
+
+/**
+ * @brief  interface iic bus transfer status
+ * @return status code
+ *         - 0 done
+ *         - 1 error
+ *         - 2 busy
+ * @note   none
+ */
+uint8_t mcp9808_interface_iic_status(void)
+{
+    return gs_status;
+}
+
 /**
  * @brief     interface delay ms
  * @param[in] ms time
@@ -106,6 +326,51 @@ void mcp9808_interface_delay_ms(uint32_t ms)
     delay_ms(ms);
 }
 
+/**
+ * @brief  interface get the monotonic time
+ * @return time in microseconds
+ * @note   none
+ */
+uint32_t mcp9808_interface_get_time_us(void)
+{
+    return HAL_GetTick() * 1000;
+}
+
+/**
+ * @brief interface event notify
+ * @note  it is called in the irq context and must not block
+ */
+void mcp9808_interface_event_notify(void)
+{
+    gs_event = 1;
+}
+
+/**
+ * @brief     interface event wait
+ * @param[in] timeout_ms timeout in ms, MCP9808_INTERFACE_WAIT_FOREVER waits without a timeout
+ * @return    status code
+ *            - 0 success
+ *            - 1 timeout
+ * @note      the core sleeps in wfi, the 1ms systick bounds the wake up latency
+ */
+uint8_t mcp9808_interface_event_wait(uint32_t timeout_ms)
+{
+    uint32_t start;
+    
+    start = HAL_GetTick();
+    while (gs_event == 0)
+    {
+        if ((timeout_ms != MCP9808_INTERFACE_WAIT_FOREVER) && ((HAL_GetTick() - start) >= timeout_ms))
+        {
+            return 1;
+        }
+        __WFI();
+    }
+    gs_event = 0;
+    
+    return 0;
+}
+
 /**
  * @brief     interface print format data
  * @param[in] fmt format data
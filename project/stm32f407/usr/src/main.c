@@ -39,6 +39,7 @@
 #include "driver_mcp9808_interrupt_test.h"
 #include "driver_mcp9808_basic.h"
 #include "driver_mcp9808_interrupt.h"
+#include "driver_mcp9808_bus.h"
 #include "shell.h"
 #include "clock.h"
 #include "delay.h"
@@ -53,7 +54,6 @@
 uint8_t g_buf[256];                        /**< uart buffer */
 volatile uint16_t g_len;                   /**< uart buffer length */
 uint8_t (*g_gpio_irq)(void) = NULL;        /**< gpio irq */
-volatile static uint8_t gs_flag;           /**< flag */
 
 /**
  * @brief exti 0 irq
@@ -81,62 +81,27 @@ void HAL_GPIO_EXTI_Callback(uint16_t pin)
 }
 
 /**
- * @brief     interface receive callback
- * @param[in] type interrupt type
+ * @brief     print an alert event
+ * @param[in] *event pointer to an event structure
  * @note      none
  */
-static void a_callback(uint8_t type)
+static void a_event_print(const mcp9808_event_t *event)
 {
-    float temperature_deg = 0.0f;
-    
-    switch (type)
+    if ((event->flags & MCP9808_STATUS_FLAG_CRIT) != 0)
     {
-        case MCP9808_STATUS_CRIT:
-        {
-            mcp9808_interface_debug_print("mcp9808: irq critical temperature.\n");
-            gs_flag = 1;
-            
-            /* read temperature */
-            (void)mcp9808_interrupt_read(&temperature_deg);
-            
-            /* output */
-            mcp9808_interface_debug_print("mcp9808: temperature is %0.2fC.\n", temperature_deg);
-            
-            break;
-        }
-        case MCP9808_STATUS_T_UPPER:
-        {
-            mcp9808_interface_debug_print("mcp9808: irq temperature upper boundary.\n");
-            gs_flag = 1;
-            
-            /* read temperature */
-            (void)mcp9808_interrupt_read(&temperature_deg);
-            
-            /* output */
-            mcp9808_interface_debug_print("mcp9808: temperature is %0.2fC.\n", temperature_deg);
-            
-            break;
-        }
-        case MCP9808_STATUS_T_LOWER:
-        {
-            mcp9808_interface_debug_print("mcp9808: irq temperature lower boundary.\n");
-            gs_flag = 1;
-            
-            /* read temperature */
-            (void)mcp9808_interrupt_read(&temperature_deg);
-            
-            /* output */
-            mcp9808_interface_debug_print("mcp9808: temperature is %0.2fC.\n", temperature_deg);
-            
-            break;
-        }
-        default:
-        {
-            mcp9808_interface_debug_print("mcp9808: unknown code.\n");
-            
-            break;
-        }
+        mcp9808_interface_debug_print("mcp9808: irq critical temperature.\n");
+    }
+    if ((event->flags & MCP9808_STATUS_FLAG_T_UPPER) != 0)
+    {
+        mcp9808_interface_debug_print("mcp9808: irq temperature upper boundary.\n");
+    }
+    if ((event->flags & MCP9808_STATUS_FLAG_T_LOWER) != 0)
+    {
+        mcp9808_interface_debug_print("mcp9808: irq temperature lower boundary.\n");
     }
+    
+    /* output */
+    mcp9808_interface_debug_print("mcp9808: temperature is %0.2fC.\n", (float)(event->raw) * 0.0625f);
 }
 
 /**
@@ -444,7 +409,7 @@ uint8_t mcp9808(uint8_t argc, char **argv)
         
         /* run interrupt test */
         if (mcp9808_interrupt_init(addr, low_threshold, high_threshold,
-                                   critical_temperature, a_callback) != 0)
+                                   critical_temperature, NULL) != 0)
         {
             (void)gpio_interrupt_deinit();
             g_gpio_irq = NULL;
@@ -452,16 +417,48 @@ uint8_t mcp9808(uint8_t argc, char **argv)
             return 1;
         }
         
-        gs_flag = 0;
-        for (i = 0; i < times; i++)
+        i = 0;
+        while (i < times)
         {
-            while (gs_flag == 0)
+            mcp9808_event_t event[8];
+            uint32_t len;
+            uint32_t j;
+            
+            /* sleep until an alert */
+            if (mcp9808_interrupt_wait(MCP9808_INTERFACE_WAIT_FOREVER) != 0)
             {
-                gs_flag = 0;
+                mcp9808_interface_debug_print("mcp9808: wait interrupt failed.\n");
+                (void)mcp9808_interrupt_deinit();
+                (void)gpio_interrupt_deinit();
+                g_gpio_irq = NULL;
+                
+                return 1;
             }
             
-            /* output */
-            mcp9808_interface_debug_print("mcp9808: find interrupt.\n");
+            /* drain the queued events */
+            len = 8;
+            res = mcp9808_interrupt_get_events(event, &len);
+            if (res != 0)
+            {
+                (void)mcp9808_interrupt_deinit();
+                (void)gpio_interrupt_deinit();
+                g_gpio_irq = NULL;
+                
+                return 1;
+            }
+            for (j = 0; j < len; j++)
+            {
+                /* output */
+                mcp9808_interface_debug_print("mcp9808: find interrupt.\n");
+                a_event_print(&event[j]);
+                i++;
+            }
+        }
+        
+        /* output the dropped events */
+        if (mcp9808_interrupt_get_dropped(&i) == 0)
+        {
+            mcp9808_interface_debug_print("mcp9808: dropped %d events.\n", (uint32_t)i);
         }
         
         /* gpio deinit */
@@ -471,6 +468,61 @@ uint8_t mcp9808(uint8_t argc, char **argv)
         
         return 0;
     }
+    else if (strcmp("e_bus", type) == 0)
+    {
+        uint8_t res;
+        uint8_t j;
+        uint8_t num;
+        uint8_t len;
+        uint32_t i;
+        mcp9808_bus_sample_t sample[MCP9808_BUS_MAX_DEVICE];
+        
+        /* bus init */
+        res = mcp9808_bus_init(&num);
+        if (res != 0)
+        {
+            return 1;
+        }
+        
+        /* output */
+        mcp9808_interface_debug_print("mcp9808: find %d device(s).\n", num);
+        
+        /* loop */
+        for (i = 0; i < times; i++)
+        {
+            /* delay 1000ms */
+            mcp9808_interface_delay_ms(1000);
+            
+            /* sweep all devices */
+            len = MCP9808_BUS_MAX_DEVICE;
+            res = mcp9808_bus_sweep(sample, &len);
+            if (res != 0)
+            {
+                (void)mcp9808_bus_deinit();
+                
+                return 1;
+            }
+            
+            /* output */
+            mcp9808_interface_debug_print("mcp9808: %d/%d.\n", (uint32_t)(i + 1), (uint32_t)times);
+            for (j = 0; j < len; j++)
+            {
+                if (sample[j].status != 0)
+                {
+                    mcp9808_interface_debug_print("mcp9808: addr 0x%02X read failed.\n", sample[j].addr);
+                }
+                else
+                {
+                    mcp9808_interface_debug_print("mcp9808: addr 0x%02X temperature is %0.2fC.\n", sample[j].addr, (float)(sample[j].raw) * 0.0625f);
+                }
+            }
+        }
+        
+        /* bus deinit */
+        (void)mcp9808_bus_deinit();
+        
+        return 0;
+    }
     else if (strcmp("h", type) == 0)
     {
         help:
@@ -485,13 +537,14 @@ uint8_t mcp9808(uint8_t argc, char **argv)
         mcp9808_interface_debug_print("  mcp9808 (-e read | --example=read) [--addr=<0 | 1 | 2 | 3 | 4 | 5 | 6 | 7>] [--times=<num>]\n");
         mcp9808_interface_debug_print("  mcp9808 (-e int | --example=int) [--addr=<0 | 1 | 2 | 3 | 4 | 5 | 6 | 7>]\n");
         mcp9808_interface_debug_print("                                   [--crit=<temperature>] [--high=<threshold>] [--low=<threshold>] [--times=<num>]\n");
+        mcp9808_interface_debug_print("  mcp9808 (-e bus | --example=bus) [--times=<num>]\n");
         mcp9808_interface_debug_print("\n");
         mcp9808_interface_debug_print("Options:\n");
         mcp9808_interface_debug_print("      --addr=<0 | 1 | 2 | 3 | 4 | 5 | 6 | 7>\n");
         mcp9808_interface_debug_print("                        Set the addr.([default: 0])\n");
         mcp9808_interface_debug_print("      --crit=<temperature>\n");
         mcp9808_interface_debug_print("                        Set the critical temperature.([default: 27.0])\n");
-        mcp9808_interface_debug_print("  -e <read | int>, --example=<read | int>\n");
+        mcp9808_interface_debug_print("  -e <read | int | bus>, --example=<read | int | bus>\n");
         mcp9808_interface_debug_print("                        Run the driver example.\n");
         mcp9808_interface_debug_print("      --low=<threshold>\n");
         mcp9808_interface_debug_print("                        Set the low temperature threshold.([default: 25.0])\n");
@@ -35,6 +35,10 @@
  */
 
 #include "driver_mcp9808.h"
+#include "driver_mcp9808_reg.h"
+#if (MCP9808_USE_PROBE == 1)
+#include <sys/sdt.h>
+#endif
 
 /**
  * @brief chip information definition
@@ -49,19 +53,139 @@
 #define DRIVER_VERSION            1000                       /**< driver version */
 
 /**
- * @brief chip reg definition
+ * @brief static probe definition
+ * @note  the probes are named mcp9808:<name> and can be attached with bpftrace or perf
  */
-#define MCP9808_REG_CONFIG                 0x01        /**< config register */
-#define MCP9808_REG_ALERT_UPPER            0x02        /**< alert temperature upper boundary trip register */
-#define MCP9808_REG_ALERT_LOWER            0x03        /**< alert temperature lower boundary trip register */
-#define MCP9808_REG_CRIT                   0x04        /**< critical temperature trip register */
-#define MCP9808_REG_TEMPERATURE            0x05        /**< temperature register */
-#define MCP9808_REG_MANUFACTURER_ID        0x06        /**< manufacturer id register */
-#define MCP9808_REG_DEVICE_ID              0x07        /**< device id register */
-#define MCP9808_REG_RESOLUTION             0x08        /**< resolution register */
+#if (MCP9808_USE_PROBE == 1)
+    #define MCP9808_PROBE1(NAME, A)                   DTRACE_PROBE1(mcp9808, NAME, A)                   /**< probe with 1 argument */
+    #define MCP9808_PROBE2(NAME, A, B)                DTRACE_PROBE2(mcp9808, NAME, A, B)                /**< probe with 2 arguments */
+    #define MCP9808_PROBE3(NAME, A, B, C)             DTRACE_PROBE3(mcp9808, NAME, A, B, C)             /**< probe with 3 arguments */
+    #define MCP9808_PROBE4(NAME, A, B, C, D)          DTRACE_PROBE4(mcp9808, NAME, A, B, C, D)          /**< probe with 4 arguments */
+#else
+    #define MCP9808_PROBE1(NAME, A)                                                                     /**< probe disabled */
+    #define MCP9808_PROBE2(NAME, A, B)                                                                  /**< probe disabled */
+    #define MCP9808_PROBE3(NAME, A, B, C)                                                               /**< probe disabled */
+    #define MCP9808_PROBE4(NAME, A, B, C, D)                                                            /**< probe disabled */
+#endif
 
 /**
- * @brief      read bytes
+ * @brief conversion time definition
+ */
+static const uint32_t gs_conversion_time_us[4] =
+{
+    30000, 65000, 130000, 250000,        /**< 0.5C, 0.25C, 0.125C and 0.0625C conversion time */
+};
+
+/**
+ * @brief     get the stats start time
+ * @param[in] *handle pointer to a mcp9808 handle structure
+ * @return    start time in us
+ * @note      get_time_us is used when stats_time_us is not linked, 0 is returned without both
+ */
+static uint32_t a_mcp9808_stats_start(mcp9808_handle_t *handle)
+{
+#if (MCP9808_USE_STATS == 1)
+    if (handle->stats_time_us != NULL)                                           /* check stats_time_us */
+    {
+        return handle->stats_time_us();                                          /* get the start time */
+    }
+    if (handle->get_time_us != NULL)                                             /* check get_time_us */
+    {
+        return handle->get_time_us();                                            /* get the start time */
+    }
+#else
+    (void)handle;                                                                /* not used */
+#endif
+    
+    return 0;                                                                    /* no timing */
+}
+
+/**
+ * @brief     update the stats
+ * @param[in] *handle pointer to a mcp9808 handle structure
+ * @param[in] operation stats operation
+ * @param[in] start start time from a_mcp9808_stats_start
+ * @param[in] res status code of the operation
+ * @param[in] len payload length
+ * @note      the latency goes to bucket n when it is in [2^(n - 1), 2^n)us
+ */
+static void a_mcp9808_stats_update(mcp9808_handle_t *handle, mcp9808_stats_operation_t operation,
+                                   uint32_t start, uint8_t res, uint16_t len)
+{
+#if (MCP9808_USE_STATS == 1)
+    uint8_t i;
+    uint32_t us;
+    
+    if (operation == MCP9808_STATS_OPERATION_READ)                               /* register read */
+    {
+        handle->stats.read++;                                                    /* count the read */
+        handle->stats.read_byte += (res == 0) ? len : 0;                         /* count the bytes */
+    }
+    else if (operation == MCP9808_STATS_OPERATION_WRITE)                         /* register write */
+    {
+        handle->stats.write++;                                                   /* count the write */
+        handle->stats.write_byte += (res == 0) ? len : 0;                        /* count the bytes */
+    }
+    else if (operation == MCP9808_STATS_OPERATION_BATCH)                         /* batch read */
+    {
+        handle->stats.batch++;                                                   /* count the batch */
+        handle->stats.read_byte += (res == 0) ? len : 0;                         /* count the bytes */
+    }
+    else
+    {
+        handle->stats.irq++;                                                     /* count the irq */
+    }
+    if ((res != 0) && (operation != MCP9808_STATS_OPERATION_IRQ))                /* check the link status */
+    {
+        handle->stats.failure[(res < 7) ? res : 7]++;                            /* count the failure */
+    }
+    if (handle->stats_time_us != NULL)                                           /* check stats_time_us */
+    {
+        us = handle->stats_time_us() - start;                                    /* get the latency */
+    }
+    else if (handle->get_time_us != NULL)                                        /* check get_time_us */
+    {
+        us = handle->get_time_us() - start;                                      /* get the latency */
+    }
+    else
+    {
+        return;                                                                  /* no timing */
+    }
+    i = 0;                                                                       /* bucket 0 */
+    while ((i < MCP9808_STATS_BUCKET - 1) && (i < 32) && ((us >> i) != 0))       /* find the bucket */
+    {
+        i++;                                                                     /* next bucket */
+    }
+    handle->stats.histogram[operation][i]++;                                     /* count the latency */
+    if (us > handle->stats.max_us[operation])                                    /* check the max latency */
+    {
+        handle->stats.max_us[operation] = us;                                    /* save the max latency */
+    }
+#else
+    (void)handle;                                                                /* not used */
+    (void)operation;                                                             /* not used */
+    (void)start;                                                                 /* not used */
+    (void)res;                                                                   /* not used */
+    (void)len;                                                                   /* not used */
+#endif
+}
+
+/**
+ * @brief     count a fired callback
+ * @param[in] *handle pointer to a mcp9808 handle structure
+ * @note      none
+ */
+static void a_mcp9808_stats_callback(mcp9808_handle_t *handle)
+{
+#if (MCP9808_USE_STATS == 1)
+    handle->stats.callback++;                                                    /* count the callback */
+#else
+    (void)handle;                                                                /* not used */
+#endif
+}
+
+/**
+ * @brief      read bytes once
  * @param[in]  *handle pointer to a mcp9808 handle structure
  * @param[in]  reg iic register address
  * @param[out] *data pointer to a data buffer
@@ -69,20 +193,52 @@
  * @return     status code
  *             - 0 success
  *             - 1 read failed
- * @note       none
+ * @note       the register address is skipped when the chip pointer already matches
  */
-static uint8_t a_mcp9808_iic_read(mcp9808_handle_t *handle, uint8_t reg, uint8_t *data, uint16_t len)
+static uint8_t a_mcp9808_iic_read_once(mcp9808_handle_t *handle, uint8_t reg, uint8_t *data, uint16_t len)
 {
-    if (handle->iic_read(handle->iic_addr, reg, data, len) != 0)        /* read the register */
+    uint8_t res;
+    uint32_t start;
+    
+    start = a_mcp9808_stats_start(handle);                                     /* start timing */
+    if (((handle->iic_read_cmd != NULL) || (handle->iic_read_cmd_ctx != NULL)) &&
+        (handle->pointer_valid != 0) && (handle->pointer == reg))              /* check the register pointer */
+    {
+        if (handle->iic_read_cmd_ctx != NULL)                                  /* check the bus context hook */
+        {
+            res = handle->iic_read_cmd_ctx(handle->bus, handle->iic_addr,
+                                           data, len);                         /* read without the register address */
+        }
+        else
+        {
+            res = handle->iic_read_cmd(handle->iic_addr, data, len);           /* read without the register address */
+        }
+    }
+    else if (handle->iic_read_ctx != NULL)                                     /* check the bus context hook */
+    {
+        res = handle->iic_read_ctx(handle->bus, handle->iic_addr,
+                                   reg, data, len);                            /* read the register */
+    }
+    else
+    {
+        res = handle->iic_read(handle->iic_addr, reg, data, len);              /* read the register */
+    }
+    a_mcp9808_stats_update(handle, MCP9808_STATS_OPERATION_READ,
+                           start, res, len);                                   /* update the stats */
+    if (res != 0)                                                              /* check result */
     {
-        return 1;                                                       /* return error */
+        handle->pointer_valid = 0;                                             /* the pointer is unknown */
+        
+        return 1;                                                              /* return error */
     }
+    handle->pointer = reg;                                                     /* save the pointer */
+    handle->pointer_valid = 1;                                                 /* set valid */
     
-    return 0;                                                           /* success return 0 */
+    return 0;                                                                  /* success return 0 */
 }
 
 /**
- * @brief     write bytes
+ * @brief     write bytes once
  * @param[in] *handle pointer to a mcp9808 handle structure
  * @param[in] reg iic register address
  * @param[in] *data pointer to a data buffer
@@ -90,165 +246,678 @@ static uint8_t a_mcp9808_iic_read(mcp9808_handle_t *handle, uint8_t reg, uint8_t
  * @return    status code
  *            - 0 success
  *            - 1 write failed
- * @note      none
+ * @note      the written register becomes the chip pointer
  */
-static uint8_t a_mcp9808_iic_write(mcp9808_handle_t *handle, uint8_t reg, uint8_t *data, uint16_t len)
+static uint8_t a_mcp9808_iic_write_once(mcp9808_handle_t *handle, uint8_t reg, uint8_t *data, uint16_t len)
 {
-    if (handle->iic_write(handle->iic_addr, reg, data, len) != 0)        /* write the register */
+    uint8_t res;
+    uint32_t start;
+    
+    start = a_mcp9808_stats_start(handle);                               /* start timing */
+    if (handle->iic_write_ctx != NULL)                                   /* check the bus context hook */
+    {
+        res = handle->iic_write_ctx(handle->bus, handle->iic_addr,
+                                    reg, data, len);                     /* write the register */
+    }
+    else
+    {
+        res = handle->iic_write(handle->iic_addr, reg, data, len);       /* write the register */
+    }
+    a_mcp9808_stats_update(handle, MCP9808_STATS_OPERATION_WRITE,
+                           start, res, len);                             /* update the stats */
+    if (res != 0)                                                        /* check result */
     {
+        handle->pointer_valid = 0;                                       /* the pointer is unknown */
+        
         return 1;                                                        /* return error */
     }
+    handle->pointer = reg;                                               /* save the pointer */
+    handle->pointer_valid = 1;                                           /* set valid */
     
     return 0;                                                            /* success return 0 */
 }
 
 /**
- * @brief     irq handler
- * @param[in] *handle pointer to a mcp9808 handle structure
- * @return    status code
- *            - 0 success
- *            - 1 run failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ * @brief      read a batch once
+ * @param[in]  *handle pointer to the first mcp9808 handle structure
+ * @param[in]  *addr pointer to an iic device address list
+ * @param[in]  *reg pointer to an iic register address list
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  num device number
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
  */
-uint8_t mcp9808_irq_handler(mcp9808_handle_t *handle)
+static uint8_t a_mcp9808_iic_read_batch_once(mcp9808_handle_t *handle, uint8_t *addr, uint8_t *reg,
+                                             uint8_t *buf, uint8_t num)
 {
     uint8_t res;
-    uint16_t prev;
-    uint8_t buf[2];
+    uint32_t start;
     
-    if (handle == NULL)                                                       /* check handle */
+    start = a_mcp9808_stats_start(handle);                                        /* start timing */
+    if (handle->iic_read_batch_ctx != NULL)                                       /* check the bus context hook */
     {
-        return 2;                                                             /* return error */
+        res = handle->iic_read_batch_ctx(handle->bus, addr, reg, buf, 2, num);    /* read all devices */
     }
-    if (handle->inited != 1)                                                  /* check handle initialization */
+    else
     {
-        return 3;                                                             /* return error */
+        res = handle->iic_read_batch(addr, reg, buf, 2, num);                     /* read all devices */
     }
+    a_mcp9808_stats_update(handle, MCP9808_STATS_OPERATION_BATCH,
+                           start, res, (uint16_t)(num * 2));                      /* update the stats */
     
-    res = a_mcp9808_iic_read(handle, MCP9808_REG_TEMPERATURE, buf, 2);        /* get temperature */
-    if (res != 0)                                                             /* check result */
+    return res;                                                                   /* return the status */
+}
+
+/**
+ * @brief     wait before a retry
+ * @param[in] *handle pointer to a mcp9808 handle structure
+ * @param[in] attempt retry index from 0
+ * @note      the backoff doubles after every retry
+ */
+static void a_mcp9808_retry_wait(mcp9808_handle_t *handle, uint8_t attempt)
+{
+    if ((handle->retry_backoff_ms != 0) && (handle->delay_ms != NULL))            /* check the backoff */
     {
-        handle->debug_print("mcp9808: get temperature failed.\n");            /* get temperature failed */
+        handle->delay_ms((uint32_t)handle->retry_backoff_ms << attempt);          /* wait */
+    }
+    handle->retry_counter.retry++;                                                /* count the retry */
+}
+
+/**
+ * @brief      read bytes
+ * @param[in]  *handle pointer to a mcp9808 handle structure
+ * @param[in]  reg iic register address
+ * @param[out] *data pointer to a data buffer
+ * @param[in]  len data length
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       a failed read is retried by the retry policy
+ */
+static uint8_t a_mcp9808_iic_read(mcp9808_handle_t *handle, uint8_t reg, uint8_t *data, uint16_t len)
+{
+    uint8_t i;
+    
+    MCP9808_PROBE3(iic_read_entry, handle->iic_addr, reg, len);                   /* probe the entry */
+    if (a_mcp9808_iic_read_once(handle, reg, data, len) == 0)                     /* read */
+    {
+        MCP9808_PROBE4(iic_read_return, handle->iic_addr, reg, len, 0);           /* probe the return */
         
-        return 1;                                                             /* return error */
+        return 0;                                                                 /* success return 0 */
     }
-    prev = (uint16_t)((uint16_t)buf[0] << 8) | buf[1];                        /* set raw data */
-    if ((prev & (1 << 15)) != 0)                                              /* check critical temperature bit */
+    handle->retry_counter.read_error++;                                           /* count the error */
+    for (i = 0; i < handle->retry_times; i++)                                     /* retry */
     {
-        if (handle->receive_callback != NULL)                                 /* not null */
+        a_mcp9808_retry_wait(handle, i);                                          /* wait */
+        if (a_mcp9808_iic_read_once(handle, reg, data, len) == 0)                 /* read again */
         {
-            handle->receive_callback((uint8_t)MCP9808_STATUS_CRIT);           /* run the callback */
+            handle->retry_counter.recovered++;                                    /* count the recovery */
+            MCP9808_PROBE4(iic_read_return, handle->iic_addr, reg, len, 0);       /* probe the return */
+            
+            return 0;                                                             /* success return 0 */
         }
+        handle->retry_counter.read_error++;                                       /* count the error */
+    }
+    handle->retry_counter.exhausted++;                                            /* count the failure */
+    MCP9808_PROBE4(iic_read_return, handle->iic_addr, reg, len, 1);               /* probe the return */
+    
+    return 1;                                                                     /* return error */
+}
+
+/**
+ * @brief     write bytes
+ * @param[in] *handle pointer to a mcp9808 handle structure
+ * @param[in] reg iic register address
+ * @param[in] *data pointer to a data buffer
+ * @param[in] len data length
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      a failed write is retried by the retry policy, every register write is idempotent
+ */
+static uint8_t a_mcp9808_iic_write(mcp9808_handle_t *handle, uint8_t reg, uint8_t *data, uint16_t len)
+{
+    uint8_t i;
+    
+    MCP9808_PROBE3(iic_write_entry, handle->iic_addr, reg, len);                  /* probe the entry */
+    if (a_mcp9808_iic_write_once(handle, reg, data, len) == 0)                    /* write */
+    {
+        MCP9808_PROBE4(iic_write_return, handle->iic_addr, reg, len, 0);          /* probe the return */
+        
+        return 0;                                                                 /* success return 0 */
     }
-    if ((prev & (1 << 14)) != 0)                                              /* check temperature upper bit */
+    handle->retry_counter.write_error++;                                          /* count the error */
+    for (i = 0; i < handle->retry_times; i++)                                     /* retry */
     {
-        if (handle->receive_callback != NULL)                                 /* not null */
+        a_mcp9808_retry_wait(handle, i);                                          /* wait */
+        if (a_mcp9808_iic_write_once(handle, reg, data, len) == 0)                /* write again */
         {
-            handle->receive_callback((uint8_t)MCP9808_STATUS_T_UPPER);        /* run the callback */
+            handle->retry_counter.recovered++;                                    /* count the recovery */
+            MCP9808_PROBE4(iic_write_return, handle->iic_addr, reg, len, 0);      /* probe the return */
+            
+            return 0;                                                             /* success return 0 */
         }
+        handle->retry_counter.write_error++;                                      /* count the error */
+    }
+    handle->retry_counter.exhausted++;                                            /* count the failure */
+    MCP9808_PROBE4(iic_write_return, handle->iic_addr, reg, len, 1);              /* probe the return */
+    
+    return 1;                                                                     /* return error */
+}
+
+/**
+ * @brief      read a batch
+ * @param[in]  *handle pointer to the first mcp9808 handle structure
+ * @param[in]  *addr pointer to an iic device address list
+ * @param[in]  *reg pointer to an iic register address list
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  num device number
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       a failed batch is retried as a whole by the retry policy of the first handle
+ */
+static uint8_t a_mcp9808_iic_read_batch(mcp9808_handle_t *handle, uint8_t *addr, uint8_t *reg,
+                                        uint8_t *buf, uint8_t num)
+{
+    uint8_t i;
+    
+    if (a_mcp9808_iic_read_batch_once(handle, addr, reg, buf, num) == 0)          /* read */
+    {
+        return 0;                                                                 /* success return 0 */
     }
-    if ((prev & (1 << 13)) != 0)                                              /* check temperature lower bit */
+    handle->retry_counter.batch_error++;                                          /* count the error */
+    for (i = 0; i < handle->retry_times; i++)                                     /* retry */
     {
-        if (handle->receive_callback != NULL)                                 /* not null */
+        a_mcp9808_retry_wait(handle, i);                                          /* wait */
+        if (a_mcp9808_iic_read_batch_once(handle, addr, reg, buf, num) == 0)      /* read again */
         {
-            handle->receive_callback((uint8_t)MCP9808_STATUS_T_LOWER);        /* run the callback */
+            handle->retry_counter.recovered++;                                    /* count the recovery */
+            
+            return 0;                                                             /* success return 0 */
         }
+        handle->retry_counter.batch_error++;                                      /* count the error */
     }
+    handle->retry_counter.exhausted++;                                            /* count the failure */
     
-    res = a_mcp9808_iic_read(handle, MCP9808_REG_CONFIG, buf, 2);             /* get config */
-    if (res != 0)                                                             /* check result */
+    return 1;                                                                     /* return error */
+}
+
+/**
+ * @brief     model the config register lock rules
+ * @param[in] prev current config
+ * @param[in] config config to be written
+ * @return    config value held by the chip after the write
+ * @note      the status and interrupt clear bits are not kept
+ */
+uint16_t mcp9808_config_filter(uint16_t prev, uint16_t config)
+{
+    if ((prev & MCP9808_CONFIG_LOCK_MASK) != 0)                                                     /* check the lock bits */
     {
-        handle->debug_print("mcp9808: get config failed.\n");                 /* get config failed */
-        
-        return 1;                                                             /* return error */
+        config &= (uint16_t)(~MCP9808_CONFIG_LOCKED_MASK);                                          /* clear the locked bits */
+        config |= prev & MCP9808_CONFIG_LOCKED_MASK;                                                /* keep the locked bits */
+        config &= (uint16_t)(prev | (uint16_t)(~(1U << 8)));                                        /* shutdown can only be cleared */
     }
-    prev = (uint16_t)((uint16_t)buf[0] << 8) | buf[1];                        /* set raw data */
-    prev &= ~(1 << 5);                                                        /* clear settings */
-    prev |= 1 << 5;                                                           /* set enable */
-    buf[0] = (prev >> 8) & 0xFF;                                              /* set msb */
-    buf[1] = (prev >> 0) & 0xFF;                                              /* set lsb */
-    res = a_mcp9808_iic_write(handle, MCP9808_REG_CONFIG, buf, 2);            /* set config */
-    if (res != 0)                                                             /* check result */
+    if ((prev & (1U << 6)) != 0)                                                                    /* check the window lock bit */
     {
-        handle->debug_print("mcp9808: set config failed.\n");                 /* set config failed */
+        config &= (uint16_t)(~MCP9808_CONFIG_WINDOW_LOCKED_MASK);                                   /* clear the alert select bit */
+        config |= prev & MCP9808_CONFIG_WINDOW_LOCKED_MASK;                                         /* keep the alert select bit */
+    }
+    config |= prev & MCP9808_CONFIG_LOCK_MASK;                                                      /* lock bits are cleared by reset only */
+    
+    return config & MCP9808_CONFIG_CACHE_MASK;                                                      /* return the config */
+}
+
+/**
+ * @brief      read the config register
+ * @param[in]  *handle pointer to a mcp9808 handle structure
+ * @param[out] *config pointer to a config buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the cached config is used when the cache is enabled and valid
+ */
+static uint8_t a_mcp9808_config_read(mcp9808_handle_t *handle, uint16_t *config)
+{
+    uint8_t buf[2];
+    
+    if ((handle->cache_enable != 0) && (handle->config_valid != 0))        /* check the cache */
+    {
+        *config = handle->config;                                          /* get the cache */
         
-        return 1;                                                             /* return error */
+        return 0;                                                          /* success return 0 */
+    }
+    if (a_mcp9808_iic_read(handle, MCP9808_REG_CONFIG, buf, 2) != 0)       /* read config */
+    {
+        return 1;                                                          /* return error */
+    }
+    *config = (uint16_t)((uint16_t)buf[0] << 8) | buf[1];                  /* set config */
+    if (handle->cache_enable != 0)                                         /* check the cache */
+    {
+        handle->config = *config & MCP9808_CONFIG_CACHE_MASK;              /* update the cache */
+        handle->config_valid = 1;                                          /* set valid */
     }
     
-    return 0;                                                                 /* success return 0 */
+    return 0;                                                              /* success return 0 */
 }
 
 /**
- * @brief     initialize the chip
+ * @brief     write the config register
  * @param[in] *handle pointer to a mcp9808 handle structure
+ * @param[in] config written config
  * @return    status code
  *            - 0 success
- *            - 1 iic initialization failed
- *            - 2 handle is NULL
- *            - 3 linked functions is NULL
- *            - 4 read id failed
- *            - 5 id is invalid
- * @note      none
+ *            - 1 write failed
+ * @note      the cache is written through and dropped on failure
  */
-uint8_t mcp9808_init(mcp9808_handle_t *handle)
+static uint8_t a_mcp9808_config_write(mcp9808_handle_t *handle, uint16_t config)
 {
-    uint8_t res;
-    uint16_t id;
     uint8_t buf[2];
     
-    if (handle == NULL)                                                           /* check handle */
+    buf[0] = (config >> 8) & 0xFF;                                                  /* set msb */
+    buf[1] = (config >> 0) & 0xFF;                                                  /* set lsb */
+    if (a_mcp9808_iic_write(handle, MCP9808_REG_CONFIG, buf, 2) != 0)               /* write config */
     {
-        return 2;                                                                 /* return error */
+        handle->config_valid = 0;                                                   /* the chip state is unknown */
+        
+        return 1;                                                                   /* return error */
     }
-    if (handle->debug_print == NULL)                                              /* check debug_print */
+    if ((handle->cache_enable != 0) && (handle->config_valid != 0))                 /* check the cache */
     {
-        return 3;                                                                 /* return error */
+        handle->config = mcp9808_config_filter(handle->config, config);            /* update the cache */
     }
-    if (handle->iic_init == NULL)                                                 /* check iic_init */
+    
+    return 0;                                                                       /* success return 0 */
+}
+
+/**
+ * @brief     check whether a threshold register is locked
+ * @param[in] *handle pointer to a mcp9808 handle structure
+ * @param[in] reg threshold register address
+ * @return    status code
+ *            - 0 unlocked
+ *            - 1 locked or unknown
+ * @note      none
+ */
+static uint8_t a_mcp9808_threshold_locked(mcp9808_handle_t *handle, uint8_t reg)
+{
+    if (handle->config_valid == 0)                                     /* check the config cache */
     {
-        handle->debug_print("mcp9808: iic_init is null.\n");                      /* iic_init is null */
-       
-        return 3;                                                                 /* return error */
+        return 1;                                                      /* unknown */
     }
-    if (handle->iic_deinit == NULL)                                               /* check iic_deinit */
+    if (reg == MCP9808_REG_CRIT)                                       /* critical temperature */
     {
-        handle->debug_print("mcp9808: iic_deinit is null.\n");                    /* iic_deinit is null */
-       
-        return 3;                                                                 /* return error */
+        return (uint8_t)((handle->config >> 7) & 0x01);                /* critical temperature lock */
     }
-    if (handle->iic_read == NULL)                                                 /* check iic_read */
+    else                                                               /* upper and lower threshold */
     {
-        handle->debug_print("mcp9808: iic_read is null.\n");                      /* iic_read is null */
-       
-        return 3;                                                                 /* return error */
+        return (uint8_t)((handle->config >> 6) & 0x01);                /* window lock */
     }
-    if (handle->iic_write == NULL)                                                /* check iic_write */
+}
+
+/**
+ * @brief      read a threshold register
+ * @param[in]  *handle pointer to a mcp9808 handle structure
+ * @param[in]  reg threshold register address
+ * @param[out] *raw pointer to a raw data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the cached threshold is used when the cache is enabled and valid
+ */
+static uint8_t a_mcp9808_threshold_read(mcp9808_handle_t *handle, uint8_t reg, uint16_t *raw)
+{
+    uint8_t index;
+    uint16_t prev;
+    uint8_t buf[2];
+    
+    index = (uint8_t)(reg - MCP9808_REG_ALERT_UPPER);                                  /* get the cache index */
+    if ((handle->cache_enable != 0) && (((handle->threshold_valid >> index) & 0x01) != 0))        /* check the cache */
     {
-        handle->debug_print("mcp9808: iic_write is null.\n");                     /* iic_write is null */
-       
-        return 3;                                                                 /* return error */
+        *raw = handle->threshold[index];                                               /* get the cache */
+        
+        return 0;                                                                      /* success return 0 */
     }
-    if (handle->delay_ms == NULL)                                                 /* check delay_ms */
+    if (a_mcp9808_iic_read(handle, reg, buf, 2) != 0)                                  /* read threshold */
     {
-        handle->debug_print("mcp9808: delay_ms is null.\n");                      /* delay_ms is null */
-       
-        return 3;                                                                 /* return error */
+        return 1;                                                                      /* return error */
     }
-    if (handle->receive_callback == NULL)                                         /* check receive_callback */
+    prev = (uint16_t)((uint16_t)buf[0] << 8) | buf[1];                                 /* set raw data */
+    *raw = (prev >> 2) & 0x7FF;                                                        /* set output data */
+    if (handle->cache_enable != 0)                                                     /* check the cache */
     {
-        handle->debug_print("mcp9808: receive_callback is null.\n");              /* receive_callback is null */
-       
-        return 3;                                                                 /* return error */
+        handle->threshold[index] = *raw;                                               /* update the cache */
+        handle->threshold_valid |= (uint8_t)(1 << index);                              /* set valid */
+    }
+    
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief     write a threshold register
+ * @param[in] *handle pointer to a mcp9808 handle structure
+ * @param[in] reg threshold register address
+ * @param[in] raw raw data
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      the cache is written through and dropped on failure or when the lock state is unknown
+ */
+static uint8_t a_mcp9808_threshold_write(mcp9808_handle_t *handle, uint8_t reg, uint16_t raw)
+{
+    uint8_t index;
+    uint16_t prev;
+    uint8_t buf[2];
+    
+    index = (uint8_t)(reg - MCP9808_REG_ALERT_UPPER);                         /* get the cache index */
+    prev = (raw & 0x7FF) << 2;                                                /* set data */
+    buf[0] = (prev >> 8) & 0xFF;                                              /* set msb */
+    buf[1] = (prev >> 0) & 0xFF;                                              /* set lsb */
+    if (a_mcp9808_iic_write(handle, reg, buf, 2) != 0)                        /* write threshold */
+    {
+        handle->threshold_valid &= (uint8_t)(~(1 << index));                  /* the chip state is unknown */
+        
+        return 1;                                                             /* return error */
+    }
+    if (handle->cache_enable != 0)                                            /* check the cache */
+    {
+        if (a_mcp9808_threshold_locked(handle, reg) == 0)                     /* the write has been accepted */
+        {
+            handle->threshold[index] = raw & 0x7FF;                           /* update the cache */
+            handle->threshold_valid |= (uint8_t)(1 << index);                 /* set valid */
+        }
+        else if (handle->config_valid == 0)                                   /* the lock state is unknown */
+        {
+            handle->threshold_valid &= (uint8_t)(~(1 << index));              /* invalidate the cache */
+        }
+        else
+        {
+            /* the locked register ignores the write */
+        }
+    }
+    
+    return 0;                                                                 /* success return 0 */
+}
+
+/**
+ * @brief     decode the temperature register
+ * @param[in] prev temperature register value
+ * @return    signed raw temperature
+ * @note      the alert flags are dropped
+ */
+static int16_t a_mcp9808_raw_decode(uint16_t prev)
+{
+    prev &= ~(7 << 13);                                                       /* clear flags */
+    if ((prev & (1 << 12)) != 0)                                              /* check signed bit */
+    {
+        return (int16_t)((uint16_t)(prev | (uint16_t)(0x7 << 13)));           /* set signed bits */
+    }
+    
+    return (int16_t)prev;                                                     /* return data */
+}
+
+/**
+ * @brief      read the raw temperature
+ * @param[in]  *handle pointer to a mcp9808 handle structure
+ * @param[out] *raw pointer to a raw data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+static uint8_t a_mcp9808_read_raw(mcp9808_handle_t *handle, int16_t *raw)
+{
+    uint8_t buf[2];
+    
+    if (a_mcp9808_iic_read(handle, MCP9808_REG_TEMPERATURE, buf, 2) != 0)     /* get temperature */
+    {
+        return 1;                                                             /* return error */
+    }
+    *raw = a_mcp9808_raw_decode((uint16_t)((uint16_t)buf[0] << 8) | buf[1]);  /* save data */
+    
+    return 0;                                                                 /* success return 0 */
+}
+
+/**
+ * @brief      read the resolution register
+ * @param[in]  *handle pointer to a mcp9808 handle structure
+ * @param[out] *resolution pointer to a resolution buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the cached resolution is used when the cache is enabled and valid,
+ *             the read value is always kept for the scheduled read
+ */
+static uint8_t a_mcp9808_resolution_read(mcp9808_handle_t *handle, uint8_t *resolution)
+{
+    if ((handle->cache_enable != 0) && (handle->resolution_valid != 0))          /* check the cache */
+    {
+        *resolution = handle->resolution;                                        /* get the cache */
+        
+        return 0;                                                                /* success return 0 */
+    }
+    if (a_mcp9808_iic_read(handle, MCP9808_REG_RESOLUTION, resolution, 1) != 0)  /* read resolution */
+    {
+        return 1;                                                                /* return error */
+    }
+    handle->resolution = *resolution;                                            /* save the resolution */
+    handle->resolution_valid = 1;                                                /* set valid */
+    
+    return 0;                                                                    /* success return 0 */
+}
+
+/**
+ * @brief      get the resolution of the scheduled read
+ * @param[in]  *handle pointer to a mcp9808 handle structure
+ * @param[out] *resolution pointer to a resolution buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the bus is read only when the resolution is unknown, whatever the cache mode
+ */
+static uint8_t a_mcp9808_sample_resolution(mcp9808_handle_t *handle, uint8_t *resolution)
+{
+    if (handle->resolution_valid != 0)                                           /* check the resolution */
+    {
+        *resolution = handle->resolution;                                        /* get the resolution */
+        
+        return 0;                                                                /* success return 0 */
+    }
+    
+    return a_mcp9808_resolution_read(handle, resolution);                        /* read resolution */
+}
+
+/**
+ * @brief     restart the sample schedule
+ * @param[in] *handle pointer to a mcp9808 handle structure
+ * @param[in] wake 1 if the chip has just left shutdown
+ * @note      after a wake up no sample is available until one conversion has finished
+ */
+static void a_mcp9808_sample_restart(mcp9808_handle_t *handle, uint8_t wake)
+{
+    handle->sample_valid = 0;                                  /* drop the sample */
+    handle->sample_wait = 0;                                   /* clear the wait flag */
+    if ((wake != 0) && (handle->get_time_us != NULL))          /* check the wake up */
+    {
+        handle->sample_time = handle->get_time_us();           /* save the wake up time */
+        handle->sample_wait = 1;                               /* wait for the first conversion */
+    }
+}
+
+/**
+ * @brief     irq handler
+ * @param[in] *handle pointer to a mcp9808 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      receive_callback_ext gets all flags and the temperature in one call,
+ *            the interrupt is cleared from the cached config when the cache is enabled
+ */
+uint8_t mcp9808_irq_handler(mcp9808_handle_t *handle)
+{
+    uint8_t res;
+    uint8_t flags;
+    uint16_t prev;
+    int16_t raw;
+    uint8_t buf[2];
+    uint32_t start;
+    
+    if (handle == NULL)                                                       /* check handle */
+    {
+        return 2;                                                             /* return error */
+    }
+    if (handle->inited != 1)                                                  /* check handle initialization */
+    {
+        return 3;                                                             /* return error */
+    }
+    
+    MCP9808_PROBE1(irq_handler_entry, handle->iic_addr);                      /* probe the entry */
+    start = a_mcp9808_stats_start(handle);                                    /* start timing */
+    res = a_mcp9808_iic_read(handle, MCP9808_REG_TEMPERATURE, buf, 2);        /* get temperature */
+    if (res != 0)                                                             /* check result */
+    {
+        handle->debug_print("mcp9808: get temperature failed.\n");            /* get temperature failed */
+        a_mcp9808_stats_update(handle, MCP9808_STATS_OPERATION_IRQ,
+                               start, 1, 0);                                  /* update the stats */
+        MCP9808_PROBE2(irq_handler_return, handle->iic_addr, 1);              /* probe the return */
+        
+        return 1;                                                             /* return error */
+    }
+    prev = (uint16_t)((uint16_t)buf[0] << 8) | buf[1];                        /* set raw data */
+    flags = (uint8_t)((prev >> 13) & 0x07);                                   /* get flags */
+    raw = a_mcp9808_raw_decode(prev);                                         /* decode temperature */
+    if (handle->receive_callback_ext != NULL)                                 /* not null */
+    {
+        handle->receive_callback_ext(flags, raw);                             /* run the callback once */
+        a_mcp9808_stats_callback(handle);                                     /* count the callback */
+    }
+    else if (handle->receive_callback != NULL)                                /* not null */
+    {
+        if ((flags & MCP9808_STATUS_FLAG_CRIT) != 0)                          /* check critical temperature bit */
+        {
+            handle->receive_callback((uint8_t)MCP9808_STATUS_CRIT);           /* run the callback */
+            a_mcp9808_stats_callback(handle);                                 /* count the callback */
+        }
+        if ((flags & MCP9808_STATUS_FLAG_T_UPPER) != 0)                       /* check temperature upper bit */
+        {
+            handle->receive_callback((uint8_t)MCP9808_STATUS_T_UPPER);        /* run the callback */
+            a_mcp9808_stats_callback(handle);                                 /* count the callback */
+        }
+        if ((flags & MCP9808_STATUS_FLAG_T_LOWER) != 0)                       /* check temperature lower bit */
+        {
+            handle->receive_callback((uint8_t)MCP9808_STATUS_T_LOWER);        /* run the callback */
+            a_mcp9808_stats_callback(handle);                                 /* count the callback */
+        }
+    }
+    else
+    {
+        /* do nothing */
+    }
+    
+    res = a_mcp9808_config_read(handle, &prev);                               /* get config */
+    if (res != 0)                                                             /* check result */
+    {
+        handle->debug_print("mcp9808: get config failed.\n");                 /* get config failed */
+        a_mcp9808_stats_update(handle, MCP9808_STATS_OPERATION_IRQ,
+                               start, 1, 0);                                  /* update the stats */
+        MCP9808_PROBE2(irq_handler_return, handle->iic_addr, 1);              /* probe the return */
+        
+        return 1;                                                             /* return error */
+    }
+    prev &= ~(1 << 5);                                                        /* clear settings */
+    prev |= 1 << 5;                                                           /* set enable */
+    res = a_mcp9808_config_write(handle, prev);                               /* set config */
+    if (res != 0)                                                             /* check result */
+    {
+        handle->debug_print("mcp9808: set config failed.\n");                 /* set config failed */
+        a_mcp9808_stats_update(handle, MCP9808_STATS_OPERATION_IRQ,
+                               start, 1, 0);                                  /* update the stats */
+        MCP9808_PROBE2(irq_handler_return, handle->iic_addr, 1);              /* probe the return */
+        
+        return 1;                                                             /* return error */
+    }
+    a_mcp9808_stats_update(handle, MCP9808_STATS_OPERATION_IRQ,
+                           start, 0, 0);                                      /* update the stats */
+    MCP9808_PROBE2(irq_handler_return, handle->iic_addr, 0);                  /* probe the return */
+    
+    return 0;                                                                 /* success return 0 */
+}
+
+/**
+ * @brief     initialize the chip
+ * @param[in] *handle pointer to a mcp9808 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic initialization failed
+ *            - 2 handle is NULL
+ *            - 3 linked functions is NULL
+ *            - 4 read id failed
+ *            - 5 id is invalid
+ * @note      none
+ */
+uint8_t mcp9808_init(mcp9808_handle_t *handle)
+{
+    uint8_t res;
+    uint16_t id;
+    uint8_t buf[2];
+    
+    if (handle == NULL)                                                           /* check handle */
+    {
+        return 2;                                                                 /* return error */
+    }
+    if (handle->debug_print == NULL)                                              /* check debug_print */
+    {
+        return 3;                                                                 /* return error */
+    }
+    if (handle->iic_init == NULL)                                                 /* check iic_init */
+    {
+        handle->debug_print("mcp9808: iic_init is null.\n");                      /* iic_init is null */
+        
+        return 3;                                                                 /* return error */
+    }
+    if (handle->iic_deinit == NULL)                                               /* check iic_deinit */
+    {
+        handle->debug_print("mcp9808: iic_deinit is null.\n");                    /* iic_deinit is null */
+        
+        return 3;                                                                 /* return error */
+    }
+    if ((handle->iic_read == NULL) && (handle->iic_read_ctx == NULL))             /* check iic_read */
+    {
+        handle->debug_print("mcp9808: iic_read is null.\n");                      /* iic_read is null */
+        
+        return 3;                                                                 /* return error */
+    }
+    if ((handle->iic_write == NULL) && (handle->iic_write_ctx == NULL))           /* check iic_write */
+    {
+        handle->debug_print("mcp9808: iic_write is null.\n");                     /* iic_write is null */
+        
+        return 3;                                                                 /* return error */
+    }
+    if (handle->delay_ms == NULL)                                                 /* check delay_ms */
+    {
+        handle->debug_print("mcp9808: delay_ms is null.\n");                      /* delay_ms is null */
+        
+        return 3;                                                                 /* return error */
+    }
+    if ((handle->receive_callback == NULL) &&
+        (handle->receive_callback_ext == NULL))                                   /* check receive_callback */
+    {
+        handle->debug_print("mcp9808: receive_callback is null.\n");              /* receive_callback is null */
+        
+        return 3;                                                                 /* return error */
     }
     
     if (handle->iic_init() != 0)                                                  /* iic init */
     {
         handle->debug_print("mcp9808: iic init failed.\n");                       /* iic init failed */
-       
+        
         return 1;                                                                 /* return error */
     }
+    handle->pointer_valid = 0;                                                    /* invalidate the register pointer */
     
     res = a_mcp9808_iic_read(handle, MCP9808_REG_MANUFACTURER_ID, buf, 2);        /* get manufacturer id */
     if (res != 0)                                                                 /* check result */
@@ -261,645 +930,1142 @@ uint8_t mcp9808_init(mcp9808_handle_t *handle)
     id = (uint16_t)((uint16_t)buf[0] << 8) | buf[1];                              /* set id */
     if (id != 0x0054U)                                                            /* check id */
     {
-        handle->debug_print("mcp9808: manufacturer id is invalid.\n");            /* manufacturer id is invalid */
-        (void)handle->iic_deinit();                                               /* iic deinit */
-        
-        return 5;                                                                 /* return error */
+        handle->debug_print("mcp9808: manufacturer id is invalid.\n");            /* manufacturer id is invalid */
+        (void)handle->iic_deinit();                                               /* iic deinit */
+        
+        return 5;                                                                 /* return error */
+    }
+    
+    res = a_mcp9808_iic_read(handle, MCP9808_REG_DEVICE_ID, buf, 2);              /* get device id */
+    if (res != 0)                                                                 /* check result */
+    {
+        handle->debug_print("mcp9808: get device id failed.\n");                  /* get device id failed */
+        (void)handle->iic_deinit();                                               /* iic deinit */
+        
+        return 4;                                                                 /* return error */
+    }
+    id = (uint16_t)((uint16_t)buf[0] << 8) | buf[1];                              /* set id */
+    if ((id & 0xFF00U) != 0x0400U)                                                /* check id */
+    {
+        handle->debug_print("mcp9808: device id is invalid.\n");                  /* device id is invalid */
+        (void)handle->iic_deinit();                                               /* iic deinit */
+        
+        return 5;                                                                 /* return error */
+    }
+    
+    handle->config_valid = 0;                                                     /* invalidate the config cache */
+    handle->threshold_valid = 0;                                                  /* invalidate the threshold cache */
+    handle->resolution_valid = 0;                                                 /* invalidate the resolution cache */
+    handle->sample_valid = 0;                                                     /* invalidate the scheduled sample */
+    handle->sample_wait = 0;                                                      /* clear the wait flag */
+    handle->inited = 1;                                                           /* flag finish initialization */
+    
+    return 0;                                                                     /* success return 0 */
+}
+
+/**
+ * @brief     close the chip
+ * @param[in] *handle pointer to a mcp9808 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic deinit failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 shut down failed
+ * @note      none
+ */
+uint8_t mcp9808_deinit(mcp9808_handle_t *handle)
+{
+    uint8_t res;
+    uint16_t prev;
+    
+    if (handle == NULL)                                                   /* check handle */
+    {
+        return 2;                                                         /* return error */
+    }
+    if (handle->inited != 1)                                              /* check handle initialization */
+    {
+        return 3;                                                         /* return error */
+    }
+    
+    res = a_mcp9808_config_read(handle, &prev);                           /* get config */
+    if (res != 0)                                                         /* check result */
+    {
+        handle->debug_print("mcp9808: get config failed.\n");             /* get config failed */
+        
+        return 4;                                                         /* return error */
+    }
+    prev &= ~(1 << 8);                                                    /* clear settings */
+    prev |= 1 << 8;                                                       /* set bool */
+    res = a_mcp9808_config_write(handle, prev);                           /* set config */
+    if (res != 0)                                                         /* check result */
+    {
+        handle->debug_print("mcp9808: set config failed.\n");             /* set config failed */
+        
+        return 4;                                                         /* return error */
+    }
+    if (handle->iic_deinit() != 0)                                        /* iic deinit */
+    {
+        handle->debug_print("mcp9808: iic deinit failed.\n");             /* iic deinit failed */
+        
+        return 1;                                                         /* return error */
+    }
+    handle->inited = 0;                                                   /* flag close */
+    
+    return 0;                                                             /* success return 0 */
+}
+
+/**
+ * @brief     set the iic address
+ * @param[in] *handle pointer to a mcp9808 handle structure
+ * @param[in] addr chip iic address
+ * @return    status code
+ *            - 0 success
+ *            - 1 set addr failed
+ *            - 2 handle is NULL
+ * @note      the register pointer, the caches and the scheduled sample of the previous chip are dropped
+ */
+uint8_t mcp9808_set_addr(mcp9808_handle_t *handle, mcp9808_address_t addr)
+{
+    if (handle == NULL)                      /* check handle */
+    {
+        return 2;                            /* return error */
+    }
+    
+    handle->iic_addr = (uint8_t)addr;        /* set address */
+    handle->config_valid = 0;                /* invalidate the config cache */
+    handle->threshold_valid = 0;             /* invalidate the threshold cache */
+    handle->pointer_valid = 0;               /* invalidate the register pointer */
+    handle->resolution_valid = 0;            /* invalidate the resolution cache */
+    handle->sample_valid = 0;                /* invalidate the scheduled sample */
+    
+    return 0;                                /* success return 0 */
+}
+
+/**
+ * @brief      get the iic address
+ * @param[in]  *handle pointer to a mcp9808 handle structure
+ * @param[out] *addr pointer to a chip iic address buffer
+ * @return      status code
+ *              - 0 success
+ *              - 1 get addr failed
+ *              - 2 handle is NULL
+ * @note        none
+ */
+uint8_t mcp9808_get_addr(mcp9808_handle_t *handle, mcp9808_address_t *addr)
+{
+    if (handle == NULL)                                 /* check handle */
+    {
+        return 2;                                       /* return error */
+    }
+    
+    *addr = (mcp9808_address_t)(handle->iic_addr);        /* get address */
+    
+    return 0;                                           /* success return 0 */
+}
+
+/**
+ * @brief      convert the temperature to the register raw data
+ * @param[in]  *handle pointer to a mcp9808 handle structure
+ * @param[in]  temperature_deg temperature in degrees celsius
+ * @param[out] *reg pointer to a register raw buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+#if (MCP9808_USE_FLOAT == 1)
+uint8_t mcp9808_temperature_convert_to_register(mcp9808_handle_t *handle, float temperature_deg, uint16_t *reg)
+{
+    if (handle == NULL)                                                /* check handle */
+    {
+        return 2;                                                      /* return error */
+    }
+    if (handle->inited != 1)                                           /* check handle initialization */
+    {
+        return 3;                                                      /* return error */
+    }
+    
+    if (temperature_deg > 0.0f)                                        /* > 0 */
+    {
+        *reg = (uint16_t)(temperature_deg * 4.0f);                     /* convert real data to register data */
+    }
+    else                                                               /* < 0 */
+    {
+        *reg = (uint16_t)(-temperature_deg * 4.0f) | (1 << 10);        /* convert real data to register data */
+    }
+    
+    return 0;                                                          /* success return 0 */
+}
+
+/**
+ * @brief      convert the register raw data to the temperature
+ * @param[in]  *handle pointer to a mcp9808 handle structure
+ * @param[in]  reg register raw data
+ * @param[out] *temperature_deg pointer to a converted temperature buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t mcp9808_temperature_convert_to_data(mcp9808_handle_t *handle, uint16_t reg, float *temperature_deg)
+{
+    if (handle == NULL)                                  /* check handle */
+    {
+        return 2;                                        /* return error */
+    }
+    if (handle->inited != 1)                             /* check handle initialization */
+    {
+        return 3;                                        /* return error */
+    }
+    
+    if ((reg & (1 << 10)) != 0)                          /* check signed bit */
+    {
+        reg &= ~(1 << 10);                               /* clear sign bit */
+        *temperature_deg = -(float)(reg) * 0.25f;        /* convert raw data to real data */
+    }
+    else
+    {
+        *temperature_deg = (float)(reg) * 0.25f;         /* convert raw data to real data */
+    }
+    
+    return 0;                                            /* success return 0 */
+}
+#endif
+
+/**
+ * @brief      convert the millidegree temperature to the register raw data
+ * @param[in]  *handle pointer to a mcp9808 handle structure
+ * @param[in]  temperature_mc temperature in millidegrees celsius
+ * @param[out] *reg pointer to a register raw buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       integer only
+ */
+uint8_t mcp9808_temperature_convert_to_register_milli_c(mcp9808_handle_t *handle, int32_t temperature_mc, uint16_t *reg)
+{
+    if (handle == NULL)                                                /* check handle */
+    {
+        return 2;                                                      /* return error */
+    }
+    if (handle->inited != 1)                                           /* check handle initialization */
+    {
+        return 3;                                                      /* return error */
+    }
+    
+    if (temperature_mc >= 0)                                           /* >= 0 */
+    {
+        *reg = (uint16_t)(temperature_mc / 250);                       /* convert real data to register data */
+    }
+    else                                                               /* < 0 */
+    {
+        *reg = (uint16_t)(-temperature_mc / 250) | (1 << 10);          /* convert real data to register data */
+    }
+    
+    return 0;                                                          /* success return 0 */
+}
+
+/**
+ * @brief      convert the register raw data to the millidegree temperature
+ * @param[in]  *handle pointer to a mcp9808 handle structure
+ * @param[in]  reg register raw data
+ * @param[out] *temperature_mc pointer to a converted temperature buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       integer only
+ */
+uint8_t mcp9808_temperature_convert_to_data_milli_c(mcp9808_handle_t *handle, uint16_t reg, int32_t *temperature_mc)
+{
+    if (handle == NULL)                                  /* check handle */
+    {
+        return 2;                                        /* return error */
+    }
+    if (handle->inited != 1)                             /* check handle initialization */
+    {
+        return 3;                                        /* return error */
+    }
+    
+    if ((reg & (1 << 10)) != 0)                          /* check signed bit */
+    {
+        reg &= ~(1 << 10);                               /* clear sign bit */
+        *temperature_mc = -(int32_t)(reg) * 250;         /* convert raw data to real data */
+    }
+    else
+    {
+        *temperature_mc = (int32_t)(reg) * 250;          /* convert raw data to real data */
+    }
+    
+    return 0;                                            /* success return 0 */
+}
+
+/**
+ * @brief     set temperature high threshold
+ * @param[in] *handle pointer to a mcp9808 handle structure
+ * @param[in] raw raw data
+ * @return    status code
+ *            - 0 success
+ *            - 1 set temperature high threshold failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 raw > 0x7FF
+ * @note      none
+ */
+uint8_t mcp9808_set_temperature_high_threshold(mcp9808_handle_t *handle, uint16_t raw)
+{
+    uint8_t res;
+    
+    if (handle == NULL)                                                                  /* check handle */
+    {
+        return 2;                                                                        /* return error */
+    }
+    if (handle->inited != 1)                                                             /* check handle initialization */
+    {
+        return 3;                                                                        /* return error */
+    }
+    if (raw > 0x7FF)                                                                     /* check result */
+    {
+        handle->debug_print("mcp9808: raw > 0x7FF.\n");                                  /* raw > 0x7FF */
+        
+        return 4;                                                                        /* return error */
+    }
+    
+    res = a_mcp9808_threshold_write(handle, MCP9808_REG_ALERT_UPPER, raw);               /* set threshold */
+    if (res != 0)                                                                        /* check result */
+    {
+        handle->debug_print("mcp9808: set temperature high threshold failed.\n");        /* set temperature high threshold failed */
+        
+        return 1;                                                                        /* return error */
+    }
+    
+    return 0;                                                                            /* success return 0 */
+}
+
+/**
+ * @brief      get temperature high threshold
+ * @param[in]  *handle pointer to a mcp9808 handle structure
+ * @param[out] *raw pointer to a raw data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get temperature high threshold failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t mcp9808_get_temperature_high_threshold(mcp9808_handle_t *handle, uint16_t *raw)
+{
+    uint8_t res;
+    
+    if (handle == NULL)                                                                  /* check handle */
+    {
+        return 2;                                                                        /* return error */
+    }
+    if (handle->inited != 1)                                                             /* check handle initialization */
+    {
+        return 3;                                                                        /* return error */
+    }
+    
+    res = a_mcp9808_threshold_read(handle, MCP9808_REG_ALERT_UPPER, raw);                /* get threshold */
+    if (res != 0)                                                                        /* check result */
+    {
+        handle->debug_print("mcp9808: get temperature high threshold failed.\n");        /* get temperature high threshold failed */
+        
+        return 1;                                                                        /* return error */
+    }
+    
+    return 0;                                                                            /* success return 0 */
+}
+
+/**
+ * @brief     set temperature low threshold
+ * @param[in] *handle pointer to a mcp9808 handle structure
+ * @param[in] raw raw data
+ * @return    status code
+ *            - 0 success
+ *            - 1 set temperature low threshold failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 raw > 0x7FF
+ * @note      none
+ */
+uint8_t mcp9808_set_temperature_low_threshold(mcp9808_handle_t *handle, uint16_t raw)
+{
+    uint8_t res;
+    
+    if (handle == NULL)                                                                  /* check handle */
+    {
+        return 2;                                                                        /* return error */
+    }
+    if (handle->inited != 1)                                                             /* check handle initialization */
+    {
+        return 3;                                                                        /* return error */
+    }
+    if (raw > 0x7FF)                                                                     /* check result */
+    {
+        handle->debug_print("mcp9808: raw > 0x7FF.\n");                                  /* raw > 0x7FF */
+        
+        return 4;                                                                        /* return error */
+    }
+    
+    res = a_mcp9808_threshold_write(handle, MCP9808_REG_ALERT_LOWER, raw);               /* set threshold */
+    if (res != 0)                                                                        /* check result */
+    {
+        handle->debug_print("mcp9808: set temperature low threshold failed.\n");         /* set temperature low threshold failed */
+        
+        return 1;                                                                        /* return error */
+    }
+    
+    return 0;                                                                            /* success return 0 */
+}
+
+/**
+ * @brief      get temperature low threshold
+ * @param[in]  *handle pointer to a mcp9808 handle structure
+ * @param[out] *raw pointer to a raw data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get temperature low threshold failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t mcp9808_get_temperature_low_threshold(mcp9808_handle_t *handle, uint16_t *raw)
+{
+    uint8_t res;
+    
+    if (handle == NULL)                                                                  /* check handle */
+    {
+        return 2;                                                                        /* return error */
     }
-    
-    res = a_mcp9808_iic_read(handle, MCP9808_REG_DEVICE_ID, buf, 2);              /* get device id */
-    if (res != 0)                                                                 /* check result */
+    if (handle->inited != 1)                                                             /* check handle initialization */
     {
-        handle->debug_print("mcp9808: get device id failed.\n");                  /* get device id failed */
-        (void)handle->iic_deinit();                                               /* iic deinit */
-        
-        return 4;                                                                 /* return error */
+        return 3;                                                                        /* return error */
     }
-    id = (uint16_t)((uint16_t)buf[0] << 8) | buf[1];                              /* set id */
-    if ((id & 0xFF00U) != 0x0400U)                                                /* check id */
+    
+    res = a_mcp9808_threshold_read(handle, MCP9808_REG_ALERT_LOWER, raw);                /* get threshold */
+    if (res != 0)                                                                        /* check result */
     {
-        handle->debug_print("mcp9808: device id is invalid.\n");                  /* device id is invalid */
-        (void)handle->iic_deinit();                                               /* iic deinit */
+        handle->debug_print("mcp9808: get temperature low threshold failed.\n");         /* get temperature low threshold failed */
         
-        return 5;                                                                 /* return error */
+        return 1;                                                                        /* return error */
     }
     
-    handle->inited = 1;                                                           /* flag finish initialization */
-    
-    return 0;                                                                     /* success return 0 */
+    return 0;                                                                            /* success return 0 */
 }
 
 /**
- * @brief     close the chip
+ * @brief     set critical temperature
  * @param[in] *handle pointer to a mcp9808 handle structure
+ * @param[in] raw raw data
  * @return    status code
  *            - 0 success
- *            - 1 iic deinit failed
+ *            - 1 set critical temperature failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 shut down failed
+ *            - 4 raw > 0x7FF
  * @note      none
  */
-uint8_t mcp9808_deinit(mcp9808_handle_t *handle)
+uint8_t mcp9808_set_critical_temperature(mcp9808_handle_t *handle, uint16_t raw)
 {
     uint8_t res;
-    uint16_t prev;
-    uint8_t buf[2];
     
-    if (handle == NULL)                                                   /* check handle */
+    if (handle == NULL)                                                            /* check handle */
     {
-        return 2;                                                         /* return error */
+        return 2;                                                                  /* return error */
     }
-    if (handle->inited != 1)                                              /* check handle initialization */
+    if (handle->inited != 1)                                                       /* check handle initialization */
     {
-        return 3;                                                         /* return error */
+        return 3;                                                                  /* return error */
     }
-    
-    res = a_mcp9808_iic_read(handle, MCP9808_REG_CONFIG, buf, 2);         /* get config */
-    if (res != 0)                                                         /* check result */
+    if (raw > 0x7FF)                                                               /* check result */
     {
-        handle->debug_print("mcp9808: get config failed.\n");             /* get config failed */
+        handle->debug_print("mcp9808: raw > 0x7FF.\n");                            /* raw > 0x7FF */
         
-        return 4;                                                         /* return error */
+        return 4;                                                                  /* return error */
     }
-    prev = (uint16_t)((uint16_t)buf[0] << 8) | buf[1];                    /* set raw data */
-    prev &= ~(1 << 8);                                                    /* clear settings */
-    prev |= 1 << 8;                                                       /* set bool */
-    buf[0] = (prev >> 8) & 0xFF;                                          /* set msb */
-    buf[1] = (prev >> 0) & 0xFF;                                          /* set lsb */
-    res = a_mcp9808_iic_write(handle, MCP9808_REG_CONFIG, buf, 2);        /* set config */
-    if (res != 0)                                                         /* check result */
+    
+    res = a_mcp9808_threshold_write(handle, MCP9808_REG_CRIT, raw);                /* set temperature */
+    if (res != 0)                                                                  /* check result */
     {
-        handle->debug_print("mcp9808: set config failed.\n");             /* set config failed */
+        handle->debug_print("mcp9808: set critical temperature failed.\n");        /* set critical temperature failed */
         
-        return 4;                                                         /* return error */
-    }
-    if (handle->iic_deinit() != 0)                                        /* iic deinit */
-    {
-        handle->debug_print("mcp9808: iic deinit failed.\n");             /* iic deinit failed */
-       
-        return 1;                                                         /* return error */
+        return 1;                                                                  /* return error */
     }
-    handle->inited = 0;                                                   /* flag close */
     
-    return 0;                                                             /* success return 0 */
+    return 0;                                                                      /* success return 0 */
 }
 
 /**
- * @brief     set the iic address
- * @param[in] *handle pointer to a mcp9808 handle structure
- * @param[in] addr chip iic address
- * @return    status code
- *            - 0 success
- *            - 1 set addr failed
- *            - 2 handle is NULL
- * @note      none
+ * @brief      get critical temperature
+ * @param[in]  *handle pointer to a mcp9808 handle structure
+ * @param[out] *raw pointer to a raw data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get critical temperature failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
  */
-uint8_t mcp9808_set_addr(mcp9808_handle_t *handle, mcp9808_address_t addr)
+uint8_t mcp9808_get_critical_temperature(mcp9808_handle_t *handle, uint16_t *raw)
 {
-    if (handle == NULL)                      /* check handle */
+    uint8_t res;
+    
+    if (handle == NULL)                                                            /* check handle */
     {
-        return 2;                            /* return error */
+        return 2;                                                                  /* return error */
+    }
+    if (handle->inited != 1)                                                       /* check handle initialization */
+    {
+        return 3;                                                                  /* return error */
     }
     
-    handle->iic_addr = (uint8_t)addr;        /* set address */
+    res = a_mcp9808_threshold_read(handle, MCP9808_REG_CRIT, raw);                 /* get temperature */
+    if (res != 0)                                                                  /* check result */
+    {
+        handle->debug_print("mcp9808: get critical temperature failed.\n");        /* get critical temperature failed */
+        
+        return 1;                                                                  /* return error */
+    }
     
-    return 0;                                /* success return 0 */
+    return 0;                                                                      /* success return 0 */
 }
 
 /**
- * @brief      get the iic address
+ * @brief      read temperature
  * @param[in]  *handle pointer to a mcp9808 handle structure
- * @param[out] *addr pointer to a chip iic address buffer
- * @return      status code
- *              - 0 success
- *              - 1 get addr failed
- *              - 2 handle is NULL
- * @note        none
+ * @param[out] *raw pointer to a raw data buffer
+ * @param[out] *temperature_deg pointer to a converted temperature buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
  */
-uint8_t mcp9808_get_addr(mcp9808_handle_t *handle, mcp9808_address_t *addr)
+#if (MCP9808_USE_FLOAT == 1)
+uint8_t mcp9808_read(mcp9808_handle_t *handle, int16_t *raw, float *temperature_deg)
 {
-    if (handle == NULL)                                 /* check handle */
+    uint8_t res;
+    
+    if (handle == NULL)                                                       /* check handle */
     {
-        return 2;                                       /* return error */
+        return 2;                                                             /* return error */
+    }
+    if (handle->inited != 1)                                                  /* check handle initialization */
+    {
+        return 3;                                                             /* return error */
     }
     
-    *addr = (mcp9808_address_t)(handle->iic_addr);        /* get address */
+    MCP9808_PROBE1(read_entry, handle->iic_addr);                             /* probe the entry */
+    res = a_mcp9808_read_raw(handle, raw);                                    /* get temperature */
+    if (res != 0)                                                             /* check result */
+    {
+        handle->debug_print("mcp9808: get temperature failed.\n");            /* get temperature failed */
+        MCP9808_PROBE3(read_return, handle->iic_addr, 0, 1);                  /* probe the return */
+        
+        return 1;                                                             /* return error */
+    }
+    *temperature_deg = (float)(*raw) * 0.0625f;                               /* convert temperature */
+    MCP9808_PROBE3(read_return, handle->iic_addr, *raw, 0);                   /* probe the return */
     
-    return 0;                                           /* success return 0 */
+    return 0;                                                                 /* success return 0 */
 }
+#endif
 
 /**
- * @brief      convert the temperature to the register raw data
+ * @brief      read temperature in millidegrees celsius
  * @param[in]  *handle pointer to a mcp9808 handle structure
- * @param[in]  temperature_deg temperature in degrees celsius
- * @param[out] *reg pointer to a register raw buffer
+ * @param[out] *raw pointer to a raw data buffer
+ * @param[out] *temperature_mc pointer to a converted temperature buffer
  * @return     status code
  *             - 0 success
+ *             - 1 read failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
- * @note       none
+ * @note       integer only, the half millidegree is truncated toward zero
  */
-uint8_t mcp9808_temperature_convert_to_register(mcp9808_handle_t *handle, float temperature_deg, uint16_t *reg)
+uint8_t mcp9808_read_milli_c(mcp9808_handle_t *handle, int16_t *raw, int32_t *temperature_mc)
 {
-    if (handle == NULL)                                                /* check handle */
+    uint8_t res;
+    
+    if (handle == NULL)                                                       /* check handle */
     {
-        return 2;                                                      /* return error */
+        return 2;                                                             /* return error */
     }
-    if (handle->inited != 1)                                           /* check handle initialization */
+    if (handle->inited != 1)                                                  /* check handle initialization */
     {
-        return 3;                                                      /* return error */
+        return 3;                                                             /* return error */
     }
     
-    if (temperature_deg > 0.0f)                                        /* > 0 */
-    {
-        *reg = (uint16_t)(temperature_deg * 4.0f);                     /* convert real data to register data */
-    }
-    else                                                               /* < 0 */
+    MCP9808_PROBE1(read_milli_c_entry, handle->iic_addr);                     /* probe the entry */
+    res = a_mcp9808_read_raw(handle, raw);                                    /* get temperature */
+    if (res != 0)                                                             /* check result */
     {
-        *reg = (uint16_t)(-temperature_deg * 4.0f) | (1 << 10);        /* convert real data to register data */
+        handle->debug_print("mcp9808: get temperature failed.\n");            /* get temperature failed */
+        MCP9808_PROBE3(read_milli_c_return, handle->iic_addr, 0, 1);          /* probe the return */
+        
+        return 1;                                                             /* return error */
     }
+    *temperature_mc = ((int32_t)(*raw) * 125) / 2;                            /* convert temperature, 62.5mC per lsb */
+    MCP9808_PROBE3(read_milli_c_return, handle->iic_addr, *raw, 0);           /* probe the return */
     
-    return 0;                                                          /* success return 0 */
+    return 0;                                                                 /* success return 0 */
 }
 
 /**
- * @brief      convert the register raw data to the temperature
+ * @brief      read temperature no faster than the chip converts
  * @param[in]  *handle pointer to a mcp9808 handle structure
- * @param[in]  reg register raw data
- * @param[out] *temperature_deg pointer to a converted temperature buffer
+ * @param[out] *raw pointer to a raw data buffer
+ * @param[out] *fresh pointer to a fresh flag buffer
+ * @param[out] *next_us pointer to a next fresh sample timestamp buffer
  * @return     status code
  *             - 0 success
+ *             - 1 read failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
- * @note       none
+ *             - 4 get_time_us is null
+ *             - 5 first conversion is not ready
+ * @note       the cached sample is returned until one conversion time has passed
+ *             since the last bus read, next_us is the get_time_us value to sleep until
  */
-uint8_t mcp9808_temperature_convert_to_data(mcp9808_handle_t *handle, uint16_t reg, float *temperature_deg)
+uint8_t mcp9808_read_scheduled(mcp9808_handle_t *handle, int16_t *raw, mcp9808_bool_t *fresh, uint32_t *next_us)
 {
-    if (handle == NULL)                                  /* check handle */
+    uint8_t res;
+    uint8_t resolution;
+    uint32_t now;
+    uint32_t conversion_time;
+    
+    if (handle == NULL)                                                                 /* check handle */
     {
-        return 2;                                        /* return error */
+        return 2;                                                                       /* return error */
     }
-    if (handle->inited != 1)                             /* check handle initialization */
+    if (handle->inited != 1)                                                            /* check handle initialization */
     {
-        return 3;                                        /* return error */
+        return 3;                                                                       /* return error */
+    }
+    if (handle->get_time_us == NULL)                                                    /* check get_time_us */
+    {
+        handle->debug_print("mcp9808: get_time_us is null.\n");                         /* get_time_us is null */
+        
+        return 4;                                                                       /* return error */
     }
     
-    if ((reg & (1 << 10)) != 0)                          /* check signed bit */
+    res = a_mcp9808_sample_resolution(handle, &resolution);                             /* get resolution */
+    if (res != 0)                                                                       /* check result */
     {
-        reg &= ~(1 << 10);                               /* clear sign bit */
-        *temperature_deg = -(float)(reg) * 0.25f;        /* convert raw data to real data */
+        handle->debug_print("mcp9808: get resolution failed.\n");                       /* get resolution failed */
+        
+        return 1;                                                                       /* return error */
+    }
+    conversion_time = gs_conversion_time_us[resolution & 0x03];                         /* get conversion time */
+    now = handle->get_time_us();                                                        /* get current time */
+    if (handle->sample_wait != 0)                                                       /* check the first conversion */
+    {
+        if ((now - handle->sample_time) < conversion_time)                              /* conversion is running */
+        {
+            *next_us = handle->sample_time + conversion_time;                           /* set next time */
+            
+            return 5;                                                                   /* return error */
+        }
+        handle->sample_wait = 0;                                                        /* clear the wait flag */
+    }
+    else if ((handle->sample_valid != 0) &&
+             ((now - handle->sample_time) < conversion_time))                           /* no new conversion yet */
+    {
+        *raw = handle->sample_raw;                                                      /* get the cached sample */
+        *fresh = MCP9808_BOOL_FALSE;                                                    /* not fresh */
+        *next_us = handle->sample_time + conversion_time;                               /* set next time */
+        
+        return 0;                                                                       /* success return 0 */
     }
     else
     {
-        *temperature_deg = (float)(reg) * 0.25f;         /* convert raw data to real data */
+        /* read a new sample */
     }
     
-    return 0;                                            /* success return 0 */
+    res = a_mcp9808_read_raw(handle, raw);                                              /* get temperature */
+    if (res != 0)                                                                       /* check result */
+    {
+        handle->sample_valid = 0;                                                       /* drop the sample */
+        handle->debug_print("mcp9808: get temperature failed.\n");                      /* get temperature failed */
+        
+        return 1;                                                                       /* return error */
+    }
+    handle->sample_raw = *raw;                                                          /* save the sample */
+    handle->sample_time = now;                                                          /* save the sample time */
+    handle->sample_valid = 1;                                                           /* set valid */
+    *fresh = MCP9808_BOOL_TRUE;                                                         /* fresh */
+    *next_us = now + conversion_time;                                                   /* set next time */
+    
+    return 0;                                                                           /* success return 0 */
 }
 
 /**
- * @brief     set temperature high threshold
- * @param[in] *handle pointer to a mcp9808 handle structure
- * @param[in] raw raw data
- * @return    status code
- *            - 0 success
- *            - 1 set temperature high threshold failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- *            - 4 raw > 0x7FF
- * @note      none
+ * @brief      read the temperature of many devices in one bus transfer
+ * @param[in]  **handle pointer to a mcp9808 handle pointer array
+ * @param[in]  num handle number
+ * @param[out] *raw pointer to a raw data array
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 iic_read_batch is null
+ *             - 5 num is invalid
+ * @note       all handles must share one bus, the batch function, retry policy, retry counters
+ *             and debug print of handle[0] are used for the whole transfer,
+ *             num is 1 to MCP9808_READ_BATCH_MAX
  */
-uint8_t mcp9808_set_temperature_high_threshold(mcp9808_handle_t *handle, uint16_t raw)
+uint8_t mcp9808_read_batch(mcp9808_handle_t **handle, uint8_t num, int16_t *raw)
 {
+    uint8_t i;
     uint8_t res;
-    uint16_t prev;
-    uint8_t buf[2];
+    uint8_t addr[MCP9808_READ_BATCH_MAX];
+    uint8_t reg[MCP9808_READ_BATCH_MAX];
+    uint8_t buf[MCP9808_READ_BATCH_MAX * 2];
     
-    if (handle == NULL)                                                                  /* check handle */
+    if (handle == NULL)                                                                 /* check handle */
     {
-        return 2;                                                                        /* return error */
+        return 2;                                                                       /* return error */
     }
-    if (handle->inited != 1)                                                             /* check handle initialization */
+    if ((num == 0) || (num > MCP9808_READ_BATCH_MAX))                                   /* check num */
     {
-        return 3;                                                                        /* return error */
+        return 5;                                                                       /* return error */
     }
-    if (raw > 0x7FF)                                                                     /* check result */
+    for (i = 0; i < num; i++)                                                           /* check all handles */
     {
-        handle->debug_print("mcp9808: raw > 0x7FF.\n");                                  /* raw > 0x7FF */
+        if (handle[i] == NULL)                                                          /* check handle */
+        {
+            return 2;                                                                   /* return error */
+        }
+        if (handle[i]->inited != 1)                                                     /* check handle initialization */
+        {
+            return 3;                                                                   /* return error */
+        }
+        addr[i] = handle[i]->iic_addr;                                                  /* set address */
+        reg[i] = MCP9808_REG_TEMPERATURE;                                               /* set register */
+    }
+    if ((handle[0]->iic_read_batch == NULL) &&
+        (handle[0]->iic_read_batch_ctx == NULL))                                        /* check iic_read_batch */
+    {
+        handle[0]->debug_print("mcp9808: iic_read_batch is null.\n");                   /* iic_read_batch is null */
         
-        return 4;                                                                        /* return error */
+        return 4;                                                                       /* return error */
     }
     
-    prev = (raw & 0x7FF) << 2;                                                           /* set data */
-    buf[0] = (prev >> 8) & 0xFF;                                                         /* set msb */
-    buf[1] = (prev >> 0) & 0xFF;                                                         /* set lsb */
-    res = a_mcp9808_iic_write(handle, MCP9808_REG_ALERT_UPPER, buf, 2);                  /* set threshold */
-    if (res != 0)                                                                        /* check result */
+    res = a_mcp9808_iic_read_batch(handle[0], addr, reg, buf, num);                     /* read all devices */
+    if (res != 0)                                                                       /* check result */
     {
-        handle->debug_print("mcp9808: set temperature high threshold failed.\n");        /* set temperature high threshold failed */
+        for (i = 0; i < num; i++)                                                       /* the pointers are unknown */
+        {
+            handle[i]->pointer_valid = 0;                                               /* set invalid */
+        }
+        handle[0]->debug_print("mcp9808: read batch failed.\n");                        /* read batch failed */
         
-        return 1;                                                                        /* return error */
+        return 1;                                                                       /* return error */
+    }
+    for (i = 0; i < num; i++)                                                           /* demultiplex */
+    {
+        handle[i]->pointer = MCP9808_REG_TEMPERATURE;                                   /* save the pointer */
+        handle[i]->pointer_valid = 1;                                                   /* set valid */
+        raw[i] = a_mcp9808_raw_decode((uint16_t)((uint16_t)buf[i * 2] << 8) |
+                                      buf[i * 2 + 1]);                                  /* decode temperature */
     }
     
-    return 0;                                                                            /* success return 0 */
+    return 0;                                                                           /* success return 0 */
 }
 
 /**
- * @brief      get temperature high threshold
+ * @brief      get device revision
  * @param[in]  *handle pointer to a mcp9808 handle structure
- * @param[out] *raw pointer to a raw data buffer
+ * @param[out] *revision pointer to a revision buffer
  * @return     status code
  *             - 0 success
- *             - 1 get temperature high threshold failed
+ *             - 1 get device revision failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t mcp9808_get_temperature_high_threshold(mcp9808_handle_t *handle, uint16_t *raw)
+uint8_t mcp9808_get_device_revision(mcp9808_handle_t *handle, uint8_t *revision)
 {
     uint8_t res;
-    uint16_t prev;
     uint8_t buf[2];
     
-    if (handle == NULL)                                                                  /* check handle */
+    if (handle == NULL)                                                     /* check handle */
     {
-        return 2;                                                                        /* return error */
+        return 2;                                                           /* return error */
     }
-    if (handle->inited != 1)                                                             /* check handle initialization */
+    if (handle->inited != 1)                                                /* check handle initialization */
     {
-        return 3;                                                                        /* return error */
+        return 3;                                                           /* return error */
     }
     
-    res = a_mcp9808_iic_read(handle, MCP9808_REG_ALERT_UPPER, buf, 2);                   /* get threshold */
-    if (res != 0)                                                                        /* check result */
+    res = a_mcp9808_iic_read(handle, MCP9808_REG_DEVICE_ID, buf, 2);        /* get device revision */
+    if (res != 0)                                                           /* check result */
     {
-        handle->debug_print("mcp9808: get temperature high threshold failed.\n");        /* get temperature high threshold failed */
+        handle->debug_print("mcp9808: get device revision failed.\n");      /* get device revision failed */
         
-        return 1;                                                                        /* return error */
+        return 1;                                                           /* return error */
     }
-    prev = (uint16_t)((uint16_t)buf[0] << 8) | buf[1];                                   /* set raw data */
-    *raw = (prev >> 2) & 0x7FF;                                                          /* set output data */
+    *revision = buf[1];                                                     /* set revision */
     
-    return 0;                                                                            /* success return 0 */
+    return 0;                                                               /* success return 0 */
 }
 
 /**
- * @brief     set temperature low threshold
+ * @brief     set resolution
  * @param[in] *handle pointer to a mcp9808 handle structure
- * @param[in] raw raw data
+ * @param[in] resolution temperature resolution
  * @return    status code
  *            - 0 success
- *            - 1 set temperature low threshold failed
+ *            - 1 set resolution failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 raw > 0x7FF
  * @note      none
  */
-uint8_t mcp9808_set_temperature_low_threshold(mcp9808_handle_t *handle, uint16_t raw)
+uint8_t mcp9808_set_resolution(mcp9808_handle_t *handle, mcp9808_resolution_t resolution)
 {
     uint8_t res;
-    uint16_t prev;
-    uint8_t buf[2];
+    uint8_t prev;
     
-    if (handle == NULL)                                                                  /* check handle */
+    if (handle == NULL)                                                        /* check handle */
     {
-        return 2;                                                                        /* return error */
+        return 2;                                                              /* return error */
     }
-    if (handle->inited != 1)                                                             /* check handle initialization */
+    if (handle->inited != 1)                                                   /* check handle initialization */
     {
-        return 3;                                                                        /* return error */
+        return 3;                                                              /* return error */
     }
-    if (raw > 0x7FF)                                                                     /* check result */
+    
+    res = a_mcp9808_resolution_read(handle, &prev);                            /* get resolution */
+    if (res != 0)                                                              /* check result */
     {
-        handle->debug_print("mcp9808: raw > 0x7FF.\n");                                  /* raw > 0x7FF */
+        handle->debug_print("mcp9808: get resolution failed.\n");              /* get resolution failed */
         
-        return 4;                                                                        /* return error */
+        return 1;                                                              /* return error */
     }
-    
-    prev = (raw & 0x7FF) << 2;                                                           /* set data */
-    buf[0] = (prev >> 8) & 0xFF;                                                         /* set msb */
-    buf[1] = (prev >> 0) & 0xFF;                                                         /* set lsb */
-    res = a_mcp9808_iic_write(handle, MCP9808_REG_ALERT_LOWER, buf, 2);                  /* set threshold */
-    if (res != 0)                                                                        /* check result */
+    prev &= ~(3 << 0);                                                         /* clear settings */
+    prev |= resolution << 0;                                                   /* set resolution */
+    res = a_mcp9808_iic_write(handle, MCP9808_REG_RESOLUTION, &prev, 1);       /* set resolution */
+    if (res != 0)                                                              /* check result */
     {
-        handle->debug_print("mcp9808: set temperature low threshold failed.\n");         /* set temperature low threshold failed */
+        handle->resolution_valid = 0;                                          /* the chip state is unknown */
+        handle->debug_print("mcp9808: set resolution failed.\n");              /* set resolution failed */
         
-        return 1;                                                                        /* return error */
+        return 1;                                                              /* return error */
     }
+    handle->resolution = prev;                                                 /* save the resolution */
+    handle->resolution_valid = 1;                                              /* set valid */
+    a_mcp9808_sample_restart(handle, 0);                                       /* restart the sample schedule */
     
-    return 0;                                                                            /* success return 0 */
+    return 0;                                                                  /* success return 0 */
 }
 
 /**
- * @brief      get temperature low threshold
+ * @brief      get resolution
  * @param[in]  *handle pointer to a mcp9808 handle structure
- * @param[out] *raw pointer to a raw data buffer
+ * @param[out] *resolution pointer to a temperature resolution buffer
  * @return     status code
  *             - 0 success
- *             - 1 get temperature low threshold failed
+ *             - 1 get resolution failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t mcp9808_get_temperature_low_threshold(mcp9808_handle_t *handle, uint16_t *raw)
+uint8_t mcp9808_get_resolution(mcp9808_handle_t *handle, mcp9808_resolution_t *resolution)
 {
     uint8_t res;
-    uint16_t prev;
-    uint8_t buf[2];
+    uint8_t prev;
     
-    if (handle == NULL)                                                                  /* check handle */
+    if (handle == NULL)                                                        /* check handle */
     {
-        return 2;                                                                        /* return error */
+        return 2;                                                              /* return error */
     }
-    if (handle->inited != 1)                                                             /* check handle initialization */
+    if (handle->inited != 1)                                                   /* check handle initialization */
     {
-        return 3;                                                                        /* return error */
+        return 3;                                                              /* return error */
     }
     
-    res = a_mcp9808_iic_read(handle, MCP9808_REG_ALERT_LOWER, buf, 2);                   /* get threshold */
-    if (res != 0)                                                                        /* check result */
+    res = a_mcp9808_resolution_read(handle, &prev);                            /* get resolution */
+    if (res != 0)                                                              /* check result */
     {
-        handle->debug_print("mcp9808: get temperature low threshold failed.\n");         /* get temperature low threshold failed */
+        handle->debug_print("mcp9808: get resolution failed.\n");              /* get resolution failed */
         
-        return 1;                                                                        /* return error */
+        return 1;                                                              /* return error */
     }
-    prev = (uint16_t)((uint16_t)buf[0] << 8) | buf[1];                                   /* set raw data */
-    *raw = (prev >> 2) & 0x7FF;                                                          /* set output data */
+    *resolution = (mcp9808_resolution_t)((prev >> 0) & 0x03);                  /* set resolution */
     
-    return 0;                                                                            /* success return 0 */
+    return 0;                                                                  /* success return 0 */
 }
 
 /**
- * @brief     set critical temperature
+ * @brief     set temperature threshold hysteresis
  * @param[in] *handle pointer to a mcp9808 handle structure
- * @param[in] raw raw data
+ * @param[in] hysteresis input hysteresis
  * @return    status code
  *            - 0 success
- *            - 1 set critical temperature failed
+ *            - 1 set temperature threshold hysteresis failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 raw > 0x7FF
  * @note      none
  */
-uint8_t mcp9808_set_critical_temperature(mcp9808_handle_t *handle, uint16_t raw)
+uint8_t mcp9808_set_temperature_threshold_hysteresis(mcp9808_handle_t *handle, mcp9808_hysteresis_t hysteresis)
 {
     uint8_t res;
     uint16_t prev;
-    uint8_t buf[2];
     
-    if (handle == NULL)                                                            /* check handle */
+    if (handle == NULL)                                                   /* check handle */
     {
-        return 2;                                                                  /* return error */
+        return 2;                                                         /* return error */
     }
-    if (handle->inited != 1)                                                       /* check handle initialization */
+    if (handle->inited != 1)                                              /* check handle initialization */
     {
-        return 3;                                                                  /* return error */
+        return 3;                                                         /* return error */
     }
-    if (raw > 0x7FF)                                                               /* check result */
+    
+    res = a_mcp9808_config_read(handle, &prev);                           /* get config */
+    if (res != 0)                                                         /* check result */
     {
-        handle->debug_print("mcp9808: raw > 0x7FF.\n");                            /* raw > 0x7FF */
+        handle->debug_print("mcp9808: get config failed.\n");             /* get config failed */
         
-        return 4;                                                                  /* return error */
+        return 1;                                                         /* return error */
     }
-    
-    prev = (raw & 0x7FF) << 2;                                                     /* set data */
-    buf[0] = (prev >> 8) & 0xFF;                                                   /* set msb */
-    buf[1] = (prev >> 0) & 0xFF;                                                   /* set lsb */
-    res = a_mcp9808_iic_write(handle, MCP9808_REG_CRIT, buf, 2);                   /* set temperature */
-    if (res != 0)                                                                  /* check result */
+    prev &= ~(3 << 9);                                                    /* clear settings */
+    prev |= hysteresis << 9;                                              /* set hysteresis */
+    res = a_mcp9808_config_write(handle, prev);                           /* set config */
+    if (res != 0)                                                         /* check result */
     {
-        handle->debug_print("mcp9808: set critical temperature failed.\n");        /* set critical temperature failed */
+        handle->debug_print("mcp9808: set config failed.\n");             /* set config failed */
         
-        return 1;                                                                  /* return error */
+        return 1;                                                         /* return error */
     }
     
-    return 0;                                                                      /* success return 0 */
+    return 0;                                                             /* success return 0 */
 }
 
 /**
- * @brief      get critical temperature
+ * @brief      get temperature threshold hysteresis
  * @param[in]  *handle pointer to a mcp9808 handle structure
- * @param[out] *raw pointer to a raw data buffer
+ * @param[out] *hysteresis pointer to a hysteresis buffer
  * @return     status code
  *             - 0 success
- *             - 1 get critical temperature failed
+ *             - 1 get temperature threshold hysteresis failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t mcp9808_get_critical_temperature(mcp9808_handle_t *handle, uint16_t *raw)
+uint8_t mcp9808_get_temperature_threshold_hysteresis(mcp9808_handle_t *handle, mcp9808_hysteresis_t *hysteresis)
 {
     uint8_t res;
     uint16_t prev;
-    uint8_t buf[2];
     
-    if (handle == NULL)                                                            /* check handle */
+    if (handle == NULL)                                                   /* check handle */
     {
-        return 2;                                                                  /* return error */
+        return 2;                                                         /* return error */
     }
-    if (handle->inited != 1)                                                       /* check handle initialization */
+    if (handle->inited != 1)                                              /* check handle initialization */
     {
-        return 3;                                                                  /* return error */
+        return 3;                                                         /* return error */
     }
     
-    res = a_mcp9808_iic_read(handle, MCP9808_REG_CRIT, buf, 2);                    /* get temperature */
-    if (res != 0)                                                                  /* check result */
+    res = a_mcp9808_config_read(handle, &prev);                           /* get config */
+    if (res != 0)                                                         /* check result */
     {
-        handle->debug_print("mcp9808: get critical temperature failed.\n");        /* get critical temperature failed */
+        handle->debug_print("mcp9808: get config failed.\n");             /* get config failed */
         
-        return 1;                                                                  /* return error */
+        return 1;                                                         /* return error */
     }
-    prev = (uint16_t)((uint16_t)buf[0] << 8) | buf[1];                             /* set raw data */
-    *raw = (prev >> 2) & 0x7FF;                                                    /* set output data */
+    *hysteresis = (mcp9808_hysteresis_t)((prev >> 9) & 0x03);             /* set hysteresis */
     
-    return 0;                                                                      /* success return 0 */
+    return 0;                                                             /* success return 0 */
 }
 
 /**
- * @brief      read temperature
- * @param[in]  *handle pointer to a mcp9808 handle structure
- * @param[out] *raw pointer to a raw data buffer
- * @param[out] *temperature_deg pointer to a converted temperature buffer
- * @return     status code
- *             - 0 success
- *             - 1 read failed
- *             - 2 handle is NULL
- *             - 3 handle is not initialized
- * @note       none
+ * @brief     enable or disable shutdown
+ * @param[in] *handle pointer to a mcp9808 handle structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 1 set shutdown failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
  */
-uint8_t mcp9808_read(mcp9808_handle_t *handle, int16_t *raw, float *temperature_deg)
+uint8_t mcp9808_set_shutdown(mcp9808_handle_t *handle, mcp9808_bool_t enable)
 {
     uint8_t res;
     uint16_t prev;
-    uint8_t buf[2];
     
-    if (handle == NULL)                                                       /* check handle */
+    if (handle == NULL)                                                   /* check handle */
     {
-        return 2;                                                             /* return error */
+        return 2;                                                         /* return error */
     }
-    if (handle->inited != 1)                                                  /* check handle initialization */
+    if (handle->inited != 1)                                              /* check handle initialization */
     {
-        return 3;                                                             /* return error */
+        return 3;                                                         /* return error */
     }
     
-    res = a_mcp9808_iic_read(handle, MCP9808_REG_TEMPERATURE, buf, 2);        /* get temperature */
-    if (res != 0)                                                             /* check result */
+    res = a_mcp9808_config_read(handle, &prev);                           /* get config */
+    if (res != 0)                                                         /* check result */
     {
-        handle->debug_print("mcp9808: get temperature failed.\n");            /* get temperature failed */
+        handle->debug_print("mcp9808: get config failed.\n");             /* get config failed */
         
-        return 1;                                                             /* return error */
-    }
-    prev = (uint16_t)((uint16_t)buf[0] << 8) | buf[1];                        /* set raw data */
-    prev &= ~(7 << 13);                                                       /* clear flags */
-    if ((prev & (1 << 12)) != 0)                                              /* check signed bit */
-    {
-        *raw = (int16_t)((uint16_t)(prev | (uint16_t)(0x7 << 13)));           /* save data and set signed bits */
+        return 1;                                                         /* return error */
     }
-    else
+    prev &= ~(1 << 8);                                                    /* clear settings */
+    prev |= enable << 8;                                                  /* set bool */
+    res = a_mcp9808_config_write(handle, prev);                           /* set config */
+    if (res != 0)                                                         /* check result */
     {
-        *raw = (int16_t)prev;                                                 /* save data */
+        handle->debug_print("mcp9808: set config failed.\n");             /* set config failed */
+        
+        return 1;                                                         /* return error */
     }
-    *temperature_deg = (float)(*raw) * 0.0625f;                               /* convert temperature */
+    handle->delay_ms(10);                                                 /* delay 10ms */
+    a_mcp9808_sample_restart(handle, (uint8_t)(enable == MCP9808_BOOL_FALSE));        /* restart the sample schedule */
     
-    return 0;                                                                 /* success return 0 */
+    return 0;                                                             /* success return 0 */
 }
 
 /**
- * @brief      get device revision
+ * @brief      get shutdown status
  * @param[in]  *handle pointer to a mcp9808 handle structure
- * @param[out] *revision pointer to a revision buffer
+ * @param[out] *enable pointer to a bool value buffer
  * @return     status code
  *             - 0 success
- *             - 1 get device revision failed
+ *             - 1 get shutdown failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t mcp9808_get_device_revision(mcp9808_handle_t *handle, uint8_t *revision)
+uint8_t mcp9808_get_shutdown(mcp9808_handle_t *handle, mcp9808_bool_t *enable)
 {
     uint8_t res;
-    uint8_t buf[2];
+    uint16_t prev;
     
-    if (handle == NULL)                                                     /* check handle */
+    if (handle == NULL)                                                   /* check handle */
     {
-        return 2;                                                           /* return error */
+        return 2;                                                         /* return error */
     }
-    if (handle->inited != 1)                                                /* check handle initialization */
+    if (handle->inited != 1)                                              /* check handle initialization */
     {
-        return 3;                                                           /* return error */
+        return 3;                                                         /* return error */
     }
     
-    res = a_mcp9808_iic_read(handle, MCP9808_REG_DEVICE_ID, buf, 2);        /* get device revision */
-    if (res != 0)                                                           /* check result */
+    res = a_mcp9808_config_read(handle, &prev);                           /* get config */
+    if (res != 0)                                                         /* check result */
     {
-        handle->debug_print("mcp9808: get device revision failed.\n");      /* get device revision failed */
+        handle->debug_print("mcp9808: get config failed.\n");             /* get config failed */
         
-        return 1;                                                           /* return error */
+        return 1;                                                         /* return error */
     }
-    *revision = buf[1];                                                     /* set revision */
+    *enable = (mcp9808_bool_t)((prev >> 8) & 0x01);                       /* set bool */
     
-    return 0;                                                               /* success return 0 */
+    return 0;                                                             /* success return 0 */
 }
 
 /**
- * @brief     set resolution
+ * @brief     enable or disable critical temperature lock
  * @param[in] *handle pointer to a mcp9808 handle structure
- * @param[in] resolution temperature resolution
+ * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set resolution failed
+ *            - 1 set critical temperature lock failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t mcp9808_set_resolution(mcp9808_handle_t *handle, mcp9808_resolution_t resolution)
+uint8_t mcp9808_set_critical_temperature_lock(mcp9808_handle_t *handle, mcp9808_bool_t enable)
 {
     uint8_t res;
-    uint8_t prev;
+    uint16_t prev;
     
-    if (handle == NULL)                                                        /* check handle */
+    if (handle == NULL)                                                   /* check handle */
     {
-        return 2;                                                              /* return error */
+        return 2;                                                         /* return error */
     }
-    if (handle->inited != 1)                                                   /* check handle initialization */
+    if (handle->inited != 1)                                              /* check handle initialization */
     {
-        return 3;                                                              /* return error */
+        return 3;                                                         /* return error */
     }
     
-    res = a_mcp9808_iic_read(handle, MCP9808_REG_RESOLUTION, &prev, 1);        /* get resolution */
-    if (res != 0)                                                              /* check result */
+    res = a_mcp9808_config_read(handle, &prev);                           /* get config */
+    if (res != 0)                                                         /* check result */
     {
-        handle->debug_print("mcp9808: get resolution failed.\n");              /* get resolution failed */
+        handle->debug_print("mcp9808: get config failed.\n");             /* get config failed */
         
-        return 1;                                                              /* return error */
+        return 1;                                                         /* return error */
     }
-    prev &= ~(3 << 0);                                                         /* clear settings */
-    prev |= resolution << 0;                                                   /* set resolution */
-    res = a_mcp9808_iic_write(handle, MCP9808_REG_RESOLUTION, &prev, 1);       /* set resolution */
-    if (res != 0)                                                              /* check result */
+    prev &= ~(1 << 7);                                                    /* clear settings */
+    prev |= enable << 7;                                                  /* set bool */
+    res = a_mcp9808_config_write(handle, prev);                           /* set config */
+    if (res != 0)                                                         /* check result */
     {
-        handle->debug_print("mcp9808: set resolution failed.\n");              /* set resolution failed */
+        handle->debug_print("mcp9808: set config failed.\n");             /* set config failed */
         
-        return 1;                                                              /* return error */
+        return 1;                                                         /* return error */
     }
     
-    return 0;                                                                  /* success return 0 */
+    return 0;                                                             /* success return 0 */
 }
 
 /**
- * @brief      get resolution
+ * @brief      get critical temperature lock status
  * @param[in]  *handle pointer to a mcp9808 handle structure
- * @param[out] *resolution pointer to a temperature resolution buffer
+ * @param[out] *enable pointer to a bool value buffer
  * @return     status code
  *             - 0 success
- *             - 1 get resolution failed
+ *             - 1 get critical temperature lock failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t mcp9808_get_resolution(mcp9808_handle_t *handle, mcp9808_resolution_t *resolution)
+uint8_t mcp9808_get_critical_temperature_lock(mcp9808_handle_t *handle, mcp9808_bool_t *enable)
 {
     uint8_t res;
-    uint8_t prev;
+    uint16_t prev;
     
-    if (handle == NULL)                                                        /* check handle */
+    if (handle == NULL)                                                   /* check handle */
     {
-        return 2;                                                              /* return error */
+        return 2;                                                         /* return error */
     }
-    if (handle->inited != 1)                                                   /* check handle initialization */
+    if (handle->inited != 1)                                              /* check handle initialization */
     {
-        return 3;                                                              /* return error */
+        return 3;                                                         /* return error */
     }
     
-    res = a_mcp9808_iic_read(handle, MCP9808_REG_RESOLUTION, &prev, 1);        /* get resolution */
-    if (res != 0)                                                              /* check result */
+    res = a_mcp9808_config_read(handle, &prev);                           /* get config */
+    if (res != 0)                                                         /* check result */
     {
-        handle->debug_print("mcp9808: get resolution failed.\n");              /* get resolution failed */
+        handle->debug_print("mcp9808: get config failed.\n");             /* get config failed */
         
-        return 1;                                                              /* return error */
+        return 1;                                                         /* return error */
     }
-    *resolution = (mcp9808_resolution_t)((prev >> 0) & 0x03);                  /* set resolution */
+    *enable = (mcp9808_bool_t)((prev >> 7) & 0x01);                       /* set bool */
     
-    return 0;                                                                  /* success return 0 */
+    return 0;                                                             /* success return 0 */
 }
 
 /**
- * @brief     set temperature threshold hysteresis
+ * @brief     enable or disable temperature threshold lock
  * @param[in] *handle pointer to a mcp9808 handle structure
- * @param[in] hysteresis input hysteresis
+ * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set temperature threshold hysteresis failed
+ *            - 1 set temperature threshold lock failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t mcp9808_set_temperature_threshold_hysteresis(mcp9808_handle_t *handle, mcp9808_hysteresis_t hysteresis)
+uint8_t mcp9808_set_temperature_threshold_lock(mcp9808_handle_t *handle, mcp9808_bool_t enable)
 {
     uint8_t res;
     uint16_t prev;
-    uint8_t buf[2];
     
     if (handle == NULL)                                                   /* check handle */
     {
@@ -910,19 +2076,16 @@ uint8_t mcp9808_set_temperature_threshold_hysteresis(mcp9808_handle_t *handle, m
         return 3;                                                         /* return error */
     }
     
-    res = a_mcp9808_iic_read(handle, MCP9808_REG_CONFIG, buf, 2);         /* get config */
+    res = a_mcp9808_config_read(handle, &prev);                           /* get config */
     if (res != 0)                                                         /* check result */
     {
         handle->debug_print("mcp9808: get config failed.\n");             /* get config failed */
         
         return 1;                                                         /* return error */
     }
-    prev = (uint16_t)((uint16_t)buf[0] << 8) | buf[1];                    /* set raw data */
-    prev &= ~(3 << 9);                                                    /* clear settings */
-    prev |= hysteresis << 9;                                              /* set hysteresis */
-    buf[0] = (prev >> 8) & 0xFF;                                          /* set msb */
-    buf[1] = (prev >> 0) & 0xFF;                                          /* set lsb */
-    res = a_mcp9808_iic_write(handle, MCP9808_REG_CONFIG, buf, 2);        /* set config */
+    prev &= ~(1 << 6);                                                    /* clear settings */
+    prev |= enable << 6;                                                  /* set bool */
+    res = a_mcp9808_config_write(handle, prev);                           /* set config */
     if (res != 0)                                                         /* check result */
     {
         handle->debug_print("mcp9808: set config failed.\n");             /* set config failed */
@@ -934,21 +2097,20 @@ uint8_t mcp9808_set_temperature_threshold_hysteresis(mcp9808_handle_t *handle, m
 }
 
 /**
- * @brief      get temperature threshold hysteresis
+ * @brief      get temperature threshold lock status
  * @param[in]  *handle pointer to a mcp9808 handle structure
- * @param[out] *hysteresis pointer to a hysteresis buffer
+ * @param[out] *enable pointer to a bool value buffer
  * @return     status code
  *             - 0 success
- *             - 1 get temperature threshold hysteresis failed
+ *             - 1 get temperature threshold lock failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t mcp9808_get_temperature_threshold_hysteresis(mcp9808_handle_t *handle, mcp9808_hysteresis_t *hysteresis)
+uint8_t mcp9808_get_temperature_threshold_lock(mcp9808_handle_t *handle, mcp9808_bool_t *enable)
 {
     uint8_t res;
     uint16_t prev;
-    uint8_t buf[2];
     
     if (handle == NULL)                                                   /* check handle */
     {
@@ -959,35 +2121,32 @@ uint8_t mcp9808_get_temperature_threshold_hysteresis(mcp9808_handle_t *handle, m
         return 3;                                                         /* return error */
     }
     
-    res = a_mcp9808_iic_read(handle, MCP9808_REG_CONFIG, buf, 2);         /* get config */
+    res = a_mcp9808_config_read(handle, &prev);                           /* get config */
     if (res != 0)                                                         /* check result */
     {
         handle->debug_print("mcp9808: get config failed.\n");             /* get config failed */
         
         return 1;                                                         /* return error */
     }
-    prev = (uint16_t)((uint16_t)buf[0] << 8) | buf[1];                    /* set raw data */
-    *hysteresis = (mcp9808_hysteresis_t)((prev >> 9) & 0x03);             /* set hysteresis */
+    *enable = (mcp9808_bool_t)((prev >> 6) & 0x01);                       /* set bool */
     
     return 0;                                                             /* success return 0 */
 }
 
 /**
- * @brief     enable or disable shutdown
+ * @brief     clear interrupt
  * @param[in] *handle pointer to a mcp9808 handle structure
- * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set shutdown failed
+ *            - 1 clear interrupt failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t mcp9808_set_shutdown(mcp9808_handle_t *handle, mcp9808_bool_t enable)
+uint8_t mcp9808_clear_interrupt(mcp9808_handle_t *handle)
 {
     uint8_t res;
     uint16_t prev;
-    uint8_t buf[2];
     
     if (handle == NULL)                                                   /* check handle */
     {
@@ -998,42 +2157,38 @@ uint8_t mcp9808_set_shutdown(mcp9808_handle_t *handle, mcp9808_bool_t enable)
         return 3;                                                         /* return error */
     }
     
-    res = a_mcp9808_iic_read(handle, MCP9808_REG_CONFIG, buf, 2);         /* get config */
+    res = a_mcp9808_config_read(handle, &prev);                           /* get config */
     if (res != 0)                                                         /* check result */
     {
         handle->debug_print("mcp9808: get config failed.\n");             /* get config failed */
         
         return 1;                                                         /* return error */
     }
-    prev = (uint16_t)((uint16_t)buf[0] << 8) | buf[1];                    /* set raw data */
-    prev &= ~(1 << 8);                                                    /* clear settings */
-    prev |= enable << 8;                                                  /* set bool */
-    buf[0] = (prev >> 8) & 0xFF;                                          /* set msb */
-    buf[1] = (prev >> 0) & 0xFF;                                          /* set lsb */
-    res = a_mcp9808_iic_write(handle, MCP9808_REG_CONFIG, buf, 2);        /* set config */
+    prev &= ~(1 << 5);                                                    /* clear settings */
+    prev |= 1 << 5;                                                       /* set enable */
+    res = a_mcp9808_config_write(handle, prev);                           /* set config */
     if (res != 0)                                                         /* check result */
     {
         handle->debug_print("mcp9808: set config failed.\n");             /* set config failed */
         
         return 1;                                                         /* return error */
     }
-    handle->delay_ms(10);                                                 /* delay 10ms */
     
     return 0;                                                             /* success return 0 */
 }
 
 /**
- * @brief      get shutdown status
+ * @brief      get alert output asserted status
  * @param[in]  *handle pointer to a mcp9808 handle structure
  * @param[out] *enable pointer to a bool value buffer
  * @return     status code
  *             - 0 success
- *             - 1 get shutdown failed
+ *             - 1 get alert output asserted failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t mcp9808_get_shutdown(mcp9808_handle_t *handle, mcp9808_bool_t *enable)
+uint8_t mcp9808_get_alert_output_asserted(mcp9808_handle_t *handle, mcp9808_bool_t *enable)
 {
     uint8_t res;
     uint16_t prev;
@@ -1056,27 +2211,26 @@ uint8_t mcp9808_get_shutdown(mcp9808_handle_t *handle, mcp9808_bool_t *enable)
         return 1;                                                         /* return error */
     }
     prev = (uint16_t)((uint16_t)buf[0] << 8) | buf[1];                    /* set raw data */
-    *enable = (mcp9808_bool_t)((prev >> 8) & 0x01);                       /* set bool */
+    *enable = (mcp9808_bool_t)((prev >> 4) & 0x01);                       /* set bool */
     
     return 0;                                                             /* success return 0 */
 }
 
 /**
- * @brief     enable or disable critical temperature lock
+ * @brief     enable or disable alert output
  * @param[in] *handle pointer to a mcp9808 handle structure
  * @param[in] enable bool value
  * @return    status code
  *            - 0 success
- *            - 1 set critical temperature lock failed
+ *            - 1 set alert output failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t mcp9808_set_critical_temperature_lock(mcp9808_handle_t *handle, mcp9808_bool_t enable)
+uint8_t mcp9808_set_alert_output(mcp9808_handle_t *handle, mcp9808_bool_t enable)
 {
     uint8_t res;
     uint16_t prev;
-    uint8_t buf[2];
     
     if (handle == NULL)                                                   /* check handle */
     {
@@ -1087,19 +2241,16 @@ uint8_t mcp9808_set_critical_temperature_lock(mcp9808_handle_t *handle, mcp9808_
         return 3;                                                         /* return error */
     }
     
-    res = a_mcp9808_iic_read(handle, MCP9808_REG_CONFIG, buf, 2);         /* get config */
+    res = a_mcp9808_config_read(handle, &prev);                           /* get config */
     if (res != 0)                                                         /* check result */
     {
         handle->debug_print("mcp9808: get config failed.\n");             /* get config failed */
         
         return 1;                                                         /* return error */
     }
-    prev = (uint16_t)((uint16_t)buf[0] << 8) | buf[1];                    /* set raw data */
-    prev &= ~(1 << 7);                                                    /* clear settings */
-    prev |= enable << 7;                                                  /* set bool */
-    buf[0] = (prev >> 8) & 0xFF;                                          /* set msb */
-    buf[1] = (prev >> 0) & 0xFF;                                          /* set lsb */
-    res = a_mcp9808_iic_write(handle, MCP9808_REG_CONFIG, buf, 2);        /* set config */
+    prev &= ~(1 << 3);                                                    /* clear settings */
+    prev |= enable << 3;                                                  /* set bool */
+    res = a_mcp9808_config_write(handle, prev);                           /* set config */
     if (res != 0)                                                         /* check result */
     {
         handle->debug_print("mcp9808: set config failed.\n");             /* set config failed */
@@ -1111,21 +2262,20 @@ uint8_t mcp9808_set_critical_temperature_lock(mcp9808_handle_t *handle, mcp9808_
 }
 
 /**
- * @brief      get critical temperature lock status
+ * @brief      get alert output status
  * @param[in]  *handle pointer to a mcp9808 handle structure
  * @param[out] *enable pointer to a bool value buffer
  * @return     status code
  *             - 0 success
- *             - 1 get critical temperature lock failed
+ *             - 1 get alert output failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t mcp9808_get_critical_temperature_lock(mcp9808_handle_t *handle, mcp9808_bool_t *enable)
+uint8_t mcp9808_get_alert_output(mcp9808_handle_t *handle, mcp9808_bool_t *enable)
 {
     uint8_t res;
     uint16_t prev;
-    uint8_t buf[2];
     
     if (handle == NULL)                                                   /* check handle */
     {
@@ -1136,35 +2286,33 @@ uint8_t mcp9808_get_critical_temperature_lock(mcp9808_handle_t *handle, mcp9808_
         return 3;                                                         /* return error */
     }
     
-    res = a_mcp9808_iic_read(handle, MCP9808_REG_CONFIG, buf, 2);         /* get config */
+    res = a_mcp9808_config_read(handle, &prev);                           /* get config */
     if (res != 0)                                                         /* check result */
     {
         handle->debug_print("mcp9808: get config failed.\n");             /* get config failed */
         
         return 1;                                                         /* return error */
     }
-    prev = (uint16_t)((uint16_t)buf[0] << 8) | buf[1];                    /* set raw data */
-    *enable = (mcp9808_bool_t)((prev >> 7) & 0x01);                       /* set bool */
+    *enable = (mcp9808_bool_t)((prev >> 3) & 0x01);                       /* set bool */
     
     return 0;                                                             /* success return 0 */
 }
 
 /**
- * @brief     enable or disable temperature threshold lock
+ * @brief     set alert output select
  * @param[in] *handle pointer to a mcp9808 handle structure
- * @param[in] enable bool value
+ * @param[in] select_output alert output select
  * @return    status code
  *            - 0 success
- *            - 1 set temperature threshold lock failed
+ *            - 1 set alert output select failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t mcp9808_set_temperature_threshold_lock(mcp9808_handle_t *handle, mcp9808_bool_t enable)
+uint8_t mcp9808_set_alert_output_select(mcp9808_handle_t *handle, mcp9808_alert_output_select_t select_output)
 {
     uint8_t res;
     uint16_t prev;
-    uint8_t buf[2];
     
     if (handle == NULL)                                                   /* check handle */
     {
@@ -1175,19 +2323,16 @@ uint8_t mcp9808_set_temperature_threshold_lock(mcp9808_handle_t *handle, mcp9808
         return 3;                                                         /* return error */
     }
     
-    res = a_mcp9808_iic_read(handle, MCP9808_REG_CONFIG, buf, 2);         /* get config */
+    res = a_mcp9808_config_read(handle, &prev);                           /* get config */
     if (res != 0)                                                         /* check result */
     {
         handle->debug_print("mcp9808: get config failed.\n");             /* get config failed */
         
         return 1;                                                         /* return error */
     }
-    prev = (uint16_t)((uint16_t)buf[0] << 8) | buf[1];                    /* set raw data */
-    prev &= ~(1 << 6);                                                    /* clear settings */
-    prev |= enable << 6;                                                  /* set bool */
-    buf[0] = (prev >> 8) & 0xFF;                                          /* set msb */
-    buf[1] = (prev >> 0) & 0xFF;                                          /* set lsb */
-    res = a_mcp9808_iic_write(handle, MCP9808_REG_CONFIG, buf, 2);        /* set config */
+    prev &= ~(1 << 2);                                                    /* clear settings */
+    prev |= select_output << 2;                                           /* set select */
+    res = a_mcp9808_config_write(handle, prev);                           /* set config */
     if (res != 0)                                                         /* check result */
     {
         handle->debug_print("mcp9808: set config failed.\n");             /* set config failed */
@@ -1199,59 +2344,57 @@ uint8_t mcp9808_set_temperature_threshold_lock(mcp9808_handle_t *handle, mcp9808
 }
 
 /**
- * @brief      get temperature threshold lock status
+ * @brief      get alert output select
  * @param[in]  *handle pointer to a mcp9808 handle structure
- * @param[out] *enable pointer to a bool value buffer
+ * @param[out] *select_output pointer to an alert output select buffer
  * @return     status code
  *             - 0 success
- *             - 1 get temperature threshold lock failed
+ *             - 1 get alert output select failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t mcp9808_get_temperature_threshold_lock(mcp9808_handle_t *handle, mcp9808_bool_t *enable)
+uint8_t mcp9808_get_alert_output_select(mcp9808_handle_t *handle, mcp9808_alert_output_select_t *select_output)
 {
     uint8_t res;
     uint16_t prev;
-    uint8_t buf[2];
     
-    if (handle == NULL)                                                   /* check handle */
+    if (handle == NULL)                                                          /* check handle */
     {
-        return 2;                                                         /* return error */
+        return 2;                                                                /* return error */
     }
-    if (handle->inited != 1)                                              /* check handle initialization */
+    if (handle->inited != 1)                                                     /* check handle initialization */
     {
-        return 3;                                                         /* return error */
+        return 3;                                                                /* return error */
     }
     
-    res = a_mcp9808_iic_read(handle, MCP9808_REG_CONFIG, buf, 2);         /* get config */
-    if (res != 0)                                                         /* check result */
+    res = a_mcp9808_config_read(handle, &prev);                                  /* get config */
+    if (res != 0)                                                                /* check result */
     {
-        handle->debug_print("mcp9808: get config failed.\n");             /* get config failed */
+        handle->debug_print("mcp9808: get config failed.\n");                    /* get config failed */
         
-        return 1;                                                         /* return error */
+        return 1;                                                                /* return error */
     }
-    prev = (uint16_t)((uint16_t)buf[0] << 8) | buf[1];                    /* set raw data */
-    *enable = (mcp9808_bool_t)((prev >> 6) & 0x01);                       /* set bool */
+    *select_output = (mcp9808_alert_output_select_t)((prev >> 2) & 0x01);        /* set select */
     
-    return 0;                                                             /* success return 0 */
+    return 0;                                                                    /* success return 0 */
 }
 
 /**
- * @brief     clear interrupt
+ * @brief     set alert output polarity
  * @param[in] *handle pointer to a mcp9808 handle structure
+ * @param[in] polarity alert output polarity
  * @return    status code
  *            - 0 success
- *            - 1 clear interrupt failed
+ *            - 1 set alert output polarity failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t mcp9808_clear_interrupt(mcp9808_handle_t *handle)
+uint8_t mcp9808_set_alert_output_polarity(mcp9808_handle_t *handle, mcp9808_alert_output_polarity_t polarity)
 {
     uint8_t res;
     uint16_t prev;
-    uint8_t buf[2];
     
     if (handle == NULL)                                                   /* check handle */
     {
@@ -1262,19 +2405,16 @@ uint8_t mcp9808_clear_interrupt(mcp9808_handle_t *handle)
         return 3;                                                         /* return error */
     }
     
-    res = a_mcp9808_iic_read(handle, MCP9808_REG_CONFIG, buf, 2);         /* get config */
+    res = a_mcp9808_config_read(handle, &prev);                           /* get config */
     if (res != 0)                                                         /* check result */
     {
         handle->debug_print("mcp9808: get config failed.\n");             /* get config failed */
         
         return 1;                                                         /* return error */
     }
-    prev = (uint16_t)((uint16_t)buf[0] << 8) | buf[1];                    /* set raw data */
-    prev &= ~(1 << 5);                                                    /* clear settings */
-    prev |= 1 << 5;                                                       /* set enable */
-    buf[0] = (prev >> 8) & 0xFF;                                          /* set msb */
-    buf[1] = (prev >> 0) & 0xFF;                                          /* set lsb */
-    res = a_mcp9808_iic_write(handle, MCP9808_REG_CONFIG, buf, 2);        /* set config */
+    prev &= ~(1 << 1);                                                    /* clear settings */
+    prev |= polarity << 1;                                                /* set polarity */
+    res = a_mcp9808_config_write(handle, prev);                           /* set config */
     if (res != 0)                                                         /* check result */
     {
         handle->debug_print("mcp9808: set config failed.\n");             /* set config failed */
@@ -1286,21 +2426,20 @@ uint8_t mcp9808_clear_interrupt(mcp9808_handle_t *handle)
 }
 
 /**
- * @brief      get alert output asserted status
+ * @brief      get alert output polarity
  * @param[in]  *handle pointer to a mcp9808 handle structure
- * @param[out] *enable pointer to a bool value buffer
+ * @param[out] *polarity pointer to an alert output polarity buffer
  * @return     status code
  *             - 0 success
- *             - 1 get alert output asserted failed
+ *             - 1 get alert output polarity failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t mcp9808_get_alert_output_asserted(mcp9808_handle_t *handle, mcp9808_bool_t *enable)
+uint8_t mcp9808_get_alert_output_polarity(mcp9808_handle_t *handle, mcp9808_alert_output_polarity_t *polarity)
 {
     uint8_t res;
     uint16_t prev;
-    uint8_t buf[2];
     
     if (handle == NULL)                                                   /* check handle */
     {
@@ -1311,35 +2450,33 @@ uint8_t mcp9808_get_alert_output_asserted(mcp9808_handle_t *handle, mcp9808_bool
         return 3;                                                         /* return error */
     }
     
-    res = a_mcp9808_iic_read(handle, MCP9808_REG_CONFIG, buf, 2);         /* get config */
+    res = a_mcp9808_config_read(handle, &prev);                           /* get config */
     if (res != 0)                                                         /* check result */
     {
         handle->debug_print("mcp9808: get config failed.\n");             /* get config failed */
         
         return 1;                                                         /* return error */
     }
-    prev = (uint16_t)((uint16_t)buf[0] << 8) | buf[1];                    /* set raw data */
-    *enable = (mcp9808_bool_t)((prev >> 4) & 0x01);                       /* set bool */
+    *polarity = (mcp9808_alert_output_polarity_t)((prev >> 1) & 0x01);    /* set polarity */
     
     return 0;                                                             /* success return 0 */
 }
 
 /**
- * @brief     enable or disable alert output
+ * @brief     set alert output mode
  * @param[in] *handle pointer to a mcp9808 handle structure
- * @param[in] enable bool value
+ * @param[in] mode alert output mode
  * @return    status code
  *            - 0 success
- *            - 1 set alert output failed
+ *            - 1 set alert output mode failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t mcp9808_set_alert_output(mcp9808_handle_t *handle, mcp9808_bool_t enable)
+uint8_t mcp9808_set_alert_output_mode(mcp9808_handle_t *handle, mcp9808_alert_output_mode_t mode)
 {
     uint8_t res;
     uint16_t prev;
-    uint8_t buf[2];
     
     if (handle == NULL)                                                   /* check handle */
     {
@@ -1350,19 +2487,16 @@ uint8_t mcp9808_set_alert_output(mcp9808_handle_t *handle, mcp9808_bool_t enable
         return 3;                                                         /* return error */
     }
     
-    res = a_mcp9808_iic_read(handle, MCP9808_REG_CONFIG, buf, 2);         /* get config */
+    res = a_mcp9808_config_read(handle, &prev);                           /* get config */
     if (res != 0)                                                         /* check result */
     {
         handle->debug_print("mcp9808: get config failed.\n");             /* get config failed */
         
         return 1;                                                         /* return error */
     }
-    prev = (uint16_t)((uint16_t)buf[0] << 8) | buf[1];                    /* set raw data */
-    prev &= ~(1 << 3);                                                    /* clear settings */
-    prev |= enable << 3;                                                  /* set bool */
-    buf[0] = (prev >> 8) & 0xFF;                                          /* set msb */
-    buf[1] = (prev >> 0) & 0xFF;                                          /* set lsb */
-    res = a_mcp9808_iic_write(handle, MCP9808_REG_CONFIG, buf, 2);        /* set config */
+    prev &= ~(1 << 0);                                                    /* clear settings */
+    prev |= mode << 0;                                                    /* set mode */
+    res = a_mcp9808_config_write(handle, prev);                           /* set config */
     if (res != 0)                                                         /* check result */
     {
         handle->debug_print("mcp9808: set config failed.\n");             /* set config failed */
@@ -1374,21 +2508,130 @@ uint8_t mcp9808_set_alert_output(mcp9808_handle_t *handle, mcp9808_bool_t enable
 }
 
 /**
- * @brief      get alert output status
+ * @brief      get alert output mode
+ * @param[in]  *handle pointer to a mcp9808 handle structure
+ * @param[out] *mode pointer to an alert output mode buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get alert output mode failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t mcp9808_get_alert_output_mode(mcp9808_handle_t *handle, mcp9808_alert_output_mode_t *mode)
+{
+    uint8_t res;
+    uint16_t prev;
+    
+    if (handle == NULL)                                                   /* check handle */
+    {
+        return 2;                                                         /* return error */
+    }
+    if (handle->inited != 1)                                              /* check handle initialization */
+    {
+        return 3;                                                         /* return error */
+    }
+    
+    res = a_mcp9808_config_read(handle, &prev);                           /* get config */
+    if (res != 0)                                                         /* check result */
+    {
+        handle->debug_print("mcp9808: get config failed.\n");             /* get config failed */
+        
+        return 1;                                                         /* return error */
+    }
+    *mode = (mcp9808_alert_output_mode_t)((prev >> 0) & 0x01);            /* set mode */
+    
+    return 0;                                                             /* success return 0 */
+}
+
+/**
+ * @brief     enable or disable the register cache
+ * @param[in] *handle pointer to a mcp9808 handle structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      when enabled, the config setters reuse a write-through copy of the config
+ *            register instead of reading it back from the chip before every write,
+ *            and the threshold registers are cached in the same way
+ */
+uint8_t mcp9808_set_cache(mcp9808_handle_t *handle, mcp9808_bool_t enable)
+{
+    if (handle == NULL)                                 /* check handle */
+    {
+        return 2;                                       /* return error */
+    }
+    
+    handle->cache_enable = (uint8_t)enable;             /* set the cache */
+    handle->config_valid = 0;                           /* invalidate the config cache */
+    handle->threshold_valid = 0;                        /* invalidate the threshold cache */
+    handle->resolution_valid = 0;                       /* invalidate the resolution cache */
+    
+    return 0;                                           /* success return 0 */
+}
+
+/**
+ * @brief      get the register cache status
  * @param[in]  *handle pointer to a mcp9808 handle structure
  * @param[out] *enable pointer to a bool value buffer
  * @return     status code
  *             - 0 success
- *             - 1 get alert output failed
  *             - 2 handle is NULL
- *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t mcp9808_get_alert_output(mcp9808_handle_t *handle, mcp9808_bool_t *enable)
+uint8_t mcp9808_get_cache(mcp9808_handle_t *handle, mcp9808_bool_t *enable)
+{
+    if (handle == NULL)                                           /* check handle */
+    {
+        return 2;                                                 /* return error */
+    }
+    
+    *enable = (mcp9808_bool_t)(handle->cache_enable);             /* get the cache */
+    
+    return 0;                                                     /* success return 0 */
+}
+
+/**
+ * @brief     invalidate the register cache
+ * @param[in] *handle pointer to a mcp9808 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      call it after the chip may have been changed behind the driver,
+ *            such as a power cycle or a bus reset
+ */
+uint8_t mcp9808_invalidate_cache(mcp9808_handle_t *handle)
+{
+    if (handle == NULL)                     /* check handle */
+    {
+        return 2;                           /* return error */
+    }
+    
+    handle->config_valid = 0;               /* invalidate the config cache */
+    handle->threshold_valid = 0;            /* invalidate the threshold cache */
+    handle->pointer_valid = 0;              /* invalidate the register pointer */
+    handle->resolution_valid = 0;           /* invalidate the resolution cache */
+    handle->sample_valid = 0;               /* invalidate the scheduled sample */
+    
+    return 0;                               /* success return 0 */
+}
+
+/**
+ * @brief     reload the register cache from the chip
+ * @param[in] *handle pointer to a mcp9808 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 resync cache failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t mcp9808_resync_cache(mcp9808_handle_t *handle)
 {
     uint8_t res;
+    uint8_t reg;
+    uint8_t resolution;
     uint16_t prev;
-    uint8_t buf[2];
     
     if (handle == NULL)                                                   /* check handle */
     {
@@ -1399,124 +2642,247 @@ uint8_t mcp9808_get_alert_output(mcp9808_handle_t *handle, mcp9808_bool_t *enabl
         return 3;                                                         /* return error */
     }
     
-    res = a_mcp9808_iic_read(handle, MCP9808_REG_CONFIG, buf, 2);         /* get config */
+    handle->config_valid = 0;                                             /* invalidate the config cache */
+    handle->threshold_valid = 0;                                          /* invalidate the threshold cache */
+    handle->resolution_valid = 0;                                         /* invalidate the resolution cache */
+    res = a_mcp9808_config_read(handle, &prev);                           /* get config */
     if (res != 0)                                                         /* check result */
     {
         handle->debug_print("mcp9808: get config failed.\n");             /* get config failed */
         
         return 1;                                                         /* return error */
     }
-    prev = (uint16_t)((uint16_t)buf[0] << 8) | buf[1];                    /* set raw data */
-    *enable = (mcp9808_bool_t)((prev >> 3) & 0x01);                       /* set bool */
+    for (reg = MCP9808_REG_ALERT_UPPER; reg <= MCP9808_REG_CRIT; reg++)   /* read all thresholds */
+    {
+        res = a_mcp9808_threshold_read(handle, reg, &prev);               /* get threshold */
+        if (res != 0)                                                     /* check result */
+        {
+            handle->debug_print("mcp9808: get threshold failed.\n");      /* get threshold failed */
+            
+            return 1;                                                     /* return error */
+        }
+    }
+    res = a_mcp9808_resolution_read(handle, &resolution);                 /* get resolution */
+    if (res != 0)                                                         /* check result */
+    {
+        handle->debug_print("mcp9808: get resolution failed.\n");         /* get resolution failed */
+        
+        return 1;                                                         /* return error */
+    }
     
     return 0;                                                             /* success return 0 */
 }
 
 /**
- * @brief     set alert output select
+ * @brief     apply a whole chip config
  * @param[in] *handle pointer to a mcp9808 handle structure
- * @param[in] select_output alert output select
+ * @param[in] *config pointer to a config structure
  * @return    status code
  *            - 0 success
- *            - 1 set alert output select failed
+ *            - 1 apply config failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ *            - 4 raw > 0x7FF
+ *            - 5 locked settings can't be changed
+ * @note      thresholds are only written when they differ from the current value,
+ *            and the config register is written at most once after them
  */
-uint8_t mcp9808_set_alert_output_select(mcp9808_handle_t *handle, mcp9808_alert_output_select_t select_output)
+uint8_t mcp9808_apply_config(mcp9808_handle_t *handle, const mcp9808_config_t *config)
 {
     uint8_t res;
+    uint8_t i;
     uint16_t prev;
-    uint8_t buf[2];
+    uint16_t conf;
+    uint16_t raw[3];
+    uint16_t threshold;
     
-    if (handle == NULL)                                                   /* check handle */
+    if (handle == NULL)                                                                   /* check handle */
     {
-        return 2;                                                         /* return error */
+        return 2;                                                                         /* return error */
     }
-    if (handle->inited != 1)                                              /* check handle initialization */
+    if (handle->inited != 1)                                                              /* check handle initialization */
     {
-        return 3;                                                         /* return error */
+        return 3;                                                                         /* return error */
     }
     
-    res = a_mcp9808_iic_read(handle, MCP9808_REG_CONFIG, buf, 2);         /* get config */
-    if (res != 0)                                                         /* check result */
+    raw[0] = config->high_threshold;                                                      /* set high threshold */
+    raw[1] = config->low_threshold;                                                       /* set low threshold */
+    raw[2] = config->critical_temperature;                                                /* set critical temperature */
+    for (i = 0; i < 3; i++)                                                               /* check all thresholds */
     {
-        handle->debug_print("mcp9808: get config failed.\n");             /* get config failed */
+        if (raw[i] > 0x7FF)                                                               /* check result */
+        {
+            handle->debug_print("mcp9808: raw > 0x7FF.\n");                               /* raw > 0x7FF */
+            
+            return 4;                                                                     /* return error */
+        }
+    }
+    conf = (uint16_t)((uint16_t)(config->hysteresis & 0x03) << 9);                        /* set hysteresis */
+    conf |= (uint16_t)((uint16_t)(config->shutdown & 0x01) << 8);                         /* set shutdown */
+    conf |= (uint16_t)((uint16_t)(config->critical_temperature_lock & 0x01) << 7);        /* set critical temperature lock */
+    conf |= (uint16_t)((uint16_t)(config->temperature_threshold_lock & 0x01) << 6);       /* set temperature threshold lock */
+    conf |= (uint16_t)((uint16_t)(config->alert_output & 0x01) << 3);                     /* set alert output */
+    conf |= (uint16_t)((uint16_t)(config->alert_output_select & 0x01) << 2);              /* set alert output select */
+    conf |= (uint16_t)((uint16_t)(config->alert_output_polarity & 0x01) << 1);            /* set alert output polarity */
+    conf |= (uint16_t)((uint16_t)(config->alert_output_mode & 0x01) << 0);                /* set alert output mode */
+    
+    res = a_mcp9808_config_read(handle, &prev);                                           /* get config */
+    if (res != 0)                                                                         /* check result */
+    {
+        handle->debug_print("mcp9808: get config failed.\n");                             /* get config failed */
         
-        return 1;                                                         /* return error */
+        return 1;                                                                         /* return error */
     }
-    prev = (uint16_t)((uint16_t)buf[0] << 8) | buf[1];                    /* set raw data */
-    prev &= ~(1 << 2);                                                    /* clear settings */
-    prev |= select_output << 2;                                           /* set select */
-    buf[0] = (prev >> 8) & 0xFF;                                          /* set msb */
-    buf[1] = (prev >> 0) & 0xFF;                                          /* set lsb */
-    res = a_mcp9808_iic_write(handle, MCP9808_REG_CONFIG, buf, 2);        /* set config */
-    if (res != 0)                                                         /* check result */
+    prev &= MCP9808_CONFIG_CACHE_MASK;                                                    /* drop the status bits */
+    if (mcp9808_config_filter(prev, conf) != conf)                                        /* check the lock bits */
     {
-        handle->debug_print("mcp9808: set config failed.\n");             /* set config failed */
+        handle->debug_print("mcp9808: locked settings can't be changed.\n");              /* locked settings can't be changed */
         
-        return 1;                                                         /* return error */
+        return 5;                                                                         /* return error */
+    }
+    for (i = 0; i < 3; i++)                                                               /* check all thresholds */
+    {
+        if (((i < 2) && ((prev & (1 << 6)) != 0)) ||
+            ((i == 2) && ((prev & (1 << 7)) != 0)))                                       /* check the threshold lock */
+        {
+            res = a_mcp9808_threshold_read(handle, (uint8_t)(MCP9808_REG_ALERT_UPPER + i),
+                                           &threshold);                                   /* get threshold */
+            if (res != 0)                                                                 /* check result */
+            {
+                handle->debug_print("mcp9808: get threshold failed.\n");                  /* get threshold failed */
+                
+                return 1;                                                                 /* return error */
+            }
+            if (threshold != raw[i])                                                      /* check threshold */
+            {
+                handle->debug_print("mcp9808: locked settings can't be changed.\n");      /* locked settings can't be changed */
+                
+                return 5;                                                                 /* return error */
+            }
+        }
     }
     
-    return 0;                                                             /* success return 0 */
+    for (i = 0; i < 3; i++)                                                               /* set all thresholds */
+    {
+        if ((handle->cache_enable != 0) && (((handle->threshold_valid >> i) & 0x01) != 0) &&
+            (handle->threshold[i] == raw[i]))                                             /* check the cache */
+        {
+            continue;                                                                     /* skip the same threshold */
+        }
+        if (((i < 2) && ((prev & (1 << 6)) != 0)) ||
+            ((i == 2) && ((prev & (1 << 7)) != 0)))                                       /* locked and already checked */
+        {
+            continue;                                                                     /* skip the locked threshold */
+        }
+        res = a_mcp9808_threshold_write(handle, (uint8_t)(MCP9808_REG_ALERT_UPPER + i),
+                                        raw[i]);                                          /* set threshold */
+        if (res != 0)                                                                     /* check result */
+        {
+            handle->debug_print("mcp9808: set threshold failed.\n");                      /* set threshold failed */
+            
+            return 1;                                                                     /* return error */
+        }
+    }
+    if (conf != prev)                                                                     /* check config */
+    {
+        res = a_mcp9808_config_write(handle, conf);                                       /* set config */
+        if (res != 0)                                                                     /* check result */
+        {
+            handle->debug_print("mcp9808: set config failed.\n");                         /* set config failed */
+            
+            return 1;                                                                     /* return error */
+        }
+        if (((conf ^ prev) & (1 << 8)) != 0)                                              /* check shutdown */
+        {
+            handle->delay_ms(10);                                                         /* delay 10ms */
+            a_mcp9808_sample_restart(handle, (uint8_t)(config->shutdown == MCP9808_BOOL_FALSE));        /* restart the sample schedule */
+        }
+    }
+    
+    return 0;                                                                             /* success return 0 */
 }
 
 /**
- * @brief      get alert output select
+ * @brief      get the whole chip config
  * @param[in]  *handle pointer to a mcp9808 handle structure
- * @param[out] *select_output pointer to an alert output select buffer
+ * @param[out] *config pointer to a config structure
  * @return     status code
  *             - 0 success
- *             - 1 get alert output select failed
+ *             - 1 get config failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t mcp9808_get_alert_output_select(mcp9808_handle_t *handle, mcp9808_alert_output_select_t *select_output)
+uint8_t mcp9808_get_config(mcp9808_handle_t *handle, mcp9808_config_t *config)
 {
     uint8_t res;
     uint16_t prev;
-    uint8_t buf[2];
     
-    if (handle == NULL)                                                          /* check handle */
+    if (handle == NULL)                                                                      /* check handle */
     {
-        return 2;                                                                /* return error */
+        return 2;                                                                            /* return error */
     }
-    if (handle->inited != 1)                                                     /* check handle initialization */
+    if (handle->inited != 1)                                                                 /* check handle initialization */
     {
-        return 3;                                                                /* return error */
+        return 3;                                                                            /* return error */
     }
     
-    res = a_mcp9808_iic_read(handle, MCP9808_REG_CONFIG, buf, 2);                /* get config */
-    if (res != 0)                                                                /* check result */
+    res = a_mcp9808_config_read(handle, &prev);                                              /* get config */
+    if (res != 0)                                                                            /* check result */
     {
-        handle->debug_print("mcp9808: get config failed.\n");                    /* get config failed */
+        handle->debug_print("mcp9808: get config failed.\n");                                /* get config failed */
         
-        return 1;                                                                /* return error */
+        return 1;                                                                            /* return error */
+    }
+    config->hysteresis = (mcp9808_hysteresis_t)((prev >> 9) & 0x03);                         /* set hysteresis */
+    config->shutdown = (mcp9808_bool_t)((prev >> 8) & 0x01);                                 /* set shutdown */
+    config->critical_temperature_lock = (mcp9808_bool_t)((prev >> 7) & 0x01);                /* set critical temperature lock */
+    config->temperature_threshold_lock = (mcp9808_bool_t)((prev >> 6) & 0x01);               /* set temperature threshold lock */
+    config->alert_output = (mcp9808_bool_t)((prev >> 3) & 0x01);                             /* set alert output */
+    config->alert_output_select = (mcp9808_alert_output_select_t)((prev >> 2) & 0x01);       /* set alert output select */
+    config->alert_output_polarity = (mcp9808_alert_output_polarity_t)((prev >> 1) & 0x01);   /* set alert output polarity */
+    config->alert_output_mode = (mcp9808_alert_output_mode_t)((prev >> 0) & 0x01);           /* set alert output mode */
+    res = a_mcp9808_threshold_read(handle, MCP9808_REG_ALERT_UPPER, &config->high_threshold);          /* get high threshold */
+    if (res != 0)                                                                                      /* check result */
+    {
+        handle->debug_print("mcp9808: get temperature high threshold failed.\n");                      /* get temperature high threshold failed */
+        
+        return 1;                                                                                      /* return error */
+    }
+    res = a_mcp9808_threshold_read(handle, MCP9808_REG_ALERT_LOWER, &config->low_threshold);           /* get low threshold */
+    if (res != 0)                                                                                      /* check result */
+    {
+        handle->debug_print("mcp9808: get temperature low threshold failed.\n");                       /* get temperature low threshold failed */
+        
+        return 1;                                                                                      /* return error */
+    }
+    res = a_mcp9808_threshold_read(handle, MCP9808_REG_CRIT, &config->critical_temperature);           /* get critical temperature */
+    if (res != 0)                                                                                      /* check result */
+    {
+        handle->debug_print("mcp9808: get critical temperature failed.\n");                            /* get critical temperature failed */
+        
+        return 1;                                                                                      /* return error */
     }
-    prev = (uint16_t)((uint16_t)buf[0] << 8) | buf[1];                           /* set raw data */
-    *select_output = (mcp9808_alert_output_select_t)((prev >> 2) & 0x01);        /* set select */
     
-    return 0;                                                                    /* success return 0 */
+    return 0;                                                                                          /* success return 0 */
 }
 
 /**
- * @brief     set alert output polarity
+ * @brief     set the retry policy
  * @param[in] *handle pointer to a mcp9808 handle structure
- * @param[in] polarity alert output polarity
+ * @param[in] times retries of one failed transaction
+ * @param[in] backoff_ms delay before the first retry
  * @return    status code
  *            - 0 success
- *            - 1 set alert output polarity failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ *            - 4 times > MCP9808_RETRY_MAX
+ * @note      every failed register read, register write and batch read is repeated up to times,
+ *            the delay doubles after every retry and a backoff of 0 retries at once,
+ *            the default is 0 times so a failure returns at once
  */
-uint8_t mcp9808_set_alert_output_polarity(mcp9808_handle_t *handle, mcp9808_alert_output_polarity_t polarity)
+uint8_t mcp9808_set_retry(mcp9808_handle_t *handle, uint8_t times, uint16_t backoff_ms)
 {
-    uint8_t res;
-    uint16_t prev;
-    uint8_t buf[2];
-    
     if (handle == NULL)                                                   /* check handle */
     {
         return 2;                                                         /* return error */
@@ -1525,156 +2891,127 @@ uint8_t mcp9808_set_alert_output_polarity(mcp9808_handle_t *handle, mcp9808_aler
     {
         return 3;                                                         /* return error */
     }
-    
-    res = a_mcp9808_iic_read(handle, MCP9808_REG_CONFIG, buf, 2);         /* get config */
-    if (res != 0)                                                         /* check result */
-    {
-        handle->debug_print("mcp9808: get config failed.\n");             /* get config failed */
-        
-        return 1;                                                         /* return error */
-    }
-    prev = (uint16_t)((uint16_t)buf[0] << 8) | buf[1];                    /* set raw data */
-    prev &= ~(1 << 1);                                                    /* clear settings */
-    prev |= polarity << 1;                                                /* set polarity */
-    buf[0] = (prev >> 8) & 0xFF;                                          /* set msb */
-    buf[1] = (prev >> 0) & 0xFF;                                          /* set lsb */
-    res = a_mcp9808_iic_write(handle, MCP9808_REG_CONFIG, buf, 2);        /* set config */
-    if (res != 0)                                                         /* check result */
+    if (times > MCP9808_RETRY_MAX)                                        /* check times */
     {
-        handle->debug_print("mcp9808: set config failed.\n");             /* set config failed */
+        handle->debug_print("mcp9808: times > %d.\n", MCP9808_RETRY_MAX); /* times > MCP9808_RETRY_MAX */
         
-        return 1;                                                         /* return error */
+        return 4;                                                         /* return error */
     }
     
+    handle->retry_times = times;                                          /* set times */
+    handle->retry_backoff_ms = backoff_ms;                                /* set backoff */
+    
     return 0;                                                             /* success return 0 */
 }
 
 /**
- * @brief      get alert output polarity
+ * @brief      get the retry policy
  * @param[in]  *handle pointer to a mcp9808 handle structure
- * @param[out] *polarity pointer to an alert output polarity buffer
+ * @param[out] *times pointer to a times buffer
+ * @param[out] *backoff_ms pointer to a backoff buffer
  * @return     status code
  *             - 0 success
- *             - 1 get alert output polarity failed
  *             - 2 handle is NULL
- *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t mcp9808_get_alert_output_polarity(mcp9808_handle_t *handle, mcp9808_alert_output_polarity_t *polarity)
+uint8_t mcp9808_get_retry(mcp9808_handle_t *handle, uint8_t *times, uint16_t *backoff_ms)
 {
-    uint8_t res;
-    uint16_t prev;
-    uint8_t buf[2];
-    
-    if (handle == NULL)                                                   /* check handle */
-    {
-        return 2;                                                         /* return error */
-    }
-    if (handle->inited != 1)                                              /* check handle initialization */
+    if (handle == NULL)                          /* check handle */
     {
-        return 3;                                                         /* return error */
+        return 2;                                /* return error */
     }
     
-    res = a_mcp9808_iic_read(handle, MCP9808_REG_CONFIG, buf, 2);         /* get config */
-    if (res != 0)                                                         /* check result */
+    *times = handle->retry_times;                /* get times */
+    *backoff_ms = handle->retry_backoff_ms;      /* get backoff */
+    
+    return 0;                                    /* success return 0 */
+}
+
+/**
+ * @brief      get the retry counter
+ * @param[in]  *handle pointer to a mcp9808 handle structure
+ * @param[out] *counter pointer to a retry counter structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ * @note       a batch read is counted on the first handle
+ */
+uint8_t mcp9808_get_retry_counter(mcp9808_handle_t *handle, mcp9808_retry_counter_t *counter)
+{
+    if (handle == NULL)                                                           /* check handle */
     {
-        handle->debug_print("mcp9808: get config failed.\n");             /* get config failed */
-        
-        return 1;                                                         /* return error */
+        return 2;                                                                 /* return error */
     }
-    prev = (uint16_t)((uint16_t)buf[0] << 8) | buf[1];                    /* set raw data */
-    *polarity = (mcp9808_alert_output_polarity_t)((prev >> 1) & 0x01);    /* set polarity */
     
-    return 0;                                                             /* success return 0 */
+    memcpy(counter, &handle->retry_counter, sizeof(mcp9808_retry_counter_t));     /* get the counter */
+    
+    return 0;                                                                     /* success return 0 */
 }
 
 /**
- * @brief     set alert output mode
+ * @brief     clear the retry counter
  * @param[in] *handle pointer to a mcp9808 handle structure
- * @param[in] mode alert output mode
  * @return    status code
  *            - 0 success
- *            - 1 set alert output mode failed
  *            - 2 handle is NULL
- *            - 3 handle is not initialized
  * @note      none
  */
-uint8_t mcp9808_set_alert_output_mode(mcp9808_handle_t *handle, mcp9808_alert_output_mode_t mode)
+uint8_t mcp9808_clear_retry_counter(mcp9808_handle_t *handle)
 {
-    uint8_t res;
-    uint16_t prev;
-    uint8_t buf[2];
-    
-    if (handle == NULL)                                                   /* check handle */
-    {
-        return 2;                                                         /* return error */
-    }
-    if (handle->inited != 1)                                              /* check handle initialization */
+    if (handle == NULL)                                                           /* check handle */
     {
-        return 3;                                                         /* return error */
+        return 2;                                                                 /* return error */
     }
     
-    res = a_mcp9808_iic_read(handle, MCP9808_REG_CONFIG, buf, 2);         /* get config */
-    if (res != 0)                                                         /* check result */
-    {
-        handle->debug_print("mcp9808: get config failed.\n");             /* get config failed */
-        
-        return 1;                                                         /* return error */
-    }
-    prev = (uint16_t)((uint16_t)buf[0] << 8) | buf[1];                    /* set raw data */
-    prev &= ~(1 << 0);                                                    /* clear settings */
-    prev |= mode << 0;                                                    /* set mode */
-    buf[0] = (prev >> 8) & 0xFF;                                          /* set msb */
-    buf[1] = (prev >> 0) & 0xFF;                                          /* set lsb */
-    res = a_mcp9808_iic_write(handle, MCP9808_REG_CONFIG, buf, 2);        /* set config */
-    if (res != 0)                                                         /* check result */
-    {
-        handle->debug_print("mcp9808: set config failed.\n");             /* set config failed */
-        
-        return 1;                                                         /* return error */
-    }
+    memset(&handle->retry_counter, 0, sizeof(mcp9808_retry_counter_t));           /* clear the counter */
     
-    return 0;                                                             /* success return 0 */
+    return 0;                                                                     /* success return 0 */
 }
 
+#if (MCP9808_USE_STATS == 1)
 /**
- * @brief      get alert output mode
+ * @brief      get the stats
  * @param[in]  *handle pointer to a mcp9808 handle structure
- * @param[out] *mode pointer to an alert output mode buffer
+ * @param[out] *stats pointer to a stats structure
  * @return     status code
  *             - 0 success
- *             - 1 get alert output mode failed
  *             - 2 handle is NULL
- *             - 3 handle is not initialized
- * @note       none
+ * @note       every bus transaction is counted, so a retried transaction is counted once per attempt,
+ *             bucket 0 of a histogram holds 0us and bucket n holds [2^(n - 1), 2^n)us,
+ *             the last bucket also holds every longer latency, a batch read is counted on the first handle
  */
-uint8_t mcp9808_get_alert_output_mode(mcp9808_handle_t *handle, mcp9808_alert_output_mode_t *mode)
+uint8_t mcp9808_get_stats(mcp9808_handle_t *handle, mcp9808_stats_t *stats)
 {
-    uint8_t res;
-    uint16_t prev;
-    uint8_t buf[2];
-    
-    if (handle == NULL)                                                   /* check handle */
-    {
-        return 2;                                                         /* return error */
-    }
-    if (handle->inited != 1)                                              /* check handle initialization */
+    if (handle == NULL)                                          /* check handle */
     {
-        return 3;                                                         /* return error */
+        return 2;                                                /* return error */
     }
     
-    res = a_mcp9808_iic_read(handle, MCP9808_REG_CONFIG, buf, 2);         /* get config */
-    if (res != 0)                                                         /* check result */
+    memcpy(stats, &handle->stats, sizeof(mcp9808_stats_t));      /* get the stats */
+    
+    return 0;                                                    /* success return 0 */
+}
+
+/**
+ * @brief     reset the stats
+ * @param[in] *handle pointer to a mcp9808 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      none
+ */
+uint8_t mcp9808_reset_stats(mcp9808_handle_t *handle)
+{
+    if (handle == NULL)                                          /* check handle */
     {
-        handle->debug_print("mcp9808: get config failed.\n");             /* get config failed */
-        
-        return 1;                                                         /* return error */
+        return 2;                                                /* return error */
     }
-    prev = (uint16_t)((uint16_t)buf[0] << 8) | buf[1];                    /* set raw data */
-    *mode = (mcp9808_alert_output_mode_t)((prev >> 0) & 0x01);            /* set mode */
     
-    return 0;                                                             /* success return 0 */
+    memset(&handle->stats, 0, sizeof(mcp9808_stats_t));          /* clear the stats */
+    
+    return 0;                                                    /* success return 0 */
 }
+#endif
 
 /**
  * @brief     set the chip register
@@ -1702,6 +3039,25 @@ uint8_t mcp9808_set_reg(mcp9808_handle_t *handle, uint8_t reg, uint8_t *buf, uin
         return 3;                                               /* return error */
     }
     
+    if (reg == MCP9808_REG_CONFIG)                              /* check config */
+    {
+        handle->config_valid = 0;                               /* invalidate the config cache */
+        handle->sample_valid = 0;                               /* invalidate the scheduled sample */
+    }
+    else if ((reg >= MCP9808_REG_ALERT_UPPER) &&
+             (reg <= MCP9808_REG_CRIT))                         /* check threshold */
+    {
+        handle->threshold_valid = 0;                            /* invalidate the threshold cache */
+    }
+    else if (reg == MCP9808_REG_RESOLUTION)                     /* check resolution */
+    {
+        handle->resolution_valid = 0;                           /* invalidate the resolution cache */
+        handle->sample_valid = 0;                               /* invalidate the scheduled sample */
+    }
+    else
+    {
+        /* do nothing */
+    }
     res = a_mcp9808_iic_write(handle, reg, buf, len);           /* write data */
     if (res != 0)                                               /* check result */
     {
@@ -1709,6 +3065,11 @@ uint8_t mcp9808_set_reg(mcp9808_handle_t *handle, uint8_t reg, uint8_t *buf, uin
         
         return 1;                                               /* return error */
     }
+    if ((reg == MCP9808_REG_RESOLUTION) && (len != 0))          /* check resolution */
+    {
+        handle->resolution = buf[0] & 0x03;                     /* save the resolution */
+        handle->resolution_valid = 1;                           /* set valid */
+    }
     
     return 0;                                                   /* success return 0 */
 }
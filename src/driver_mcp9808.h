@@ -41,6 +41,51 @@
 #include <stdint.h>
 #include <string.h>
 
+/**
+ * @brief batch read size definition
+ */
+#ifndef MCP9808_READ_BATCH_MAX
+    #define MCP9808_READ_BATCH_MAX 8        /**< max devices of one batch read */
+#endif
+
+/**
+ * @brief retry size definition
+ */
+#ifndef MCP9808_RETRY_MAX
+    #define MCP9808_RETRY_MAX 8        /**< max retries of one transaction */
+#endif
+
+/**
+ * @brief float api enable definition
+ * @note  set it to 0 to drop every float api on fpu-less targets
+ */
+#ifndef MCP9808_USE_FLOAT
+    #define MCP9808_USE_FLOAT 1        /**< build the float apis */
+#endif
+
+/**
+ * @brief stats enable definition
+ * @note  set it to 1 to build the stats block and its apis
+ */
+#ifndef MCP9808_USE_STATS
+    #define MCP9808_USE_STATS 0        /**< drop the stats block */
+#endif
+
+/**
+ * @brief stats histogram size definition
+ */
+#ifndef MCP9808_STATS_BUCKET
+    #define MCP9808_STATS_BUCKET 16        /**< log2 latency buckets of one operation */
+#endif
+
+/**
+ * @brief static probe enable definition
+ * @note  set it to 1 to build usdt probes from sys/sdt.h, the probes compile to nothing when it is 0
+ */
+#ifndef MCP9808_USE_PROBE
+    #define MCP9808_USE_PROBE 0        /**< build the static probes */
+#endif
+
 #ifdef __cplusplus
 extern "C"{
 #endif
@@ -101,6 +146,16 @@ typedef enum
     MCP9808_STATUS_T_LOWER = 0x02,        /**< temperature lower boundary */
 } mcp9808_status_t;
 
+/**
+ * @brief mcp9808 status flag enumeration definition
+ */
+typedef enum
+{
+    MCP9808_STATUS_FLAG_T_LOWER = (1 << 0),        /**< temperature lower boundary flag */
+    MCP9808_STATUS_FLAG_T_UPPER = (1 << 1),        /**< temperature upper boundary flag */
+    MCP9808_STATUS_FLAG_CRIT    = (1 << 2),        /**< critical temperature boundary flag */
+} mcp9808_status_flag_t;
+
 /**
  * @brief mcp9808 resolution enumeration definition
  */
@@ -139,6 +194,50 @@ typedef enum
     MCP9808_ALERT_OUTPUT_MODE_INTERRUPT  = 0x01,        /**< interrupt output mode */
 } mcp9808_alert_output_mode_t;
 
+/**
+ * @brief mcp9808 retry counter structure definition
+ */
+typedef struct mcp9808_retry_counter_s
+{
+    uint32_t read_error;         /**< failed register reads */
+    uint32_t write_error;        /**< failed register writes */
+    uint32_t batch_error;        /**< failed batch reads */
+    uint32_t retry;              /**< retried transactions */
+    uint32_t recovered;          /**< transactions passed after a retry */
+    uint32_t exhausted;          /**< transactions failed after every retry */
+} mcp9808_retry_counter_t;
+
+/**
+ * @brief mcp9808 stats operation enumeration definition
+ */
+typedef enum
+{
+    MCP9808_STATS_OPERATION_READ  = 0x00,        /**< register read */
+    MCP9808_STATS_OPERATION_WRITE = 0x01,        /**< register write */
+    MCP9808_STATS_OPERATION_BATCH = 0x02,        /**< batch read */
+    MCP9808_STATS_OPERATION_IRQ   = 0x03,        /**< irq handler */
+} mcp9808_stats_operation_t;
+
+#if (MCP9808_USE_STATS == 1)
+
+/**
+ * @brief mcp9808 stats structure definition
+ */
+typedef struct mcp9808_stats_s
+{
+    uint32_t read;                                           /**< register read transactions */
+    uint32_t write;                                          /**< register write transactions */
+    uint32_t batch;                                          /**< batch read transactions */
+    uint32_t read_byte;                                      /**< bytes read */
+    uint32_t write_byte;                                     /**< bytes written */
+    uint32_t failure[8];                                     /**< failed transactions by link status code, 7 also counts larger codes */
+    uint32_t irq;                                            /**< irqs handled */
+    uint32_t callback;                                       /**< callbacks fired */
+    uint32_t histogram[4][MCP9808_STATS_BUCKET];             /**< latency histogram of every operation */
+    uint32_t max_us[4];                                      /**< max latency of every operation */
+} mcp9808_stats_t;
+#endif
+
 /**
  * @brief mcp9808 handle structure definition
  */
@@ -148,13 +247,64 @@ typedef struct mcp9808_handle_s
     uint8_t (*iic_deinit)(void);                                                        /**< point to an iic_deinit function address */
     uint8_t (*iic_write)(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);        /**< point to an iic_write function address */
     uint8_t (*iic_read)(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);         /**< point to an iic_read function address */
+    uint8_t (*iic_read_cmd)(uint8_t addr, uint8_t *buf, uint16_t len);                  /**< point to an iic_read_cmd function address */
+    uint8_t (*iic_read_batch)(uint8_t *addr, uint8_t *reg, uint8_t *buf,
+                              uint16_t len, uint16_t num);                              /**< point to an iic_read_batch function address */
+    uint8_t (*iic_write_ctx)(void *bus, uint8_t addr, uint8_t reg,
+                             uint8_t *buf, uint16_t len);                               /**< point to an iic_write_ctx function address */
+    uint8_t (*iic_read_ctx)(void *bus, uint8_t addr, uint8_t reg,
+                            uint8_t *buf, uint16_t len);                                /**< point to an iic_read_ctx function address */
+    uint8_t (*iic_read_cmd_ctx)(void *bus, uint8_t addr, uint8_t *buf, uint16_t len);   /**< point to an iic_read_cmd_ctx function address */
+    uint8_t (*iic_read_batch_ctx)(void *bus, uint8_t *addr, uint8_t *reg, uint8_t *buf,
+                                  uint16_t len, uint16_t num);                          /**< point to an iic_read_batch_ctx function address */
+    void *bus;                                                                          /**< bus context passed to the ctx functions */
     void (*delay_ms)(uint32_t ms);                                                      /**< point to a delay_ms function address */
+    uint32_t (*get_time_us)(void);                                                      /**< point to a get_time_us function address */
+    uint32_t (*stats_time_us)(void);                                                    /**< point to a stats_time_us function address */
     void (*debug_print)(const char *const fmt, ...);                                    /**< point to a debug_print function address */
     void (*receive_callback)(uint8_t type);                                             /**< point to a receive_callback function address */
+    void (*receive_callback_ext)(uint8_t flags, int16_t raw);                           /**< point to a receive_callback_ext function address */
     uint8_t iic_addr;                                                                   /**< iic device address */
     uint8_t inited;                                                                     /**< inited flag */
+    uint8_t cache_enable;                                                               /**< register cache enable flag */
+    uint8_t config_valid;                                                               /**< config cache valid flag */
+    uint16_t config;                                                                    /**< config register cache */
+    uint8_t threshold_valid;                                                            /**< threshold cache valid flags */
+    uint16_t threshold[3];                                                              /**< upper, lower and critical threshold cache */
+    uint8_t pointer_valid;                                                              /**< register pointer valid flag */
+    uint8_t pointer;                                                                    /**< last register pointer */
+    uint8_t resolution_valid;                                                           /**< resolution valid flag, kept for the scheduler in every cache mode */
+    uint8_t resolution;                                                                 /**< last known resolution register */
+    uint8_t sample_valid;                                                               /**< scheduled sample valid flag */
+    uint8_t sample_wait;                                                                /**< first conversion pending flag */
+    int16_t sample_raw;                                                                 /**< scheduled sample raw data */
+    uint32_t sample_time;                                                               /**< scheduled sample timestamp in us */
+    uint8_t retry_times;                                                                /**< retries of one failed transaction */
+    uint16_t retry_backoff_ms;                                                          /**< delay before the first retry */
+    mcp9808_retry_counter_t retry_counter;                                              /**< retry counter */
+#if (MCP9808_USE_STATS == 1)
+    mcp9808_stats_t stats;                                                              /**< stats block */
+#endif
 } mcp9808_handle_t;
 
+/**
+ * @brief mcp9808 config structure definition
+ */
+typedef struct mcp9808_config_s
+{
+    mcp9808_hysteresis_t hysteresis;                            /**< temperature threshold hysteresis */
+    mcp9808_bool_t shutdown;                                    /**< shutdown */
+    mcp9808_bool_t critical_temperature_lock;                   /**< critical temperature lock */
+    mcp9808_bool_t temperature_threshold_lock;                  /**< temperature threshold lock */
+    mcp9808_bool_t alert_output;                                /**< alert output */
+    mcp9808_alert_output_select_t alert_output_select;          /**< alert output select */
+    mcp9808_alert_output_polarity_t alert_output_polarity;      /**< alert output polarity */
+    mcp9808_alert_output_mode_t alert_output_mode;              /**< alert output mode */
+    uint16_t high_threshold;                                    /**< temperature high threshold raw data */
+    uint16_t low_threshold;                                     /**< temperature low threshold raw data */
+    uint16_t critical_temperature;                              /**< critical temperature raw data */
+} mcp9808_config_t;
+
 /**
  * @brief mcp9808 information structure definition
  */
@@ -214,6 +364,63 @@ typedef struct mcp9808_info_s
  */
 #define DRIVER_MCP9808_LINK_IIC_READ(HANDLE, FUC)                (HANDLE)->iic_read = FUC
 
+/**
+ * @brief     link iic_read_cmd function
+ * @param[in] HANDLE pointer to a mcp9808 handle structure
+ * @param[in] FUC pointer to an iic_read_cmd function address
+ * @note      optional, when linked the driver skips the register address
+ *            if the chip register pointer already points to the register
+ */
+#define DRIVER_MCP9808_LINK_IIC_READ_CMD(HANDLE, FUC)            (HANDLE)->iic_read_cmd = FUC
+
+/**
+ * @brief     link iic_read_batch function
+ * @param[in] HANDLE pointer to a mcp9808 handle structure
+ * @param[in] FUC pointer to an iic_read_batch function address
+ * @note      optional, only mcp9808_read_batch uses it
+ */
+#define DRIVER_MCP9808_LINK_IIC_READ_BATCH(HANDLE, FUC)          (HANDLE)->iic_read_batch = FUC
+
+/**
+ * @brief     link bus context
+ * @param[in] HANDLE pointer to a mcp9808 handle structure
+ * @param[in] BUS pointer to a bus context
+ * @note      the context is passed to every linked ctx function
+ */
+#define DRIVER_MCP9808_LINK_BUS(HANDLE, BUS)                     (HANDLE)->bus = BUS
+
+/**
+ * @brief     link iic_write_ctx function
+ * @param[in] HANDLE pointer to a mcp9808 handle structure
+ * @param[in] FUC pointer to an iic_write_ctx function address
+ * @note      optional, it is used instead of iic_write when linked
+ */
+#define DRIVER_MCP9808_LINK_IIC_WRITE_CTX(HANDLE, FUC)           (HANDLE)->iic_write_ctx = FUC
+
+/**
+ * @brief     link iic_read_ctx function
+ * @param[in] HANDLE pointer to a mcp9808 handle structure
+ * @param[in] FUC pointer to an iic_read_ctx function address
+ * @note      optional, it is used instead of iic_read when linked
+ */
+#define DRIVER_MCP9808_LINK_IIC_READ_CTX(HANDLE, FUC)            (HANDLE)->iic_read_ctx = FUC
+
+/**
+ * @brief     link iic_read_cmd_ctx function
+ * @param[in] HANDLE pointer to a mcp9808 handle structure
+ * @param[in] FUC pointer to an iic_read_cmd_ctx function address
+ * @note      optional, it is used instead of iic_read_cmd when linked
+ */
+#define DRIVER_MCP9808_LINK_IIC_READ_CMD_CTX(HANDLE, FUC)        (HANDLE)->iic_read_cmd_ctx = FUC
+
+/**
+ * @brief     link iic_read_batch_ctx function
+ * @param[in] HANDLE pointer to a mcp9808 handle structure
+ * @param[in] FUC pointer to an iic_read_batch_ctx function address
+ * @note      optional, it is used instead of iic_read_batch when linked
+ */
+#define DRIVER_MCP9808_LINK_IIC_READ_BATCH_CTX(HANDLE, FUC)      (HANDLE)->iic_read_batch_ctx = FUC
+
 /**
  * @brief     link iic_write function
  * @param[in] HANDLE pointer to a mcp9808 handle structure
@@ -230,6 +437,23 @@ typedef struct mcp9808_info_s
  */
 #define DRIVER_MCP9808_LINK_DELAY_MS(HANDLE, FUC)                (HANDLE)->delay_ms = FUC
 
+/**
+ * @brief     link get_time_us function
+ * @param[in] HANDLE pointer to a mcp9808 handle structure
+ * @param[in] FUC pointer to a get_time_us function address
+ * @note      optional, a free running monotonic microsecond counter used by the scheduled read
+ */
+#define DRIVER_MCP9808_LINK_GET_TIME_US(HANDLE, FUC)             (HANDLE)->get_time_us = FUC
+
+/**
+ * @brief     link stats_time_us function
+ * @param[in] HANDLE pointer to a mcp9808 handle structure
+ * @param[in] FUC pointer to a stats_time_us function address
+ * @note      optional, a free running monotonic microsecond counter that times the stats histograms,
+ *            get_time_us is used when it is not linked and the histograms stay empty without both
+ */
+#define DRIVER_MCP9808_LINK_STATS_TIME_US(HANDLE, FUC)           (HANDLE)->stats_time_us = FUC
+
 /**
  * @brief     link debug_print function
  * @param[in] HANDLE pointer to a mcp9808 handle structure
@@ -246,6 +470,14 @@ typedef struct mcp9808_info_s
  */
 #define DRIVER_MCP9808_LINK_RECEIVE_CALLBACK(HANDLE, FUC)        (HANDLE)->receive_callback = FUC
 
+/**
+ * @brief     link receive_callback_ext function
+ * @param[in] HANDLE pointer to a mcp9808 handle structure
+ * @param[in] FUC pointer to a receive_callback_ext function address
+ * @note      the flags are mcp9808_status_flag_t bits and raw is the signed raw temperature
+ */
+#define DRIVER_MCP9808_LINK_RECEIVE_CALLBACK_EXT(HANDLE, FUC)    (HANDLE)->receive_callback_ext = FUC
+
 /**
  * @}
  */
@@ -275,7 +507,7 @@ uint8_t mcp9808_info(mcp9808_info_t *info);
  *            - 0 success
  *            - 1 set addr failed
  *            - 2 handle is NULL
- * @note      none
+ * @note      the register pointer, the caches and the scheduled sample of the previous chip are dropped
  */
 uint8_t mcp9808_set_addr(mcp9808_handle_t *handle, mcp9808_address_t addr);
 
@@ -299,7 +531,8 @@ uint8_t mcp9808_get_addr(mcp9808_handle_t *handle, mcp9808_address_t *addr);
  *            - 1 run failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ * @note      receive_callback_ext gets all flags and the temperature in one call,
+ *            the interrupt is cleared from the cached config when the cache is enabled
  */
 uint8_t mcp9808_irq_handler(mcp9808_handle_t *handle);
 
@@ -342,7 +575,59 @@ uint8_t mcp9808_deinit(mcp9808_handle_t *handle);
  *             - 3 handle is not initialized
  * @note       none
  */
+#if (MCP9808_USE_FLOAT == 1)
 uint8_t mcp9808_read(mcp9808_handle_t *handle, int16_t *raw, float *temperature_deg);
+#endif
+
+/**
+ * @brief      read temperature in millidegrees celsius
+ * @param[in]  *handle pointer to a mcp9808 handle structure
+ * @param[out] *raw pointer to a raw data buffer
+ * @param[out] *temperature_mc pointer to a converted temperature buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       integer only, the half millidegree is truncated toward zero
+ */
+uint8_t mcp9808_read_milli_c(mcp9808_handle_t *handle, int16_t *raw, int32_t *temperature_mc);
+
+/**
+ * @brief      read temperature no faster than the chip converts
+ * @param[in]  *handle pointer to a mcp9808 handle structure
+ * @param[out] *raw pointer to a raw data buffer
+ * @param[out] *fresh pointer to a fresh flag buffer
+ * @param[out] *next_us pointer to a next fresh sample timestamp buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 get_time_us is null
+ *             - 5 first conversion is not ready
+ * @note       the cached sample is returned until one conversion time has passed
+ *             since the last bus read, next_us is the get_time_us value to sleep until
+ */
+uint8_t mcp9808_read_scheduled(mcp9808_handle_t *handle, int16_t *raw, mcp9808_bool_t *fresh, uint32_t *next_us);
+
+/**
+ * @brief      read the temperature of many devices in one bus transfer
+ * @param[in]  **handle pointer to a mcp9808 handle pointer array
+ * @param[in]  num handle number
+ * @param[out] *raw pointer to a raw data array
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 iic_read_batch is null
+ *             - 5 num is invalid
+ * @note       all handles must share one bus, the batch function, retry policy, retry counters
+ *             and debug print of handle[0] are used for the whole transfer,
+ *             num is 1 to MCP9808_READ_BATCH_MAX
+ */
+uint8_t mcp9808_read_batch(mcp9808_handle_t **handle, uint8_t num, int16_t *raw);
 
 /**
  * @brief     set temperature threshold hysteresis
@@ -577,6 +862,156 @@ uint8_t mcp9808_set_alert_output_mode(mcp9808_handle_t *handle, mcp9808_alert_ou
  */
 uint8_t mcp9808_get_alert_output_mode(mcp9808_handle_t *handle, mcp9808_alert_output_mode_t *mode);
 
+/**
+ * @brief     enable or disable the register cache
+ * @param[in] *handle pointer to a mcp9808 handle structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      when enabled, the config setters reuse a write-through copy of the config
+ *            register instead of reading it back from the chip before every write,
+ *            and the threshold registers are cached in the same way
+ */
+uint8_t mcp9808_set_cache(mcp9808_handle_t *handle, mcp9808_bool_t enable);
+
+/**
+ * @brief      get the register cache status
+ * @param[in]  *handle pointer to a mcp9808 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ * @note       none
+ */
+uint8_t mcp9808_get_cache(mcp9808_handle_t *handle, mcp9808_bool_t *enable);
+
+/**
+ * @brief     invalidate the register cache
+ * @param[in] *handle pointer to a mcp9808 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      call it after the chip may have been changed behind the driver,
+ *            such as a power cycle or a bus reset
+ */
+uint8_t mcp9808_invalidate_cache(mcp9808_handle_t *handle);
+
+/**
+ * @brief     reload the register cache from the chip
+ * @param[in] *handle pointer to a mcp9808 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 resync cache failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t mcp9808_resync_cache(mcp9808_handle_t *handle);
+
+/**
+ * @brief     apply a whole chip config
+ * @param[in] *handle pointer to a mcp9808 handle structure
+ * @param[in] *config pointer to a config structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 apply config failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 raw > 0x7FF
+ *            - 5 locked settings can't be changed
+ * @note      thresholds are only written when they differ from the current value,
+ *            and the config register is written at most once after them
+ */
+uint8_t mcp9808_apply_config(mcp9808_handle_t *handle, const mcp9808_config_t *config);
+
+/**
+ * @brief      get the whole chip config
+ * @param[in]  *handle pointer to a mcp9808 handle structure
+ * @param[out] *config pointer to a config structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get config failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t mcp9808_get_config(mcp9808_handle_t *handle, mcp9808_config_t *config);
+
+/**
+ * @brief     set the retry policy
+ * @param[in] *handle pointer to a mcp9808 handle structure
+ * @param[in] times retries of one failed transaction
+ * @param[in] backoff_ms delay before the first retry
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 times > MCP9808_RETRY_MAX
+ * @note      every failed register read, register write and batch read is repeated up to times,
+ *            the delay doubles after every retry and a backoff of 0 retries at once,
+ *            the default is 0 times so a failure returns at once
+ */
+uint8_t mcp9808_set_retry(mcp9808_handle_t *handle, uint8_t times, uint16_t backoff_ms);
+
+/**
+ * @brief      get the retry policy
+ * @param[in]  *handle pointer to a mcp9808 handle structure
+ * @param[out] *times pointer to a times buffer
+ * @param[out] *backoff_ms pointer to a backoff buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ * @note       none
+ */
+uint8_t mcp9808_get_retry(mcp9808_handle_t *handle, uint8_t *times, uint16_t *backoff_ms);
+
+/**
+ * @brief      get the retry counter
+ * @param[in]  *handle pointer to a mcp9808 handle structure
+ * @param[out] *counter pointer to a retry counter structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ * @note       a batch read is counted on the first handle
+ */
+uint8_t mcp9808_get_retry_counter(mcp9808_handle_t *handle, mcp9808_retry_counter_t *counter);
+
+/**
+ * @brief     clear the retry counter
+ * @param[in] *handle pointer to a mcp9808 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      none
+ */
+uint8_t mcp9808_clear_retry_counter(mcp9808_handle_t *handle);
+
+#if (MCP9808_USE_STATS == 1)
+/**
+ * @brief      get the stats
+ * @param[in]  *handle pointer to a mcp9808 handle structure
+ * @param[out] *stats pointer to a stats structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ * @note       every bus transaction is counted, so a retried transaction is counted once per attempt,
+ *             bucket 0 of a histogram holds 0us and bucket n holds [2^(n - 1), 2^n)us,
+ *             the last bucket also holds every longer latency, a batch read is counted on the first handle
+ */
+uint8_t mcp9808_get_stats(mcp9808_handle_t *handle, mcp9808_stats_t *stats);
+
+/**
+ * @brief     reset the stats
+ * @param[in] *handle pointer to a mcp9808 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      none
+ */
+uint8_t mcp9808_reset_stats(mcp9808_handle_t *handle);
+#endif
+
 /**
  * @brief     set temperature high threshold
  * @param[in] *handle pointer to a mcp9808 handle structure
@@ -708,7 +1143,9 @@ uint8_t mcp9808_get_resolution(mcp9808_handle_t *handle, mcp9808_resolution_t *r
  *             - 3 handle is not initialized
  * @note       none
  */
+#if (MCP9808_USE_FLOAT == 1)
 uint8_t mcp9808_temperature_convert_to_register(mcp9808_handle_t *handle, float temperature_deg, uint16_t *reg);
+#endif
 
 /**
  * @brief      convert the register raw data to the temperature
@@ -721,7 +1158,35 @@ uint8_t mcp9808_temperature_convert_to_register(mcp9808_handle_t *handle, float
  *             - 3 handle is not initialized
  * @note       none
  */
+#if (MCP9808_USE_FLOAT == 1)
 uint8_t mcp9808_temperature_convert_to_data(mcp9808_handle_t *handle, uint16_t reg, float *temperature_deg);
+#endif
+
+/**
+ * @brief      convert the millidegree temperature to the register raw data
+ * @param[in]  *handle pointer to a mcp9808 handle structure
+ * @param[in]  temperature_mc temperature in millidegrees celsius
+ * @param[out] *reg pointer to a register raw buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       integer only
+ */
+uint8_t mcp9808_temperature_convert_to_register_milli_c(mcp9808_handle_t *handle, int32_t temperature_mc, uint16_t *reg);
+
+/**
+ * @brief      convert the register raw data to the millidegree temperature
+ * @param[in]  *handle pointer to a mcp9808 handle structure
+ * @param[in]  reg register raw data
+ * @param[out] *temperature_mc pointer to a converted temperature buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       integer only
+ */
+uint8_t mcp9808_temperature_convert_to_data_milli_c(mcp9808_handle_t *handle, uint16_t reg, int32_t *temperature_mc);
 
 /**
  * @}
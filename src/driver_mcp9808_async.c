@@ -0,0 +1,746 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mcp9808_async.c
+ * @brief     driver mcp9808 async source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-01-25
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/01/25  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_mcp9808_async.h"
+#include "driver_mcp9808_reg.h"
+
+/**
+ * @brief async state definition
+ */
+#define MCP9808_ASYNC_STATE_IDLE           0x00        /**< no transfer is running */
+#define MCP9808_ASYNC_STATE_BUS            0x01        /**< a bus transfer is running */
+#define MCP9808_ASYNC_STATE_DELAY          0x02        /**< a delay is running */
+
+/**
+ * @brief     check the async handle
+ * @param[in] *async pointer to a mcp9808 async handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+static uint8_t a_mcp9808_async_check(mcp9808_async_handle_t *async)
+{
+    if (async == NULL)                 /* check handle */
+    {
+        return 2;                      /* return error */
+    }
+    if (async->inited != 1)            /* check handle initialization */
+    {
+        return 3;                      /* return error */
+    }
+    
+    return 0;                          /* success return 0 */
+}
+
+/**
+ * @brief     push an operation to the queue
+ * @param[in] *async pointer to a mcp9808 async handle structure
+ * @param[in] *op pointer to an operation structure
+ * @return    status code
+ *            - 0 success
+ *            - 4 queue is full
+ * @note      none
+ */
+static uint8_t a_mcp9808_async_push(mcp9808_async_handle_t *async, const mcp9808_async_op_t *op)
+{
+    uint8_t index;
+    
+    if (async->count >= MCP9808_ASYNC_QUEUE_DEPTH)                                   /* check the queue */
+    {
+        async->handle->debug_print("mcp9808: async queue is full.\n");               /* async queue is full */
+        
+        return 4;                                                                    /* return error */
+    }
+    index = (uint8_t)((async->head + async->count) % MCP9808_ASYNC_QUEUE_DEPTH);     /* get the tail */
+    async->queue[index] = *op;                                                       /* copy the operation */
+    async->queue[index].step = 0;                                                    /* reset the step */
+    async->count++;                                                                  /* count the operation */
+    
+    return 0;                                                                        /* success return 0 */
+}
+
+/**
+ * @brief     keep the base handle caches in step with a finished transfer
+ * @param[in] *async pointer to a mcp9808 async handle structure
+ * @param[in] reg register address
+ * @param[in] write 1 if the register has been written
+ * @param[in] value written value
+ * @param[in] res transfer result
+ * @note      a written config is filtered into the config cache like the blocking call,
+ *            the other written register caches are dropped and reloaded by the next blocking call
+ */
+static void a_mcp9808_async_sync(mcp9808_async_handle_t *async, uint8_t reg, uint8_t write, uint16_t value, uint8_t res)
+{
+    mcp9808_handle_t *handle = async->handle;
+    
+    if (res != 0)                                                            /* check result */
+    {
+        handle->pointer_valid = 0;                                           /* the pointer is unknown */
+        if ((write != 0) && (reg == MCP9808_REG_CONFIG))                     /* check the config write */
+        {
+            handle->config_valid = 0;                                        /* the chip state is unknown */
+        }
+        
+        return;                                                              /* return */
+    }
+    handle->pointer = reg;                                                   /* save the pointer */
+    handle->pointer_valid = 1;                                               /* set valid */
+    if (write == 0)                                                          /* read only */
+    {
+        return;                                                              /* return */
+    }
+    if (reg == MCP9808_REG_CONFIG)                                           /* check config */
+    {
+        if ((handle->cache_enable != 0) && (handle->config_valid != 0))      /* check the cache */
+        {
+            handle->config = mcp9808_config_filter(handle->config, value);   /* update the cache */
+        }
+        handle->sample_valid = 0;                                            /* invalidate the scheduled sample */
+    }
+    else if ((reg >= MCP9808_REG_ALERT_UPPER) && (reg <= MCP9808_REG_CRIT))  /* check threshold */
+    {
+        handle->threshold_valid = 0;                                         /* invalidate the threshold cache */
+    }
+    else if (reg == MCP9808_REG_RESOLUTION)                                  /* check resolution */
+    {
+        handle->resolution_valid = 0;                                        /* invalidate the resolution cache */
+        handle->sample_valid = 0;                                            /* invalidate the scheduled sample */
+    }
+    else
+    {
+        /* do nothing */
+    }
+}
+
+/**
+ * @brief     finish the head operation
+ * @param[in] *async pointer to a mcp9808 async handle structure
+ * @param[in] res operation result
+ * @param[in] value operation value
+ * @note      the operation is removed before the callback so the callback can queue more work
+ */
+static void a_mcp9808_async_finish(mcp9808_async_handle_t *async, uint8_t res, uint16_t value)
+{
+    void (*done)(mcp9808_async_handle_t *async, uint8_t res, uint16_t value);
+    
+    done = async->queue[async->head].done;                                           /* save the callback */
+    async->head = (uint8_t)((async->head + 1) % MCP9808_ASYNC_QUEUE_DEPTH);          /* pop the operation */
+    async->count--;                                                                  /* count the operation */
+    async->state = MCP9808_ASYNC_STATE_IDLE;                                         /* set idle */
+    if (done != NULL)                                                                /* check the callback */
+    {
+        done(async, res, value);                                                     /* run the callback */
+    }
+}
+
+/**
+ * @brief     start a register write of the head operation
+ * @param[in] *async pointer to a mcp9808 async handle structure
+ * @param[in] *op pointer to the head operation
+ * @param[in] value written value
+ * @note      none
+ */
+static void a_mcp9808_async_start_write(mcp9808_async_handle_t *async, mcp9808_async_op_t *op, uint16_t value)
+{
+    op->value = value;                                                                        /* save the value */
+    if (op->len == 1)                                                                         /* one byte */
+    {
+        async->buf[0] = (uint8_t)(value & 0xFF);                                              /* set data */
+    }
+    else                                                                                      /* two bytes */
+    {
+        async->buf[0] = (uint8_t)((value >> 8) & 0xFF);                                       /* set msb */
+        async->buf[1] = (uint8_t)((value >> 0) & 0xFF);                                       /* set lsb */
+    }
+    if (async->iic_write_start(async->handle->iic_addr, op->reg, async->buf, op->len) != 0)   /* start write */
+    {
+        a_mcp9808_async_sync(async, op->reg, 1, value, 1);                                    /* sync the handle */
+        a_mcp9808_async_finish(async, 1, value);                                              /* finish with error */
+        
+        return;                                                                               /* return */
+    }
+    async->state = MCP9808_ASYNC_STATE_BUS;                                                   /* bus is running */
+}
+
+/**
+ * @brief     start the head operation
+ * @param[in] *async pointer to a mcp9808 async handle structure
+ * @note      none
+ */
+static void a_mcp9808_async_start(mcp9808_async_handle_t *async)
+{
+    mcp9808_async_op_t *op = &async->queue[async->head];
+    mcp9808_handle_t *handle = async->handle;
+    
+    switch (op->type)
+    {
+        case MCP9808_ASYNC_OP_READ :
+        case MCP9808_ASYNC_OP_READ_TEMPERATURE :
+        {
+            if (async->iic_read_start(handle->iic_addr, op->reg, async->buf, op->len) != 0)        /* start read */
+            {
+                a_mcp9808_async_sync(async, op->reg, 0, 0, 1);                                     /* sync the handle */
+                a_mcp9808_async_finish(async, 1, 0);                                               /* finish with error */
+                
+                break;
+            }
+            async->state = MCP9808_ASYNC_STATE_BUS;                                                /* bus is running */
+            
+            break;
+        }
+        case MCP9808_ASYNC_OP_WRITE :
+        {
+            a_mcp9808_async_start_write(async, op, op->value);                                     /* start write */
+            
+            break;
+        }
+        case MCP9808_ASYNC_OP_MODIFY :
+        {
+            if ((op->reg == MCP9808_REG_CONFIG) &&
+                (handle->cache_enable != 0) && (handle->config_valid != 0))                        /* check the config cache */
+            {
+                op->step = 1;                                                                      /* skip the read */
+                a_mcp9808_async_start_write(async, op,
+                                            (uint16_t)((handle->config & ~op->mask) |
+                                                       (op->value & op->mask)));                   /* start write */
+                
+                break;
+            }
+            if (async->iic_read_start(handle->iic_addr, op->reg, async->buf, op->len) != 0)        /* start read */
+            {
+                a_mcp9808_async_sync(async, op->reg, 0, 0, 1);                                     /* sync the handle */
+                a_mcp9808_async_finish(async, 1, 0);                                               /* finish with error */
+                
+                break;
+            }
+            async->state = MCP9808_ASYNC_STATE_BUS;                                                /* bus is running */
+            
+            break;
+        }
+        case MCP9808_ASYNC_OP_DELAY :
+        {
+            if (op->step != 0)                                                                     /* check the previous step */
+            {
+                a_mcp9808_async_finish(async, 1, 0);                                               /* finish with error */
+                
+                break;
+            }
+            async->start_time = async->get_time_us();                                              /* save the start time */
+            async->state = MCP9808_ASYNC_STATE_DELAY;                                              /* delay is running */
+            
+            break;
+        }
+        default :
+        {
+            a_mcp9808_async_finish(async, 1, 0);                                                   /* unknown operation */
+            
+            break;
+        }
+    }
+}
+
+/**
+ * @brief     finish the bus transfer of the head operation
+ * @param[in] *async pointer to a mcp9808 async handle structure
+ * @param[in] res transfer result
+ * @note      none
+ */
+static void a_mcp9808_async_bus_done(mcp9808_async_handle_t *async, uint8_t res)
+{
+    mcp9808_async_op_t *op = &async->queue[async->head];
+    uint16_t value;
+    
+    if ((op->type == MCP9808_ASYNC_OP_WRITE) ||
+        ((op->type == MCP9808_ASYNC_OP_MODIFY) && (op->step != 0)))                      /* write finished */
+    {
+        a_mcp9808_async_sync(async, op->reg, 1, op->value, res);                         /* sync the handle */
+        a_mcp9808_async_finish(async, res, op->value);                                   /* finish */
+        
+        return;                                                                          /* return */
+    }
+    
+    a_mcp9808_async_sync(async, op->reg, 0, 0, res);                                     /* sync the handle */
+    if (res != 0)                                                                        /* check result */
+    {
+        a_mcp9808_async_finish(async, res, 0);                                           /* finish with error */
+        
+        return;                                                                          /* return */
+    }
+    if (op->len == 1)                                                                    /* one byte */
+    {
+        value = async->buf[0];                                                           /* set value */
+    }
+    else                                                                                 /* two bytes */
+    {
+        value = (uint16_t)((uint16_t)async->buf[0] << 8) | async->buf[1];                /* set value */
+    }
+    if (op->type == MCP9808_ASYNC_OP_MODIFY)                                             /* read finished */
+    {
+        op->step = 1;                                                                    /* write step */
+        a_mcp9808_async_start_write(async, op,
+                                    (uint16_t)((value & ~op->mask) |
+                                               (op->value & op->mask)));                 /* start write */
+        
+        return;                                                                          /* return */
+    }
+    if (op->type == MCP9808_ASYNC_OP_READ_TEMPERATURE)                                   /* temperature */
+    {
+        value &= ~(7 << 13);                                                             /* clear flags */
+        if ((value & (1 << 12)) != 0)                                                    /* check signed bit */
+        {
+            value |= (uint16_t)(0x7 << 13);                                              /* set signed bits */
+        }
+    }
+    a_mcp9808_async_finish(async, 0, value);                                             /* finish */
+}
+
+/**
+ * @brief     finish the config write of a shutdown change
+ * @param[in] *async pointer to a mcp9808 async handle structure
+ * @param[in] res operation result
+ * @param[in] value written config value
+ * @note      a failed write marks the following delay failed so the caller gets the error,
+ *            a wake up arms the first conversion wait like the blocking call
+ */
+static void a_mcp9808_async_shutdown_done(mcp9808_async_handle_t *async, uint8_t res, uint16_t value)
+{
+    mcp9808_handle_t *handle = async->handle;
+    
+    if (res != 0)                                                                    /* check result */
+    {
+        if ((async->count != 0) &&
+            (async->queue[async->head].type == MCP9808_ASYNC_OP_DELAY))              /* check the settling delay */
+        {
+            async->queue[async->head].step = 1;                                      /* mark the delay failed */
+        }
+        
+        return;                                                                      /* return */
+    }
+    handle->sample_valid = 0;                                                        /* drop the sample */
+    handle->sample_wait = 0;                                                         /* clear the wait flag */
+    if (((value & (1 << 8)) == 0) && (handle->get_time_us != NULL))                  /* check the wake up */
+    {
+        handle->sample_time = handle->get_time_us();                                 /* save the wake up time */
+        handle->sample_wait = 1;                                                     /* wait for the first conversion */
+    }
+}
+
+/**
+ * @brief     initialize the async handle
+ * @param[in] *async pointer to a mcp9808 async handle structure
+ * @param[in] *handle pointer to an inited mcp9808 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized or linked functions are NULL
+ * @note      the base handle keeps the address, the debug print and the register cache
+ */
+uint8_t mcp9808_async_init(mcp9808_async_handle_t *async, mcp9808_handle_t *handle)
+{
+    if ((async == NULL) || (handle == NULL))                                     /* check handle */
+    {
+        return 2;                                                                /* return error */
+    }
+    if (handle->inited != 1)                                                     /* check handle initialization */
+    {
+        return 3;                                                                /* return error */
+    }
+    if (async->iic_read_start == NULL)                                           /* check iic_read_start */
+    {
+        handle->debug_print("mcp9808: iic_read_start is null.\n");               /* iic_read_start is null */
+        
+        return 3;                                                                /* return error */
+    }
+    if (async->iic_write_start == NULL)                                          /* check iic_write_start */
+    {
+        handle->debug_print("mcp9808: iic_write_start is null.\n");              /* iic_write_start is null */
+        
+        return 3;                                                                /* return error */
+    }
+    if (async->iic_status == NULL)                                               /* check iic_status */
+    {
+        handle->debug_print("mcp9808: iic_status is null.\n");                   /* iic_status is null */
+        
+        return 3;                                                                /* return error */
+    }
+    if (async->get_time_us == NULL)                                              /* check get_time_us */
+    {
+        handle->debug_print("mcp9808: get_time_us is null.\n");                  /* get_time_us is null */
+        
+        return 3;                                                                /* return error */
+    }
+    
+    async->handle = handle;                                                      /* save the base handle */
+    async->head = 0;                                                             /* reset the head */
+    async->count = 0;                                                            /* reset the count */
+    async->state = MCP9808_ASYNC_STATE_IDLE;                                     /* set idle */
+    async->inited = 1;                                                           /* flag finish initialization */
+    
+    return 0;                                                                    /* success return 0 */
+}
+
+/**
+ * @brief     close the async handle
+ * @param[in] *async pointer to a mcp9808 async handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 operations are pending
+ * @note      none
+ */
+uint8_t mcp9808_async_deinit(mcp9808_async_handle_t *async)
+{
+    uint8_t res;
+    
+    res = a_mcp9808_async_check(async);                                          /* check handle */
+    if (res != 0)                                                                /* check result */
+    {
+        return res;                                                              /* return error */
+    }
+    if (async->count != 0)                                                       /* check the queue */
+    {
+        async->handle->debug_print("mcp9808: operations are pending.\n");        /* operations are pending */
+        
+        return 4;                                                                /* return error */
+    }
+    
+    async->inited = 0;                                                           /* flag close */
+    
+    return 0;                                                                    /* success return 0 */
+}
+
+/**
+ * @brief     drive the async state machine
+ * @param[in] *async pointer to a mcp9808 async handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      call it from the main loop, it never waits on the bus
+ */
+uint8_t mcp9808_async_poll(mcp9808_async_handle_t *async)
+{
+    uint8_t res;
+    uint8_t status;
+    
+    res = a_mcp9808_async_check(async);                                                          /* check handle */
+    if (res != 0)                                                                                /* check result */
+    {
+        return res;                                                                              /* return error */
+    }
+    
+    while (async->count != 0)                                                                    /* run the queue */
+    {
+        if (async->state == MCP9808_ASYNC_STATE_IDLE)                                            /* idle */
+        {
+            a_mcp9808_async_start(async);                                                        /* start the head operation */
+        }
+        else if (async->state == MCP9808_ASYNC_STATE_BUS)                                        /* bus transfer */
+        {
+            status = async->iic_status();                                                        /* get bus status */
+            if (status == MCP9808_ASYNC_BUS_STATUS_BUSY)                                         /* still running */
+            {
+                break;                                                                           /* try later */
+            }
+            a_mcp9808_async_bus_done(async, (uint8_t)((status == MCP9808_ASYNC_BUS_STATUS_DONE) ? 0 : 1));        /* finish the transfer */
+        }
+        else                                                                                     /* delay */
+        {
+            if ((async->get_time_us() - async->start_time) <
+                async->queue[async->head].delay_us)                                              /* still waiting */
+            {
+                break;                                                                           /* try later */
+            }
+            a_mcp9808_async_finish(async, 0, 0);                                                 /* finish the delay */
+        }
+    }
+    
+    return 0;                                                                                    /* success return 0 */
+}
+
+/**
+ * @brief      get the pending operation number
+ * @param[in]  *async pointer to a mcp9808 async handle structure
+ * @param[out] *count pointer to a count buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t mcp9808_async_get_pending(mcp9808_async_handle_t *async, uint8_t *count)
+{
+    uint8_t res;
+    
+    res = a_mcp9808_async_check(async);        /* check handle */
+    if (res != 0)                              /* check result */
+    {
+        return res;                            /* return error */
+    }
+    
+    *count = async->count;                     /* get the count */
+    
+    return 0;                                  /* success return 0 */
+}
+
+/**
+ * @brief     queue a register read
+ * @param[in] *async pointer to a mcp9808 async handle structure
+ * @param[in] reg register address
+ * @param[in] len register length, 1 or 2
+ * @param[in] *done pointer to a completion callback
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 queue is full
+ *            - 5 len is invalid
+ * @note      the read value is passed to the callback
+ */
+uint8_t mcp9808_async_read_reg(mcp9808_async_handle_t *async, uint8_t reg, uint8_t len,
+                               void (*done)(mcp9808_async_handle_t *async, uint8_t res, uint16_t value))
+{
+    uint8_t res;
+    mcp9808_async_op_t op;
+    
+    res = a_mcp9808_async_check(async);                                  /* check handle */
+    if (res != 0)                                                        /* check result */
+    {
+        return res;                                                      /* return error */
+    }
+    if ((len != 1) && (len != 2))                                        /* check len */
+    {
+        async->handle->debug_print("mcp9808: len is invalid.\n");        /* len is invalid */
+        
+        return 5;                                                        /* return error */
+    }
+    
+    memset(&op, 0, sizeof(mcp9808_async_op_t));                          /* clear the operation */
+    op.type = MCP9808_ASYNC_OP_READ;                                     /* set type */
+    op.reg = reg;                                                        /* set reg */
+    op.len = len;                                                        /* set len */
+    op.done = done;                                                      /* set callback */
+    
+    return a_mcp9808_async_push(async, &op);                             /* push the operation */
+}
+
+/**
+ * @brief     queue a register write
+ * @param[in] *async pointer to a mcp9808 async handle structure
+ * @param[in] reg register address
+ * @param[in] value written value
+ * @param[in] len register length, 1 or 2
+ * @param[in] *done pointer to a completion callback
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 queue is full
+ *            - 5 len is invalid
+ * @note      done can be NULL
+ */
+uint8_t mcp9808_async_write_reg(mcp9808_async_handle_t *async, uint8_t reg, uint16_t value, uint8_t len,
+                                void (*done)(mcp9808_async_handle_t *async, uint8_t res, uint16_t value))
+{
+    uint8_t res;
+    mcp9808_async_op_t op;
+    
+    res = a_mcp9808_async_check(async);                                  /* check handle */
+    if (res != 0)                                                        /* check result */
+    {
+        return res;                                                      /* return error */
+    }
+    if ((len != 1) && (len != 2))                                        /* check len */
+    {
+        async->handle->debug_print("mcp9808: len is invalid.\n");        /* len is invalid */
+        
+        return 5;                                                        /* return error */
+    }
+    
+    memset(&op, 0, sizeof(mcp9808_async_op_t));                          /* clear the operation */
+    op.type = MCP9808_ASYNC_OP_WRITE;                                    /* set type */
+    op.reg = reg;                                                        /* set reg */
+    op.len = len;                                                        /* set len */
+    op.value = value;                                                    /* set value */
+    op.done = done;                                                      /* set callback */
+    
+    return a_mcp9808_async_push(async, &op);                             /* push the operation */
+}
+
+/**
+ * @brief     queue a register read-modify-write
+ * @param[in] *async pointer to a mcp9808 async handle structure
+ * @param[in] reg register address
+ * @param[in] mask modified bits
+ * @param[in] value new value of the modified bits
+ * @param[in] *done pointer to a completion callback
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 queue is full
+ * @note      the config register read is skipped when the config cache is valid
+ */
+uint8_t mcp9808_async_modify_reg(mcp9808_async_handle_t *async, uint8_t reg, uint16_t mask, uint16_t value,
+                                 void (*done)(mcp9808_async_handle_t *async, uint8_t res, uint16_t value))
+{
+    uint8_t res;
+    mcp9808_async_op_t op;
+    
+    res = a_mcp9808_async_check(async);                                  /* check handle */
+    if (res != 0)                                                        /* check result */
+    {
+        return res;                                                      /* return error */
+    }
+    
+    memset(&op, 0, sizeof(mcp9808_async_op_t));                          /* clear the operation */
+    op.type = MCP9808_ASYNC_OP_MODIFY;                                   /* set type */
+    op.reg = reg;                                                        /* set reg */
+    op.len = (reg == MCP9808_REG_RESOLUTION) ? 1 : 2;                    /* set len */
+    op.mask = mask;                                                      /* set mask */
+    op.value = value;                                                    /* set value */
+    op.done = done;                                                      /* set callback */
+    
+    return a_mcp9808_async_push(async, &op);                             /* push the operation */
+}
+
+/**
+ * @brief     queue a non-blocking delay
+ * @param[in] *async pointer to a mcp9808 async handle structure
+ * @param[in] ms delay time
+ * @param[in] *done pointer to a completion callback
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 queue is full
+ * @note      the following operations wait until the delay has passed
+ */
+uint8_t mcp9808_async_delay(mcp9808_async_handle_t *async, uint32_t ms,
+                            void (*done)(mcp9808_async_handle_t *async, uint8_t res, uint16_t value))
+{
+    uint8_t res;
+    mcp9808_async_op_t op;
+    
+    res = a_mcp9808_async_check(async);                                  /* check handle */
+    if (res != 0)                                                        /* check result */
+    {
+        return res;                                                      /* return error */
+    }
+    
+    memset(&op, 0, sizeof(mcp9808_async_op_t));                          /* clear the operation */
+    op.type = MCP9808_ASYNC_OP_DELAY;                                    /* set type */
+    op.delay_us = ms * 1000;                                             /* set delay */
+    op.done = done;                                                      /* set callback */
+    
+    return a_mcp9808_async_push(async, &op);                             /* push the operation */
+}
+
+/**
+ * @brief     queue a temperature read
+ * @param[in] *async pointer to a mcp9808 async handle structure
+ * @param[in] *done pointer to a completion callback
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 queue is full
+ * @note      the callback value is the signed raw temperature, 0.0625C per lsb
+ */
+uint8_t mcp9808_async_read_temperature(mcp9808_async_handle_t *async,
+                                       void (*done)(mcp9808_async_handle_t *async, uint8_t res, uint16_t value))
+{
+    uint8_t res;
+    mcp9808_async_op_t op;
+    
+    res = a_mcp9808_async_check(async);                                  /* check handle */
+    if (res != 0)                                                        /* check result */
+    {
+        return res;                                                      /* return error */
+    }
+    
+    memset(&op, 0, sizeof(mcp9808_async_op_t));                          /* clear the operation */
+    op.type = MCP9808_ASYNC_OP_READ_TEMPERATURE;                         /* set type */
+    op.reg = MCP9808_REG_TEMPERATURE;                                    /* set reg */
+    op.len = 2;                                                          /* set len */
+    op.done = done;                                                      /* set callback */
+    
+    return a_mcp9808_async_push(async, &op);                             /* push the operation */
+}
+
+/**
+ * @brief     queue a shutdown change
+ * @param[in] *async pointer to a mcp9808 async handle structure
+ * @param[in] enable bool value
+ * @param[in] *done pointer to a completion callback
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 queue is full
+ * @note      the 10ms settling time is queued as a delay, done runs after it,
+ *            a failed config write skips the delay and done gets res 1
+ */
+uint8_t mcp9808_async_set_shutdown(mcp9808_async_handle_t *async, mcp9808_bool_t enable,
+                                   void (*done)(mcp9808_async_handle_t *async, uint8_t res, uint16_t value))
+{
+    uint8_t res;
+    
+    res = a_mcp9808_async_check(async);                                                   /* check handle */
+    if (res != 0)                                                                         /* check result */
+    {
+        return res;                                                                       /* return error */
+    }
+    if (async->count > (MCP9808_ASYNC_QUEUE_DEPTH - 2))                                   /* check the queue */
+    {
+        async->handle->debug_print("mcp9808: async queue is full.\n");                    /* async queue is full */
+        
+        return 4;                                                                         /* return error */
+    }
+    
+    res = mcp9808_async_modify_reg(async, MCP9808_REG_CONFIG, (uint16_t)(1 << 8),
+                                   (uint16_t)((uint16_t)enable << 8),
+                                   a_mcp9808_async_shutdown_done);                        /* set shutdown */
+    if (res != 0)                                                                         /* check result */
+    {
+        return res;                                                                       /* return error */
+    }
+    
+    return mcp9808_async_delay(async, 10, done);                                          /* delay 10ms */
+}
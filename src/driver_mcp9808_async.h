@@ -0,0 +1,335 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mcp9808_async.h
+ * @brief     driver mcp9808 async header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-01-25
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/01/25  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_MCP9808_ASYNC_H
+#define DRIVER_MCP9808_ASYNC_H
+
+#include "driver_mcp9808.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup mcp9808_async_driver mcp9808 async driver function
+ * @brief    mcp9808 async driver modules
+ * @ingroup  mcp9808_driver
+ * @{
+ */
+
+/**
+ * @brief async queue depth definition
+ */
+#ifndef MCP9808_ASYNC_QUEUE_DEPTH
+    #define MCP9808_ASYNC_QUEUE_DEPTH 8        /**< max queued operations */
+#endif
+
+/**
+ * @brief mcp9808 async bus status enumeration definition
+ */
+typedef enum
+{
+    MCP9808_ASYNC_BUS_STATUS_DONE  = 0x00,        /**< transfer finished */
+    MCP9808_ASYNC_BUS_STATUS_ERROR = 0x01,        /**< transfer failed */
+    MCP9808_ASYNC_BUS_STATUS_BUSY  = 0x02,        /**< transfer is running */
+} mcp9808_async_bus_status_t;
+
+/**
+ * @brief mcp9808 async operation type enumeration definition
+ */
+typedef enum
+{
+    MCP9808_ASYNC_OP_READ             = 0x00,        /**< read a register */
+    MCP9808_ASYNC_OP_WRITE            = 0x01,        /**< write a register */
+    MCP9808_ASYNC_OP_MODIFY           = 0x02,        /**< read, modify and write a register */
+    MCP9808_ASYNC_OP_DELAY            = 0x03,        /**< wait without blocking */
+    MCP9808_ASYNC_OP_READ_TEMPERATURE = 0x04,        /**< read and decode the temperature */
+} mcp9808_async_op_type_t;
+
+/**
+ * @brief mcp9808 async handle structure forward definition
+ */
+typedef struct mcp9808_async_handle_s mcp9808_async_handle_t;
+
+/**
+ * @brief mcp9808 async operation structure definition
+ */
+typedef struct mcp9808_async_op_s
+{
+    uint8_t type;                                                                       /**< operation type */
+    uint8_t reg;                                                                        /**< register address */
+    uint8_t len;                                                                        /**< register length */
+    uint8_t step;                                                                       /**< operation step */
+    uint16_t value;                                                                     /**< written or read value */
+    uint16_t mask;                                                                      /**< modified bits */
+    uint32_t delay_us;                                                                  /**< delay time */
+    void (*done)(mcp9808_async_handle_t *async, uint8_t res, uint16_t value);          /**< completion callback */
+} mcp9808_async_op_t;
+
+/**
+ * @brief mcp9808 async handle structure definition
+ */
+struct mcp9808_async_handle_s
+{
+    mcp9808_handle_t *handle;                                                           /**< point to an inited mcp9808 handle */
+    uint8_t (*iic_read_start)(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);   /**< point to an iic_read_start function address */
+    uint8_t (*iic_write_start)(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);  /**< point to an iic_write_start function address */
+    uint8_t (*iic_status)(void);                                                        /**< point to an iic_status function address */
+    uint32_t (*get_time_us)(void);                                                      /**< point to a get_time_us function address */
+    mcp9808_async_op_t queue[MCP9808_ASYNC_QUEUE_DEPTH];                                /**< operation queue */
+    uint8_t head;                                                                       /**< queue head */
+    uint8_t count;                                                                      /**< queued operation number */
+    uint8_t state;                                                                      /**< state machine state */
+    uint8_t buf[2];                                                                     /**< transfer buffer */
+    uint32_t start_time;                                                                /**< delay start time */
+    uint8_t inited;                                                                     /**< inited flag */
+};
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup mcp9808_async_link_driver mcp9808 async link driver function
+ * @brief    mcp9808 async link driver modules
+ * @ingroup  mcp9808_async_driver
+ * @{
+ */
+
+/**
+ * @brief     initialize mcp9808_async_handle_t structure
+ * @param[in] HANDLE pointer to a mcp9808 async handle structure
+ * @param[in] STRUCTURE mcp9808_async_handle_t
+ * @note      none
+ */
+#define DRIVER_MCP9808_ASYNC_LINK_INIT(HANDLE, STRUCTURE)             memset(HANDLE, 0, sizeof(STRUCTURE))
+
+/**
+ * @brief     link iic_read_start function
+ * @param[in] HANDLE pointer to a mcp9808 async handle structure
+ * @param[in] FUC pointer to an iic_read_start function address
+ * @note      the function starts a transfer and returns at once
+ */
+#define DRIVER_MCP9808_ASYNC_LINK_IIC_READ_START(HANDLE, FUC)        (HANDLE)->iic_read_start = FUC
+
+/**
+ * @brief     link iic_write_start function
+ * @param[in] HANDLE pointer to a mcp9808 async handle structure
+ * @param[in] FUC pointer to an iic_write_start function address
+ * @note      the function starts a transfer and returns at once
+ */
+#define DRIVER_MCP9808_ASYNC_LINK_IIC_WRITE_START(HANDLE, FUC)       (HANDLE)->iic_write_start = FUC
+
+/**
+ * @brief     link iic_status function
+ * @param[in] HANDLE pointer to a mcp9808 async handle structure
+ * @param[in] FUC pointer to an iic_status function address
+ * @note      the function returns a mcp9808_async_bus_status_t value
+ */
+#define DRIVER_MCP9808_ASYNC_LINK_IIC_STATUS(HANDLE, FUC)            (HANDLE)->iic_status = FUC
+
+/**
+ * @brief     link get_time_us function
+ * @param[in] HANDLE pointer to a mcp9808 async handle structure
+ * @param[in] FUC pointer to a get_time_us function address
+ * @note      none
+ */
+#define DRIVER_MCP9808_ASYNC_LINK_GET_TIME_US(HANDLE, FUC)           (HANDLE)->get_time_us = FUC
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup mcp9808_async_base_driver mcp9808 async base driver function
+ * @brief    mcp9808 async base driver modules
+ * @ingroup  mcp9808_async_driver
+ * @{
+ */
+
+/**
+ * @brief     initialize the async handle
+ * @param[in] *async pointer to a mcp9808 async handle structure
+ * @param[in] *handle pointer to an inited mcp9808 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized or linked functions are NULL
+ * @note      the base handle keeps the address, the debug print and the register cache
+ */
+uint8_t mcp9808_async_init(mcp9808_async_handle_t *async, mcp9808_handle_t *handle);
+
+/**
+ * @brief     close the async handle
+ * @param[in] *async pointer to a mcp9808 async handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 operations are pending
+ * @note      none
+ */
+uint8_t mcp9808_async_deinit(mcp9808_async_handle_t *async);
+
+/**
+ * @brief     drive the async state machine
+ * @param[in] *async pointer to a mcp9808 async handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      call it from the main loop, it never waits on the bus
+ */
+uint8_t mcp9808_async_poll(mcp9808_async_handle_t *async);
+
+/**
+ * @brief      get the pending operation number
+ * @param[in]  *async pointer to a mcp9808 async handle structure
+ * @param[out] *count pointer to a count buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t mcp9808_async_get_pending(mcp9808_async_handle_t *async, uint8_t *count);
+
+/**
+ * @brief     queue a register read
+ * @param[in] *async pointer to a mcp9808 async handle structure
+ * @param[in] reg register address
+ * @param[in] len register length, 1 or 2
+ * @param[in] *done pointer to a completion callback
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 queue is full
+ *            - 5 len is invalid
+ * @note      the read value is passed to the callback
+ */
+uint8_t mcp9808_async_read_reg(mcp9808_async_handle_t *async, uint8_t reg, uint8_t len,
+                               void (*done)(mcp9808_async_handle_t *async, uint8_t res, uint16_t value));
+
+/**
+ * @brief     queue a register write
+ * @param[in] *async pointer to a mcp9808 async handle structure
+ * @param[in] reg register address
+ * @param[in] value written value
+ * @param[in] len register length, 1 or 2
+ * @param[in] *done pointer to a completion callback
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 queue is full
+ *            - 5 len is invalid
+ * @note      done can be NULL
+ */
+uint8_t mcp9808_async_write_reg(mcp9808_async_handle_t *async, uint8_t reg, uint16_t value, uint8_t len,
+                                void (*done)(mcp9808_async_handle_t *async, uint8_t res, uint16_t value));
+
+/**
+ * @brief     queue a register read-modify-write
+ * @param[in] *async pointer to a mcp9808 async handle structure
+ * @param[in] reg register address
+ * @param[in] mask modified bits
+ * @param[in] value new value of the modified bits
+ * @param[in] *done pointer to a completion callback
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 queue is full
+ * @note      the config register read is skipped when the config cache is valid
+ */
+uint8_t mcp9808_async_modify_reg(mcp9808_async_handle_t *async, uint8_t reg, uint16_t mask, uint16_t value,
+                                 void (*done)(mcp9808_async_handle_t *async, uint8_t res, uint16_t value));
+
+/**
+ * @brief     queue a non-blocking delay
+ * @param[in] *async pointer to a mcp9808 async handle structure
+ * @param[in] ms delay time
+ * @param[in] *done pointer to a completion callback
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 queue is full
+ * @note      the following operations wait until the delay has passed
+ */
+uint8_t mcp9808_async_delay(mcp9808_async_handle_t *async, uint32_t ms,
+                            void (*done)(mcp9808_async_handle_t *async, uint8_t res, uint16_t value));
+
+/**
+ * @brief     queue a temperature read
+ * @param[in] *async pointer to a mcp9808 async handle structure
+ * @param[in] *done pointer to a completion callback
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 queue is full
+ * @note      the callback value is the signed raw temperature, 0.0625C per lsb
+ */
+uint8_t mcp9808_async_read_temperature(mcp9808_async_handle_t *async,
+                                       void (*done)(mcp9808_async_handle_t *async, uint8_t res, uint16_t value));
+
+/**
+ * @brief     queue a shutdown change
+ * @param[in] *async pointer to a mcp9808 async handle structure
+ * @param[in] enable bool value
+ * @param[in] *done pointer to a completion callback
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 queue is full
+ * @note      the 10ms settling time is queued as a delay, done runs after it,
+ *            a failed config write skips the delay and done gets res 1
+ */
+uint8_t mcp9808_async_set_shutdown(mcp9808_async_handle_t *async, mcp9808_bool_t enable,
+                                   void (*done)(mcp9808_async_handle_t *async, uint8_t res, uint16_t value));
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
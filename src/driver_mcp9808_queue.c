@@ -0,0 +1,235 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mcp9808_queue.c
+ * @brief     driver mcp9808 queue source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-01-25
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/01/25  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_mcp9808_queue.h"
+
+/**
+ * @brief     check the queue
+ * @param[in] *queue pointer to a mcp9808 queue structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+static uint8_t a_mcp9808_queue_check(mcp9808_queue_t *queue)
+{
+    if (queue == NULL)                 /* check handle */
+    {
+        return 2;                      /* return error */
+    }
+    if (queue->inited != 1)            /* check handle initialization */
+    {
+        return 3;                      /* return error */
+    }
+    
+    return 0;                          /* success return 0 */
+}
+
+/**
+ * @brief     initialize the queue
+ * @param[in] *queue pointer to a mcp9808 queue structure
+ * @param[in] *buf pointer to an event buffer
+ * @param[in] size buffer size, a power of two
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 size is invalid
+ * @note      one producer and one consumer can use the queue without a lock
+ */
+uint8_t mcp9808_queue_init(mcp9808_queue_t *queue, mcp9808_event_t *buf, uint32_t size)
+{
+    if ((queue == NULL) || (buf == NULL))                    /* check handle */
+    {
+        return 2;                                            /* return error */
+    }
+    if ((size < 2) || ((size & (size - 1)) != 0))            /* check size */
+    {
+        return 4;                                            /* return error */
+    }
+    
+    queue->buf = buf;                                        /* set buffer */
+    queue->mask = size - 1;                                  /* set mask */
+    queue->head = 0;                                         /* reset head */
+    queue->tail = 0;                                         /* reset tail */
+    queue->dropped = 0;                                      /* reset dropped number */
+    queue->inited = 1;                                       /* flag finish initialization */
+    
+    return 0;                                                /* success return 0 */
+}
+
+/**
+ * @brief     push an event to the queue
+ * @param[in] *queue pointer to a mcp9808 queue structure
+ * @param[in] *event pointer to an event structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 queue is full
+ * @note      producer side only, it never blocks and it is safe in the interrupt context
+ */
+uint8_t mcp9808_queue_push(mcp9808_queue_t *queue, const mcp9808_event_t *event)
+{
+    uint8_t res;
+    uint32_t head;
+    uint32_t tail;
+    volatile mcp9808_event_t *slot;
+    
+    res = a_mcp9808_queue_check(queue);                      /* check handle */
+    if (res != 0)                                            /* check result */
+    {
+        return res;                                          /* return error */
+    }
+    
+    head = queue->head;                                      /* own index */
+    tail = queue->tail;                                      /* consumer index */
+    MCP9808_QUEUE_BARRIER();                                 /* read tail before reusing the slot */
+    if ((head - tail) > queue->mask)                         /* check full */
+    {
+        queue->dropped++;                                    /* count the dropped event */
+        
+        return 4;                                            /* return error */
+    }
+    slot = &queue->buf[head & queue->mask];                  /* get the slot */
+    slot->time_us = event->time_us;                          /* copy time */
+    slot->raw = event->raw;                                  /* copy raw */
+    slot->flags = event->flags;                              /* copy flags */
+    slot->addr = event->addr;                                /* copy addr */
+    MCP9808_QUEUE_BARRIER();                                 /* publish the slot before the index */
+    queue->head = head + 1;                                  /* publish */
+    
+    return 0;                                                /* success return 0 */
+}
+
+/**
+ * @brief         pop events from the queue
+ * @param[in]     *queue pointer to a mcp9808 queue structure
+ * @param[out]    *event pointer to an event buffer
+ * @param[in,out] *len pointer to a length buffer
+ * @return        status code
+ *                - 0 success
+ *                - 2 handle is NULL
+ *                - 3 handle is not initialized
+ * @note          consumer side only, len is the buffer length on input and the popped number on output
+ */
+uint8_t mcp9808_queue_pop(mcp9808_queue_t *queue, mcp9808_event_t *event, uint32_t *len)
+{
+    uint8_t res;
+    uint32_t i;
+    uint32_t n;
+    uint32_t head;
+    uint32_t tail;
+    volatile mcp9808_event_t *slot;
+    
+    res = a_mcp9808_queue_check(queue);                      /* check handle */
+    if (res != 0)                                            /* check result */
+    {
+        return res;                                          /* return error */
+    }
+    
+    tail = queue->tail;                                      /* own index */
+    head = queue->head;                                      /* producer index */
+    MCP9808_QUEUE_BARRIER();                                 /* read head before the slots */
+    n = head - tail;                                         /* queued number */
+    if (n > *len)                                            /* check the buffer */
+    {
+        n = *len;                                            /* limit to the buffer */
+    }
+    for (i = 0; i < n; i++)                                  /* copy the batch */
+    {
+        slot = &queue->buf[(tail + i) & queue->mask];        /* get the slot */
+        event[i].time_us = slot->time_us;                    /* copy time */
+        event[i].raw = slot->raw;                            /* copy raw */
+        event[i].flags = slot->flags;                        /* copy flags */
+        event[i].addr = slot->addr;                          /* copy addr */
+    }
+    MCP9808_QUEUE_BARRIER();                                 /* finish reading before freeing the slots */
+    queue->tail = tail + n;                                  /* free the slots */
+    *len = n;                                                /* set the popped number */
+    
+    return 0;                                                /* success return 0 */
+}
+
+/**
+ * @brief      get the queued event number
+ * @param[in]  *queue pointer to a mcp9808 queue structure
+ * @param[out] *count pointer to a count buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t mcp9808_queue_get_count(mcp9808_queue_t *queue, uint32_t *count)
+{
+    uint8_t res;
+    
+    res = a_mcp9808_queue_check(queue);                      /* check handle */
+    if (res != 0)                                            /* check result */
+    {
+        return res;                                          /* return error */
+    }
+    
+    *count = queue->head - queue->tail;                      /* get the count */
+    
+    return 0;                                                /* success return 0 */
+}
+
+/**
+ * @brief      get the dropped event number
+ * @param[in]  *queue pointer to a mcp9808 queue structure
+ * @param[out] *dropped pointer to a dropped number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the number only grows, compare two reads to find new drops
+ */
+uint8_t mcp9808_queue_get_dropped(mcp9808_queue_t *queue, uint32_t *dropped)
+{
+    uint8_t res;
+    
+    res = a_mcp9808_queue_check(queue);                      /* check handle */
+    if (res != 0)                                            /* check result */
+    {
+        return res;                                          /* return error */
+    }
+    
+    *dropped = queue->dropped;                               /* get the dropped number */
+    
+    return 0;                                                /* success return 0 */
+}
@@ -0,0 +1,171 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mcp9808_queue.h
+ * @brief     driver mcp9808 queue header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-01-25
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/01/25  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_MCP9808_QUEUE_H
+#define DRIVER_MCP9808_QUEUE_H
+
+#include "driver_mcp9808.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup mcp9808_queue_driver mcp9808 queue driver function
+ * @brief    mcp9808 queue driver modules
+ * @ingroup  mcp9808_driver
+ * @{
+ */
+
+/**
+ * @brief queue memory barrier definition
+ * @note  define it before including this file to use a platform barrier
+ */
+#ifndef MCP9808_QUEUE_BARRIER
+    #if defined(__GNUC__) || defined(__clang__)
+        #define MCP9808_QUEUE_BARRIER() __sync_synchronize()        /**< full memory barrier */
+    #else
+        #define MCP9808_QUEUE_BARRIER()                             /**< single core, volatile ordering is enough */
+    #endif
+#endif
+
+/**
+ * @brief mcp9808 event structure definition
+ */
+typedef struct mcp9808_event_s
+{
+    uint32_t time_us;        /**< event time in microseconds */
+    int16_t raw;             /**< signed raw temperature */
+    uint8_t flags;           /**< mcp9808_status_flag_t bits, 0 for a plain sample */
+    uint8_t addr;            /**< iic device address */
+} mcp9808_event_t;
+
+/**
+ * @brief mcp9808 queue structure definition
+ */
+typedef struct mcp9808_queue_s
+{
+    volatile mcp9808_event_t *buf;        /**< event buffer */
+    uint32_t mask;                        /**< buffer size - 1 */
+    volatile uint32_t head;               /**< write index, only changed by the producer */
+    volatile uint32_t tail;               /**< read index, only changed by the consumer */
+    volatile uint32_t dropped;            /**< dropped event number, only changed by the producer */
+    uint8_t inited;                       /**< inited flag */
+} mcp9808_queue_t;
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup mcp9808_queue_base_driver mcp9808 queue base driver function
+ * @brief    mcp9808 queue base driver modules
+ * @ingroup  mcp9808_queue_driver
+ * @{
+ */
+
+/**
+ * @brief     initialize the queue
+ * @param[in] *queue pointer to a mcp9808 queue structure
+ * @param[in] *buf pointer to an event buffer
+ * @param[in] size buffer size, a power of two
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 4 size is invalid
+ * @note      one producer and one consumer can use the queue without a lock
+ */
+uint8_t mcp9808_queue_init(mcp9808_queue_t *queue, mcp9808_event_t *buf, uint32_t size);
+
+/**
+ * @brief     push an event to the queue
+ * @param[in] *queue pointer to a mcp9808 queue structure
+ * @param[in] *event pointer to an event structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 queue is full
+ * @note      producer side only, it never blocks and it is safe in the interrupt context
+ */
+uint8_t mcp9808_queue_push(mcp9808_queue_t *queue, const mcp9808_event_t *event);
+
+/**
+ * @brief         pop events from the queue
+ * @param[in]     *queue pointer to a mcp9808 queue structure
+ * @param[out]    *event pointer to an event buffer
+ * @param[in,out] *len pointer to a length buffer
+ * @return        status code
+ *                - 0 success
+ *                - 2 handle is NULL
+ *                - 3 handle is not initialized
+ * @note          consumer side only, len is the buffer length on input and the popped number on output
+ */
+uint8_t mcp9808_queue_pop(mcp9808_queue_t *queue, mcp9808_event_t *event, uint32_t *len);
+
+/**
+ * @brief      get the queued event number
+ * @param[in]  *queue pointer to a mcp9808 queue structure
+ * @param[out] *count pointer to a count buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t mcp9808_queue_get_count(mcp9808_queue_t *queue, uint32_t *count);
+
+/**
+ * @brief      get the dropped event number
+ * @param[in]  *queue pointer to a mcp9808 queue structure
+ * @param[out] *dropped pointer to a dropped number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the number only grows, compare two reads to find new drops
+ */
+uint8_t mcp9808_queue_get_dropped(mcp9808_queue_t *queue, uint32_t *dropped);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,73 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mcp9808_reg.h
+ * @brief     driver mcp9808 register header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-01-25
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/01/25  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_MCP9808_REG_H
+#define DRIVER_MCP9808_REG_H
+
+#include <stdint.h>
+
+/**
+ * @brief chip reg definition
+ * @note  private to the driver sources, not part of the public interface
+ */
+#define MCP9808_REG_CONFIG                 0x01        /**< config register */
+#define MCP9808_REG_ALERT_UPPER            0x02        /**< alert temperature upper boundary trip register */
+#define MCP9808_REG_ALERT_LOWER            0x03        /**< alert temperature lower boundary trip register */
+#define MCP9808_REG_CRIT                   0x04        /**< critical temperature trip register */
+#define MCP9808_REG_TEMPERATURE            0x05        /**< temperature register */
+#define MCP9808_REG_MANUFACTURER_ID        0x06        /**< manufacturer id register */
+#define MCP9808_REG_DEVICE_ID              0x07        /**< device id register */
+#define MCP9808_REG_RESOLUTION             0x08        /**< resolution register */
+
+/**
+ * @brief chip config mask definition
+ */
+#define MCP9808_CONFIG_LOCK_MASK           0x00C0U     /**< critical and window lock bits */
+#define MCP9808_CONFIG_LOCKED_MASK         0x060BU     /**< hysteresis and alert bits frozen by either lock bit */
+#define MCP9808_CONFIG_WINDOW_LOCKED_MASK  0x0004U     /**< alert select bit frozen by the window lock bit */
+#define MCP9808_CONFIG_CACHE_MASK          0x07CFU     /**< bits kept in the config cache */
+
+/**
+ * @brief     model the config register lock rules
+ * @param[in] prev current config
+ * @param[in] config config to be written
+ * @return    config value held by the chip after the write
+ * @note      the status and interrupt clear bits are not kept,
+ *            shared by the blocking and async drivers to keep the config cache in step
+ */
+uint16_t mcp9808_config_filter(uint16_t prev, uint16_t config);
+
+#endif
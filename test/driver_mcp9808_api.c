@@ -0,0 +1,709 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mcp9808_api.c
+ * @brief     driver mcp9808 api source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-01-25
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/01/25  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_mcp9808_api.h"
+#include <string.h>
+
+static mcp9808_handle_t *gs_api_handle;              /**< two mcp9808 handles on one bus */
+static const mcp9808_config_t *gs_api_config;        /**< config applied by mcp9808_apply_config */
+static mcp9808_bool_t gs_api_cache;                  /**< cache mode set by mcp9808_set_cache */
+
+/**
+ * @brief  api get the chip information
+ * @return status code of mcp9808_info
+ * @note   none
+ */
+static uint8_t a_api_info(void)
+{
+    mcp9808_info_t info;
+    
+    return mcp9808_info(&info);
+}
+
+/**
+ * @brief  api set the address of the first device
+ * @return status code of mcp9808_set_addr
+ * @note   none
+ */
+static uint8_t a_api_set_addr(void)
+{
+    return mcp9808_set_addr(gs_api_handle, MCP9808_ADDRESS_A2A1A0_000);
+}
+
+/**
+ * @brief  api get the address of the first device
+ * @return status code of mcp9808_get_addr
+ * @note   none
+ */
+static uint8_t a_api_get_addr(void)
+{
+    mcp9808_address_t addr;
+    
+    return mcp9808_get_addr(gs_api_handle, &addr);
+}
+
+/**
+ * @brief  api init the first device
+ * @return status code of mcp9808_init
+ * @note   none
+ */
+static uint8_t a_api_init(void)
+{
+    return mcp9808_init(gs_api_handle);
+}
+
+/**
+ * @brief  api deinit the first device
+ * @return status code of mcp9808_deinit
+ * @note   none
+ */
+static uint8_t a_api_deinit(void)
+{
+    return mcp9808_deinit(gs_api_handle);
+}
+
+/**
+ * @brief  api run the irq handler of the first device
+ * @return status code of mcp9808_irq_handler
+ * @note   none
+ */
+static uint8_t a_api_irq_handler(void)
+{
+    return mcp9808_irq_handler(gs_api_handle);
+}
+
+#if (MCP9808_USE_FLOAT == 1)
+/**
+ * @brief  api read the temperature
+ * @return status code of mcp9808_read
+ * @note   none
+ */
+static uint8_t a_api_read(void)
+{
+    int16_t raw;
+    float temperature_deg;
+    
+    return mcp9808_read(gs_api_handle, &raw, &temperature_deg);
+}
+#endif
+
+/**
+ * @brief  api read the temperature in milli celsius
+ * @return status code of mcp9808_read_milli_c
+ * @note   none
+ */
+static uint8_t a_api_read_milli_c(void)
+{
+    int16_t raw;
+    int32_t temperature_mc;
+    
+    return mcp9808_read_milli_c(gs_api_handle, &raw, &temperature_mc);
+}
+
+/**
+ * @brief  api read the scheduled temperature
+ * @return status code of mcp9808_read_scheduled
+ * @note   none
+ */
+static uint8_t a_api_read_scheduled(void)
+{
+    int16_t raw;
+    mcp9808_bool_t fresh;
+    uint32_t next_us;
+    
+    return mcp9808_read_scheduled(gs_api_handle, &raw, &fresh, &next_us);
+}
+
+/**
+ * @brief  api read the temperature of both devices
+ * @return status code of mcp9808_read_batch
+ * @note   none
+ */
+static uint8_t a_api_read_batch(void)
+{
+    int16_t raw[2];
+    mcp9808_handle_t *batch[2];
+    
+    batch[0] = &gs_api_handle[0];
+    batch[1] = &gs_api_handle[1];
+    
+    return mcp9808_read_batch(batch, 2, raw);
+}
+
+/**
+ * @brief  api set the hysteresis to 1.5C
+ * @return status code of mcp9808_set_temperature_threshold_hysteresis
+ * @note   none
+ */
+static uint8_t a_api_set_hysteresis(void)
+{
+    return mcp9808_set_temperature_threshold_hysteresis(gs_api_handle, MCP9808_HYSTERESIS_1P5);
+}
+
+/**
+ * @brief  api get the hysteresis
+ * @return status code of mcp9808_get_temperature_threshold_hysteresis
+ * @note   none
+ */
+static uint8_t a_api_get_hysteresis(void)
+{
+    mcp9808_hysteresis_t hysteresis;
+    
+    return mcp9808_get_temperature_threshold_hysteresis(gs_api_handle, &hysteresis);
+}
+
+/**
+ * @brief  api disable the shutdown
+ * @return status code of mcp9808_set_shutdown
+ * @note   none
+ */
+static uint8_t a_api_set_shutdown(void)
+{
+    return mcp9808_set_shutdown(gs_api_handle, MCP9808_BOOL_FALSE);
+}
+
+/**
+ * @brief  api get the shutdown status
+ * @return status code of mcp9808_get_shutdown
+ * @note   none
+ */
+static uint8_t a_api_get_shutdown(void)
+{
+    mcp9808_bool_t enable;
+    
+    return mcp9808_get_shutdown(gs_api_handle, &enable);
+}
+
+/**
+ * @brief  api lock the critical temperature
+ * @return status code of mcp9808_set_critical_temperature_lock
+ * @note   none
+ */
+static uint8_t a_api_set_critical_lock(void)
+{
+    return mcp9808_set_critical_temperature_lock(gs_api_handle, MCP9808_BOOL_TRUE);
+}
+
+/**
+ * @brief  api get the critical temperature lock status
+ * @return status code of mcp9808_get_critical_temperature_lock
+ * @note   none
+ */
+static uint8_t a_api_get_critical_lock(void)
+{
+    mcp9808_bool_t enable;
+    
+    return mcp9808_get_critical_temperature_lock(gs_api_handle, &enable);
+}
+
+/**
+ * @brief  api lock the temperature thresholds
+ * @return status code of mcp9808_set_temperature_threshold_lock
+ * @note   none
+ */
+static uint8_t a_api_set_threshold_lock(void)
+{
+    return mcp9808_set_temperature_threshold_lock(gs_api_handle, MCP9808_BOOL_TRUE);
+}
+
+/**
+ * @brief  api get the temperature threshold lock status
+ * @return status code of mcp9808_get_temperature_threshold_lock
+ * @note   none
+ */
+static uint8_t a_api_get_threshold_lock(void)
+{
+    mcp9808_bool_t enable;
+    
+    return mcp9808_get_temperature_threshold_lock(gs_api_handle, &enable);
+}
+
+/**
+ * @brief  api clear the interrupt
+ * @return status code of mcp9808_clear_interrupt
+ * @note   none
+ */
+static uint8_t a_api_clear_interrupt(void)
+{
+    return mcp9808_clear_interrupt(gs_api_handle);
+}
+
+/**
+ * @brief  api get the alert output asserted status
+ * @return status code of mcp9808_get_alert_output_asserted
+ * @note   none
+ */
+static uint8_t a_api_get_alert_output_asserted(void)
+{
+    mcp9808_bool_t enable;
+    
+    return mcp9808_get_alert_output_asserted(gs_api_handle, &enable);
+}
+
+/**
+ * @brief  api enable the alert output
+ * @return status code of mcp9808_set_alert_output
+ * @note   none
+ */
+static uint8_t a_api_set_alert_output(void)
+{
+    return mcp9808_set_alert_output(gs_api_handle, MCP9808_BOOL_TRUE);
+}
+
+/**
+ * @brief  api get the alert output status
+ * @return status code of mcp9808_get_alert_output
+ * @note   none
+ */
+static uint8_t a_api_get_alert_output(void)
+{
+    mcp9808_bool_t enable;
+    
+    return mcp9808_get_alert_output(gs_api_handle, &enable);
+}
+
+/**
+ * @brief  api select all alerts for the alert output
+ * @return status code of mcp9808_set_alert_output_select
+ * @note   none
+ */
+static uint8_t a_api_set_alert_output_select(void)
+{
+    return mcp9808_set_alert_output_select(gs_api_handle, MCP9808_ALERT_OUTPUT_SELECT_ALL);
+}
+
+/**
+ * @brief  api get the alert output select
+ * @return status code of mcp9808_get_alert_output_select
+ * @note   none
+ */
+static uint8_t a_api_get_alert_output_select(void)
+{
+    mcp9808_alert_output_select_t select_output;
+    
+    return mcp9808_get_alert_output_select(gs_api_handle, &select_output);
+}
+
+/**
+ * @brief  api set the alert output polarity to low
+ * @return status code of mcp9808_set_alert_output_polarity
+ * @note   none
+ */
+static uint8_t a_api_set_alert_output_polarity(void)
+{
+    return mcp9808_set_alert_output_polarity(gs_api_handle, MCP9808_ALERT_OUTPUT_POLARITY_LOW);
+}
+
+/**
+ * @brief  api get the alert output polarity
+ * @return status code of mcp9808_get_alert_output_polarity
+ * @note   none
+ */
+static uint8_t a_api_get_alert_output_polarity(void)
+{
+    mcp9808_alert_output_polarity_t polarity;
+    
+    return mcp9808_get_alert_output_polarity(gs_api_handle, &polarity);
+}
+
+/**
+ * @brief  api set the alert output to the interrupt mode
+ * @return status code of mcp9808_set_alert_output_mode
+ * @note   none
+ */
+static uint8_t a_api_set_alert_output_mode(void)
+{
+    return mcp9808_set_alert_output_mode(gs_api_handle, MCP9808_ALERT_OUTPUT_MODE_INTERRUPT);
+}
+
+/**
+ * @brief  api get the alert output mode
+ * @return status code of mcp9808_get_alert_output_mode
+ * @note   none
+ */
+static uint8_t a_api_get_alert_output_mode(void)
+{
+    mcp9808_alert_output_mode_t mode;
+    
+    return mcp9808_get_alert_output_mode(gs_api_handle, &mode);
+}
+
+/**
+ * @brief  api set the bound cache mode
+ * @return status code of mcp9808_set_cache
+ * @note   none
+ */
+static uint8_t a_api_set_cache(void)
+{
+    return mcp9808_set_cache(gs_api_handle, gs_api_cache);
+}
+
+/**
+ * @brief  api get the cache status
+ * @return status code of mcp9808_get_cache
+ * @note   none
+ */
+static uint8_t a_api_get_cache(void)
+{
+    mcp9808_bool_t enable;
+    
+    return mcp9808_get_cache(gs_api_handle, &enable);
+}
+
+/**
+ * @brief  api invalidate the cache
+ * @return status code of mcp9808_invalidate_cache
+ * @note   none
+ */
+static uint8_t a_api_invalidate_cache(void)
+{
+    return mcp9808_invalidate_cache(gs_api_handle);
+}
+
+/**
+ * @brief  api resync the cache
+ * @return status code of mcp9808_resync_cache
+ * @note   none
+ */
+static uint8_t a_api_resync_cache(void)
+{
+    return mcp9808_resync_cache(gs_api_handle);
+}
+
+/**
+ * @brief  api apply the bound config
+ * @return status code of mcp9808_apply_config
+ * @note   none
+ */
+static uint8_t a_api_apply_config(void)
+{
+    return mcp9808_apply_config(gs_api_handle, gs_api_config);
+}
+
+/**
+ * @brief  api get the config
+ * @return status code of mcp9808_get_config
+ * @note   none
+ */
+static uint8_t a_api_get_config(void)
+{
+    mcp9808_config_t config;
+    
+    return mcp9808_get_config(gs_api_handle, &config);
+}
+
+/**
+ * @brief  api set the high threshold to 30.0C
+ * @return status code of mcp9808_set_temperature_high_threshold
+ * @note   none
+ */
+static uint8_t a_api_set_high_threshold(void)
+{
+    return mcp9808_set_temperature_high_threshold(gs_api_handle, 0x01E0);
+}
+
+/**
+ * @brief  api get the high threshold
+ * @return status code of mcp9808_get_temperature_high_threshold
+ * @note   none
+ */
+static uint8_t a_api_get_high_threshold(void)
+{
+    uint16_t raw;
+    
+    return mcp9808_get_temperature_high_threshold(gs_api_handle, &raw);
+}
+
+/**
+ * @brief  api set the low threshold to 25.0C
+ * @return status code of mcp9808_set_temperature_low_threshold
+ * @note   none
+ */
+static uint8_t a_api_set_low_threshold(void)
+{
+    return mcp9808_set_temperature_low_threshold(gs_api_handle, 0x0190);
+}
+
+/**
+ * @brief  api get the low threshold
+ * @return status code of mcp9808_get_temperature_low_threshold
+ * @note   none
+ */
+static uint8_t a_api_get_low_threshold(void)
+{
+    uint16_t raw;
+    
+    return mcp9808_get_temperature_low_threshold(gs_api_handle, &raw);
+}
+
+/**
+ * @brief  api set the critical temperature to 35.0C
+ * @return status code of mcp9808_set_critical_temperature
+ * @note   none
+ */
+static uint8_t a_api_set_critical_temperature(void)
+{
+    return mcp9808_set_critical_temperature(gs_api_handle, 0x0230);
+}
+
+/**
+ * @brief  api get the critical temperature
+ * @return status code of mcp9808_get_critical_temperature
+ * @note   none
+ */
+static uint8_t a_api_get_critical_temperature(void)
+{
+    uint16_t raw;
+    
+    return mcp9808_get_critical_temperature(gs_api_handle, &raw);
+}
+
+/**
+ * @brief  api get the device revision
+ * @return status code of mcp9808_get_device_revision
+ * @note   none
+ */
+static uint8_t a_api_get_device_revision(void)
+{
+    uint8_t revision;
+    
+    return mcp9808_get_device_revision(gs_api_handle, &revision);
+}
+
+/**
+ * @brief  api set the resolution to 0.0625C
+ * @return status code of mcp9808_set_resolution
+ * @note   none
+ */
+static uint8_t a_api_set_resolution(void)
+{
+    return mcp9808_set_resolution(gs_api_handle, MCP9808_RESOLUTION_0P0625);
+}
+
+/**
+ * @brief  api get the resolution
+ * @return status code of mcp9808_get_resolution
+ * @note   none
+ */
+static uint8_t a_api_get_resolution(void)
+{
+    mcp9808_resolution_t resolution;
+    
+    return mcp9808_get_resolution(gs_api_handle, &resolution);
+}
+
+#if (MCP9808_USE_FLOAT == 1)
+/**
+ * @brief  api convert 30.25C to a register value
+ * @return status code of mcp9808_temperature_convert_to_register
+ * @note   none
+ */
+static uint8_t a_api_convert_to_register(void)
+{
+    uint16_t reg;
+    
+    return mcp9808_temperature_convert_to_register(gs_api_handle, 30.25f, &reg);
+}
+
+/**
+ * @brief  api convert a register value to celsius
+ * @return status code of mcp9808_temperature_convert_to_data
+ * @note   none
+ */
+static uint8_t a_api_convert_to_data(void)
+{
+    float temperature_deg;
+    
+    return mcp9808_temperature_convert_to_data(gs_api_handle, 0x01E4, &temperature_deg);
+}
+#endif
+
+/**
+ * @brief  api convert 30250 milli celsius to a register value
+ * @return status code of mcp9808_temperature_convert_to_register_milli_c
+ * @note   none
+ */
+static uint8_t a_api_convert_to_register_milli_c(void)
+{
+    uint16_t reg;
+    
+    return mcp9808_temperature_convert_to_register_milli_c(gs_api_handle, 30250, &reg);
+}
+
+/**
+ * @brief  api convert a register value to milli celsius
+ * @return status code of mcp9808_temperature_convert_to_data_milli_c
+ * @note   none
+ */
+static uint8_t a_api_convert_to_data_milli_c(void)
+{
+    int32_t temperature_mc;
+    
+    return mcp9808_temperature_convert_to_data_milli_c(gs_api_handle, 0x01E4, &temperature_mc);
+}
+
+/**
+ * @brief  api write 0x0000 to the config register
+ * @return status code of mcp9808_set_reg
+ * @note   none
+ */
+static uint8_t a_api_set_reg(void)
+{
+    uint8_t buf[2] = {0x00, 0x00};
+    
+    return mcp9808_set_reg(gs_api_handle, 0x01, buf, 2);
+}
+
+/**
+ * @brief  api read the temperature register
+ * @return status code of mcp9808_get_reg
+ * @note   none
+ */
+static uint8_t a_api_get_reg(void)
+{
+    uint8_t buf[2];
+    
+    return mcp9808_get_reg(gs_api_handle, 0x05, buf, 2);
+}
+
+/**
+ * @brief api call table definition
+ * @note  deinit is prepared by an init so every call starts from an inited device
+ */
+static const mcp9808_api_call_t gs_api_call[] =
+{
+    {"mcp9808_info", NULL, a_api_info},
+    {"mcp9808_set_addr", NULL, a_api_set_addr},
+    {"mcp9808_get_addr", NULL, a_api_get_addr},
+    {"mcp9808_init", NULL, a_api_init},
+    {"mcp9808_deinit", a_api_init, a_api_deinit},
+    {"mcp9808_irq_handler", NULL, a_api_irq_handler},
+#if (MCP9808_USE_FLOAT == 1)
+    {"mcp9808_read", NULL, a_api_read},
+#endif
+    {"mcp9808_read_milli_c", NULL, a_api_read_milli_c},
+    {"mcp9808_read_scheduled", NULL, a_api_read_scheduled},
+    {"mcp9808_read_batch", NULL, a_api_read_batch},
+    {"mcp9808_set_temperature_threshold_hysteresis", NULL, a_api_set_hysteresis},
+    {"mcp9808_get_temperature_threshold_hysteresis", NULL, a_api_get_hysteresis},
+    {"mcp9808_set_shutdown", NULL, a_api_set_shutdown},
+    {"mcp9808_get_shutdown", NULL, a_api_get_shutdown},
+    {"mcp9808_set_critical_temperature_lock", NULL, a_api_set_critical_lock},
+    {"mcp9808_get_critical_temperature_lock", NULL, a_api_get_critical_lock},
+    {"mcp9808_set_temperature_threshold_lock", NULL, a_api_set_threshold_lock},
+    {"mcp9808_get_temperature_threshold_lock", NULL, a_api_get_threshold_lock},
+    {"mcp9808_clear_interrupt", NULL, a_api_clear_interrupt},
+    {"mcp9808_get_alert_output_asserted", NULL, a_api_get_alert_output_asserted},
+    {"mcp9808_set_alert_output", NULL, a_api_set_alert_output},
+    {"mcp9808_get_alert_output", NULL, a_api_get_alert_output},
+    {"mcp9808_set_alert_output_select", NULL, a_api_set_alert_output_select},
+    {"mcp9808_get_alert_output_select", NULL, a_api_get_alert_output_select},
+    {"mcp9808_set_alert_output_polarity", NULL, a_api_set_alert_output_polarity},
+    {"mcp9808_get_alert_output_polarity", NULL, a_api_get_alert_output_polarity},
+    {"mcp9808_set_alert_output_mode", NULL, a_api_set_alert_output_mode},
+    {"mcp9808_get_alert_output_mode", NULL, a_api_get_alert_output_mode},
+    {"mcp9808_set_cache", NULL, a_api_set_cache},
+    {"mcp9808_get_cache", NULL, a_api_get_cache},
+    {"mcp9808_invalidate_cache", NULL, a_api_invalidate_cache},
+    {"mcp9808_resync_cache", NULL, a_api_resync_cache},
+    {"mcp9808_apply_config", NULL, a_api_apply_config},
+    {"mcp9808_get_config", NULL, a_api_get_config},
+    {"mcp9808_set_temperature_high_threshold", NULL, a_api_set_high_threshold},
+    {"mcp9808_get_temperature_high_threshold", NULL, a_api_get_high_threshold},
+    {"mcp9808_set_temperature_low_threshold", NULL, a_api_set_low_threshold},
+    {"mcp9808_get_temperature_low_threshold", NULL, a_api_get_low_threshold},
+    {"mcp9808_set_critical_temperature", NULL, a_api_set_critical_temperature},
+    {"mcp9808_get_critical_temperature", NULL, a_api_get_critical_temperature},
+    {"mcp9808_get_device_revision", NULL, a_api_get_device_revision},
+    {"mcp9808_set_resolution", NULL, a_api_set_resolution},
+    {"mcp9808_get_resolution", NULL, a_api_get_resolution},
+#if (MCP9808_USE_FLOAT == 1)
+    {"mcp9808_temperature_convert_to_register", NULL, a_api_convert_to_register},
+    {"mcp9808_temperature_convert_to_data", NULL, a_api_convert_to_data},
+#endif
+    {"mcp9808_temperature_convert_to_register_milli_c", NULL, a_api_convert_to_register_milli_c},
+    {"mcp9808_temperature_convert_to_data_milli_c", NULL, a_api_convert_to_data_milli_c},
+    {"mcp9808_set_reg", NULL, a_api_set_reg},
+    {"mcp9808_get_reg", NULL, a_api_get_reg},
+};
+
+/**
+ * @brief     api bind the calls to the handles
+ * @param[in] *handle pointer to two mcp9808 handles on one bus
+ * @param[in] *config pointer to the config applied by mcp9808_apply_config
+ * @param[in] cache cache mode set by mcp9808_set_cache
+ * @note      every call runs on the first handle, mcp9808_read_batch reads both
+ */
+void mcp9808_api_bind(mcp9808_handle_t *handle, const mcp9808_config_t *config, mcp9808_bool_t cache)
+{
+    gs_api_handle = handle;
+    gs_api_config = config;
+    gs_api_cache = cache;
+}
+
+/**
+ * @brief      api get the call table
+ * @param[out] *num pointer to a call number buffer
+ * @return     pointer to the call table
+ * @note       none
+ */
+const mcp9808_api_call_t *mcp9808_api_get_table(uint32_t *num)
+{
+    *num = (uint32_t)(sizeof(gs_api_call) / sizeof(gs_api_call[0]));
+    
+    return gs_api_call;
+}
+
+/**
+ * @brief     api find one call
+ * @param[in] *name pointer to an api name
+ * @return    pointer to the call or NULL if the api is not in the table
+ * @note      none
+ */
+const mcp9808_api_call_t *mcp9808_api_find(const char *name)
+{
+    uint32_t i;
+    
+    for (i = 0; i < sizeof(gs_api_call) / sizeof(gs_api_call[0]); i++)
+    {
+        if (strcmp(gs_api_call[i].name, name) == 0)
+        {
+            return &gs_api_call[i];
+        }
+    }
+    
+    return NULL;
+}
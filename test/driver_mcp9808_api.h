@@ -0,0 +1,96 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mcp9808_api.h
+ * @brief     driver mcp9808 api header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-01-25
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/01/25  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_MCP9808_API_H
+#define DRIVER_MCP9808_API_H
+
+#include "driver_mcp9808_interface.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup mcp9808_api mcp9808 api function
+ * @brief    mcp9808 api call table modules
+ * @{
+ */
+
+/**
+ * @brief mcp9808 api call structure definition
+ */
+typedef struct mcp9808_api_call_s
+{
+    const char *name;              /**< api name */
+    uint8_t (*prepare)(void);      /**< setup run before every call, it can be NULL */
+    uint8_t (*run)(void);          /**< one api call with fixed arguments */
+} mcp9808_api_call_t;
+
+/**
+ * @brief     api bind the calls to the handles
+ * @param[in] *handle pointer to two mcp9808 handles on one bus
+ * @param[in] *config pointer to the config applied by mcp9808_apply_config
+ * @param[in] cache cache mode set by mcp9808_set_cache
+ * @note      every call runs on the first handle, mcp9808_read_batch reads both
+ */
+void mcp9808_api_bind(mcp9808_handle_t *handle, const mcp9808_config_t *config, mcp9808_bool_t cache);
+
+/**
+ * @brief      api get the call table
+ * @param[out] *num pointer to a call number buffer
+ * @return     pointer to the call table
+ * @note       every public api of the core driver has one call,
+ *             the float apis are only in the table when MCP9808_USE_FLOAT is enabled
+ */
+const mcp9808_api_call_t *mcp9808_api_get_table(uint32_t *num);
+
+/**
+ * @brief     api find one call
+ * @param[in] *name pointer to an api name
+ * @return    pointer to the call or NULL if the api is not in the table
+ * @note      none
+ */
+const mcp9808_api_call_t *mcp9808_api_find(const char *name);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
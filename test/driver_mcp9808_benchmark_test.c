@@ -0,0 +1,251 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mcp9808_benchmark_test.c
+ * @brief     driver mcp9808 benchmark test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-01-25
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/01/25  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_mcp9808_benchmark_test.h"
+#include "driver_mcp9808_api.h"
+#include "driver_mcp9808_simulator.h"
+#include <time.h>
+
+static mcp9808_handle_t gs_handle[2];        /**< mcp9808 handles on one simulated bus */
+static mcp9808_config_t gs_config;           /**< config applied by the apply_config call */
+
+/**
+ * @brief     benchmark silent print
+ * @param[in] fmt format data
+ * @note      driver messages would break the machine readable output
+ */
+static void a_benchmark_debug_print(const char *const fmt, ...)
+{
+    (void)fmt;
+}
+
+/**
+ * @brief     benchmark receive callback
+ * @param[in] type interrupt type
+ * @note      none
+ */
+static void a_benchmark_receive_callback(uint8_t type)
+{
+    (void)type;
+}
+
+/**
+ * @brief     benchmark set up two devices on a fresh simulator
+ * @param[in] cache cache mode
+ * @return    status code
+ *            - 0 success
+ *            - 1 set up failed
+ * @note      the first conversion is finished before the case runs
+ */
+static uint8_t a_benchmark_setup(mcp9808_bool_t cache)
+{
+    uint8_t i;
+    
+    mcp9808_simulator_reset();
+    for (i = 0; i < 2; i++)
+    {
+        (void)mcp9808_simulator_attach(0, (uint8_t)(MCP9808_ADDRESS_A2A1A0_000 + (i << 1)));
+        (void)mcp9808_simulator_set_temperature(0, (uint8_t)(MCP9808_ADDRESS_A2A1A0_000 + (i << 1)), 25500);
+        
+        /* link the simulator */
+        DRIVER_MCP9808_LINK_INIT(&gs_handle[i], mcp9808_handle_t);
+        DRIVER_MCP9808_LINK_IIC_INIT(&gs_handle[i], mcp9808_simulator_iic_init);
+        DRIVER_MCP9808_LINK_IIC_DEINIT(&gs_handle[i], mcp9808_simulator_iic_deinit);
+        DRIVER_MCP9808_LINK_IIC_READ(&gs_handle[i], mcp9808_simulator_iic_read);
+        DRIVER_MCP9808_LINK_IIC_READ_CMD(&gs_handle[i], mcp9808_simulator_iic_read_cmd);
+        DRIVER_MCP9808_LINK_IIC_READ_BATCH(&gs_handle[i], mcp9808_simulator_iic_read_batch);
+        DRIVER_MCP9808_LINK_IIC_WRITE(&gs_handle[i], mcp9808_simulator_iic_write);
+        DRIVER_MCP9808_LINK_DELAY_MS(&gs_handle[i], mcp9808_simulator_delay_ms);
+        DRIVER_MCP9808_LINK_GET_TIME_US(&gs_handle[i], mcp9808_simulator_time_us);
+        DRIVER_MCP9808_LINK_DEBUG_PRINT(&gs_handle[i], a_benchmark_debug_print);
+        DRIVER_MCP9808_LINK_RECEIVE_CALLBACK(&gs_handle[i], a_benchmark_receive_callback);
+        if ((mcp9808_set_addr(&gs_handle[i], (mcp9808_address_t)(MCP9808_ADDRESS_A2A1A0_000 + (i << 1))) != 0) ||
+            (mcp9808_init(&gs_handle[i]) != 0) ||
+            (mcp9808_set_cache(&gs_handle[i], cache) != 0))
+        {
+            return 1;
+        }
+    }
+    mcp9808_api_bind(gs_handle, &gs_config, cache);
+    mcp9808_simulator_delay_ms(300);
+    if (mcp9808_get_config(&gs_handle[0], &gs_config) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     benchmark test
+ * @param[in] format output format
+ * @param[in] times round number
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      every public api runs against the simulator with the cache disabled and enabled,
+ *            each result holds the iic transactions, bytes and scl clocks of one steady state call,
+ *            the bus time at 100kHz, 400kHz and 1MHz and the host cpu time per call,
+ *            only the results are printed so the output can be parsed directly
+ */
+uint8_t mcp9808_benchmark_test(mcp9808_benchmark_format_t format, uint32_t times)
+{
+    uint8_t res;
+    uint8_t failed;
+    uint8_t cache;
+    uint32_t i;
+    uint32_t j;
+    uint32_t k;
+    uint32_t calls;
+    uint32_t num;
+    clock_t start;
+    clock_t middle;
+    clock_t end;
+    double cpu_ns;
+    mcp9808_simulator_counter_t counter;
+    const mcp9808_api_call_t *table;
+    const mcp9808_api_call_t *c;
+    
+    if (times == 0)
+    {
+        mcp9808_interface_debug_print("mcp9808: times is invalid.\n");
+        
+        return 1;
+    }
+    calls = times * MCP9808_BENCHMARK_ROUND_CALL;
+    table = mcp9808_api_get_table(&num);
+    
+    /* output header */
+    if (format == MCP9808_BENCHMARK_FORMAT_JSON)
+    {
+        mcp9808_interface_debug_print("{\n");
+        mcp9808_interface_debug_print("  \"driver\": \"mcp9808\",\n");
+        mcp9808_interface_debug_print("  \"calls\": %u,\n", calls);
+        mcp9808_interface_debug_print("  \"results\":\n");
+        mcp9808_interface_debug_print("  [\n");
+    }
+    else
+    {
+        mcp9808_interface_debug_print("api,cache,status,transactions,bytes,clocks,bus_ns_100khz,bus_ns_400khz,bus_ns_1mhz,cpu_ns\n");
+    }
+    
+    failed = 0;
+    for (cache = 0; cache < 2; cache++)
+    {
+        for (i = 0; i < num; i++)
+        {
+            c = &table[i];
+            
+            /* warm up once, then count one steady state call */
+            res = a_benchmark_setup((mcp9808_bool_t)cache);
+            if (res == 0)
+            {
+                if (c->prepare != NULL)
+                {
+                    (void)c->prepare();
+                }
+                (void)c->run();
+                if (c->prepare != NULL)
+                {
+                    (void)c->prepare();
+                }
+                mcp9808_simulator_clear_counter();
+                res = c->run();
+            }
+            mcp9808_simulator_get_counter(&counter);
+            if (res != 0)
+            {
+                failed = 1;
+            }
+            
+            /* time the calls, the prepare time is measured apart and removed */
+            start = clock();
+            for (j = 0; j < times; j++)
+            {
+                for (k = 0; k < MCP9808_BENCHMARK_ROUND_CALL; k++)
+                {
+                    if (c->prepare != NULL)
+                    {
+                        (void)c->prepare();
+                    }
+                    (void)c->run();
+                }
+            }
+            middle = clock();
+            end = middle;
+            if (c->prepare != NULL)
+            {
+                for (j = 0; j < calls; j++)
+                {
+                    (void)c->prepare();
+                }
+                end = clock();
+            }
+            cpu_ns = ((double)(middle - start) - (double)(end - middle)) * 1000000000.0 /
+                     (double)CLOCKS_PER_SEC / (double)calls;
+            if (cpu_ns < 0.0)
+            {
+                cpu_ns = 0.0;
+            }
+            
+            /* output one result */
+            if (format == MCP9808_BENCHMARK_FORMAT_JSON)
+            {
+                mcp9808_interface_debug_print("    {\"api\":\"%s\",\"cache\":%s,\"status\":%u,\"transactions\":%u,\"bytes\":%u,\"clocks\":%u,"
+                                              "\"bus_ns_100khz\":%u,\"bus_ns_400khz\":%u,\"bus_ns_1mhz\":%u,\"cpu_ns\":%.1f}%s\n",
+                                              c->name, (cache != 0) ? "true" : "false", res, counter.transaction, counter.byte,
+                                              counter.clock, counter.clock * 10000U, counter.clock * 2500U, counter.clock * 1000U, cpu_ns,
+                                              ((cache != 0) && (i == num - 1)) ? "" : ",");
+            }
+            else
+            {
+                mcp9808_interface_debug_print("%s,%u,%u,%u,%u,%u,%u,%u,%u,%.1f\n",
+                                              c->name, cache, res, counter.transaction, counter.byte,
+                                              counter.clock, counter.clock * 10000U, counter.clock * 2500U, counter.clock * 1000U, cpu_ns);
+            }
+        }
+    }
+    
+    /* output footer */
+    if (format == MCP9808_BENCHMARK_FORMAT_JSON)
+    {
+        mcp9808_interface_debug_print("  ]\n");
+        mcp9808_interface_debug_print("}\n");
+    }
+    mcp9808_simulator_reset();
+    
+    return failed;
+}
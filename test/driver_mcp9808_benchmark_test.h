@@ -0,0 +1,87 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mcp9808_benchmark_test.h
+ * @brief     driver mcp9808 benchmark test header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-01-25
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/01/25  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_MCP9808_BENCHMARK_TEST_H
+#define DRIVER_MCP9808_BENCHMARK_TEST_H
+
+#include "driver_mcp9808_interface.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @addtogroup mcp9808_test_driver
+ * @{
+ */
+
+/**
+ * @brief mcp9808 benchmark definition
+ */
+#define MCP9808_BENCHMARK_ROUND_CALL        1000        /**< timed calls of one api in one round */
+
+/**
+ * @brief mcp9808 benchmark format enumeration definition
+ */
+typedef enum
+{
+    MCP9808_BENCHMARK_FORMAT_JSON = 0x00,        /**< one json document */
+    MCP9808_BENCHMARK_FORMAT_CSV  = 0x01,        /**< csv with a header line */
+} mcp9808_benchmark_format_t;
+
+/**
+ * @brief     benchmark test
+ * @param[in] format output format
+ * @param[in] times round number
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      every public api runs against the simulator with the cache disabled and enabled,
+ *            each result holds the iic transactions, bytes and scl clocks of one steady state call,
+ *            the bus time at 100kHz, 400kHz and 1MHz and the host cpu time per call,
+ *            only the results are printed so the output can be parsed directly
+ */
+uint8_t mcp9808_benchmark_test(mcp9808_benchmark_format_t format, uint32_t times);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,296 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mcp9808_budget_test.c
+ * @brief     driver mcp9808 budget test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-01-25
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/01/25  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_mcp9808_budget_test.h"
+#include "driver_mcp9808_api.h"
+#include "driver_mcp9808_simulator.h"
+
+/**
+ * @brief budget case structure definition
+ */
+typedef struct budget_case_s
+{
+    const char *name;               /**< api name in the api call table */
+    uint8_t (*prepare)(void);       /**< uncounted setup run after the api prepare, it can be NULL */
+    uint32_t transaction[2];        /**< expected transactions with the cache disabled and enabled */
+    uint32_t byte[2];               /**< expected bytes with the cache disabled and enabled */
+} budget_case_t;
+
+static mcp9808_handle_t gs_handle[2];        /**< mcp9808 handles on one simulated bus */
+static mcp9808_config_t gs_config;           /**< config applied by the apply_config call */
+static uint8_t gs_hot;                       /**< simulated temperature is above the high threshold */
+
+/**
+ * @brief     budget receive callback
+ * @param[in] type interrupt type
+ * @note      none
+ */
+static void a_budget_receive_callback(uint8_t type)
+{
+    (void)type;
+}
+
+/**
+ * @brief  budget toggle the simulated temperature
+ * @return status code
+ *         - 0 success
+ * @note   the high threshold is crossed so every call sees a latched interrupt
+ */
+static uint8_t a_budget_toggle(void)
+{
+    gs_hot = (gs_hot != 0) ? 0 : 1;
+    (void)mcp9808_simulator_set_temperature(0, MCP9808_ADDRESS_A2A1A0_000, (gs_hot != 0) ? 35000 : 25500);
+    mcp9808_simulator_delay_ms(300);
+    
+    return 0;
+}
+
+/**
+ * @brief  budget wait for a new conversion
+ * @return status code
+ *         - 0 success
+ * @note   a new conversion is finished before every scheduled read
+ */
+static uint8_t a_budget_wait(void)
+{
+    mcp9808_simulator_delay_ms(300);
+    
+    return 0;
+}
+
+/**
+ * @brief budget case table definition
+ * @note  a 16 bit register write is 1 transaction of 4 bytes (address, pointer, 2 data bytes),
+ *        a 16 bit register read with the pointer already set is 1 transaction of 3 bytes,
+ *        a config setter reads and writes the config without the cache and only writes it with the cache,
+ *        a fresh scheduled read reuses the known resolution in both modes
+ */
+static const budget_case_t gs_case[] =
+{
+    {"mcp9808_init", NULL, {2, 2}, {10, 10}},
+    {"mcp9808_deinit", NULL, {2, 2}, {9, 9}},
+    {"mcp9808_irq_handler", a_budget_toggle, {3, 2}, {14, 9}},
+#if (MCP9808_USE_FLOAT == 1)
+    {"mcp9808_read", NULL, {1, 1}, {3, 3}},
+#endif
+    {"mcp9808_read_milli_c", NULL, {1, 1}, {3, 3}},
+    {"mcp9808_read_scheduled", a_budget_wait, {1, 1}, {3, 3}},
+    {"mcp9808_read_batch", NULL, {2, 2}, {10, 10}},
+    {"mcp9808_set_temperature_threshold_hysteresis", NULL, {2, 1}, {7, 4}},
+    {"mcp9808_set_shutdown", NULL, {2, 1}, {7, 4}},
+    {"mcp9808_set_critical_temperature_lock", NULL, {2, 1}, {7, 4}},
+    {"mcp9808_set_temperature_threshold_lock", NULL, {2, 1}, {7, 4}},
+    {"mcp9808_clear_interrupt", NULL, {2, 1}, {7, 4}},
+    {"mcp9808_set_alert_output", NULL, {2, 1}, {7, 4}},
+    {"mcp9808_set_alert_output_select", NULL, {2, 1}, {7, 4}},
+    {"mcp9808_set_alert_output_polarity", NULL, {2, 1}, {7, 4}},
+    {"mcp9808_set_alert_output_mode", NULL, {2, 1}, {7, 4}},
+    {"mcp9808_apply_config", NULL, {4, 0}, {17, 0}},
+    {"mcp9808_set_temperature_high_threshold", NULL, {1, 1}, {4, 4}},
+    {"mcp9808_set_temperature_low_threshold", NULL, {1, 1}, {4, 4}},
+    {"mcp9808_set_critical_temperature", NULL, {1, 1}, {4, 4}},
+    {"mcp9808_set_resolution", NULL, {2, 1}, {5, 3}},
+    {"mcp9808_set_reg", NULL, {1, 1}, {4, 4}},
+    {"mcp9808_get_config", NULL, {4, 0}, {20, 0}},
+    {"mcp9808_resync_cache", NULL, {5, 5}, {24, 24}},
+};
+
+/**
+ * @brief     budget set up two devices on a fresh simulator
+ * @param[in] cache cache mode
+ * @return    status code
+ *            - 0 success
+ *            - 1 set up failed
+ * @note      none
+ */
+static uint8_t a_budget_setup(mcp9808_bool_t cache)
+{
+    uint8_t i;
+    
+    mcp9808_simulator_reset();
+    for (i = 0; i < 2; i++)
+    {
+        (void)mcp9808_simulator_attach(0, (uint8_t)(MCP9808_ADDRESS_A2A1A0_000 + (i << 1)));
+        (void)mcp9808_simulator_set_temperature(0, (uint8_t)(MCP9808_ADDRESS_A2A1A0_000 + (i << 1)), 25500);
+        
+        /* link the simulator */
+        DRIVER_MCP9808_LINK_INIT(&gs_handle[i], mcp9808_handle_t);
+        DRIVER_MCP9808_LINK_IIC_INIT(&gs_handle[i], mcp9808_simulator_iic_init);
+        DRIVER_MCP9808_LINK_IIC_DEINIT(&gs_handle[i], mcp9808_simulator_iic_deinit);
+        DRIVER_MCP9808_LINK_IIC_READ(&gs_handle[i], mcp9808_simulator_iic_read);
+        DRIVER_MCP9808_LINK_IIC_READ_CMD(&gs_handle[i], mcp9808_simulator_iic_read_cmd);
+        DRIVER_MCP9808_LINK_IIC_READ_BATCH(&gs_handle[i], mcp9808_simulator_iic_read_batch);
+        DRIVER_MCP9808_LINK_IIC_WRITE(&gs_handle[i], mcp9808_simulator_iic_write);
+        DRIVER_MCP9808_LINK_DELAY_MS(&gs_handle[i], mcp9808_simulator_delay_ms);
+        DRIVER_MCP9808_LINK_GET_TIME_US(&gs_handle[i], mcp9808_simulator_time_us);
+        DRIVER_MCP9808_LINK_DEBUG_PRINT(&gs_handle[i], mcp9808_interface_debug_print);
+        DRIVER_MCP9808_LINK_RECEIVE_CALLBACK(&gs_handle[i], a_budget_receive_callback);
+        if ((mcp9808_set_addr(&gs_handle[i], (mcp9808_address_t)(MCP9808_ADDRESS_A2A1A0_000 + (i << 1))) != 0) ||
+            (mcp9808_init(&gs_handle[i]) != 0) ||
+            (mcp9808_set_cache(&gs_handle[i], cache) != 0))
+        {
+            return 1;
+        }
+    }
+    
+    /* alert on the first device so irq handling sees real events */
+    if ((mcp9808_set_temperature_high_threshold(&gs_handle[0], 0x01E0) != 0) ||
+        (mcp9808_set_temperature_low_threshold(&gs_handle[0], 0x0140) != 0) ||
+        (mcp9808_set_critical_temperature(&gs_handle[0], 0x0280) != 0) ||
+        (mcp9808_set_alert_output_mode(&gs_handle[0], MCP9808_ALERT_OUTPUT_MODE_INTERRUPT) != 0) ||
+        (mcp9808_set_alert_output(&gs_handle[0], MCP9808_BOOL_TRUE) != 0))
+    {
+        return 1;
+    }
+    gs_hot = 0;
+    mcp9808_api_bind(gs_handle, &gs_config, cache);
+    mcp9808_simulator_delay_ms(300);
+    if (mcp9808_get_config(&gs_handle[0], &gs_config) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     budget run the uncounted setup of one case
+ * @param[in] *c pointer to a budget case
+ * @param[in] *call pointer to the api call of the case
+ * @note      the api prepare runs first
+ */
+static void a_budget_prepare(const budget_case_t *c, const mcp9808_api_call_t *call)
+{
+    if (call->prepare != NULL)
+    {
+        (void)call->prepare();
+    }
+    if (c->prepare != NULL)
+    {
+        (void)c->prepare();
+    }
+}
+
+/**
+ * @brief  budget test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   runs on the host against the simulator, no hardware is needed,
+ *         every operation is called once to settle the register pointer and then counted on the second call,
+ *         the transactions and bytes must match the budget exactly with the cache disabled and enabled
+ */
+uint8_t mcp9808_budget_test(void)
+{
+    uint8_t res;
+    uint8_t failed;
+    uint8_t cache;
+    uint32_t i;
+    mcp9808_simulator_counter_t counter;
+    const budget_case_t *c;
+    const mcp9808_api_call_t *call;
+    
+    /* start budget test */
+    mcp9808_interface_debug_print("mcp9808: start budget test.\n");
+    
+    failed = 0;
+    for (cache = 0; cache < 2; cache++)
+    {
+        mcp9808_interface_debug_print("mcp9808: cache is %s.\n", (cache != 0) ? "enabled" : "disabled");
+        for (i = 0; i < sizeof(gs_case) / sizeof(gs_case[0]); i++)
+        {
+            c = &gs_case[i];
+            call = mcp9808_api_find(c->name);
+            if (call == NULL)
+            {
+                mcp9808_interface_debug_print("mcp9808: %s is not in the api table.\n", c->name);
+                mcp9808_simulator_reset();
+                
+                return 1;
+            }
+            
+            /* set up */
+            res = a_budget_setup((mcp9808_bool_t)cache);
+            if (res != 0)
+            {
+                mcp9808_interface_debug_print("mcp9808: set up failed.\n");
+                mcp9808_simulator_reset();
+                
+                return 1;
+            }
+            
+            /* settle, then count the second call */
+            a_budget_prepare(c, call);
+            (void)call->run();
+            a_budget_prepare(c, call);
+            mcp9808_simulator_clear_counter();
+            res = call->run();
+            mcp9808_simulator_get_counter(&counter);
+            if (res != 0)
+            {
+                mcp9808_interface_debug_print("mcp9808: %s failed.\n", c->name);
+                failed = 1;
+                
+                continue;
+            }
+            
+            /* check the budget */
+            if ((counter.transaction != c->transaction[cache]) || (counter.byte != c->byte[cache]))
+            {
+                mcp9808_interface_debug_print("mcp9808: %s used %d transactions %d bytes, budget is %d transactions %d bytes.\n",
+                                              c->name, counter.transaction, counter.byte, c->transaction[cache], c->byte[cache]);
+                failed = 1;
+            }
+            else
+            {
+                mcp9808_interface_debug_print("mcp9808: %s %d transactions %d bytes.\n", c->name, counter.transaction, counter.byte);
+            }
+        }
+        mcp9808_interface_debug_print("mcp9808: check budget %s.\n", (failed != 0) ? "error" : "ok");
+    }
+    mcp9808_simulator_reset();
+    
+    /* finish budget test */
+    if (failed != 0)
+    {
+        mcp9808_interface_debug_print("mcp9808: budget test failed.\n");
+        
+        return 1;
+    }
+    mcp9808_interface_debug_print("mcp9808: finish budget test.\n");
+    
+    return 0;
+}
@@ -0,0 +1,318 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mcp9808_fault.c
+ * @brief     driver mcp9808 fault source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-01-25
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/01/25  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_mcp9808_fault.h"
+
+static mcp9808_handle_t *gs_handle;                                                         /**< attached handle */
+static mcp9808_fault_config_t gs_config;                                                    /**< fault models */
+static mcp9808_fault_counter_t gs_counter;                                                  /**< fault counter */
+static uint32_t gs_random = 1;                                                              /**< random state */
+static uint8_t gs_stuck;                                                                    /**< sda stuck flag */
+static uint32_t gs_stuck_time;                                                              /**< time sda got stuck */
+static uint8_t (*gs_iic_write)(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);      /**< real iic_write */
+static uint8_t (*gs_iic_read)(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);       /**< real iic_read */
+static uint8_t (*gs_iic_read_cmd)(uint8_t addr, uint8_t *buf, uint16_t len);                /**< real iic_read_cmd */
+static uint8_t (*gs_iic_read_batch)(uint8_t *addr, uint8_t *reg, uint8_t *buf,
+                                    uint16_t len, uint16_t num);                            /**< real iic_read_batch */
+
+/**
+ * @brief  fault next random number
+ * @return random number
+ * @note   xorshift32
+ */
+static uint32_t a_fault_random(void)
+{
+    gs_random ^= gs_random << 13;
+    gs_random ^= gs_random >> 17;
+    gs_random ^= gs_random << 5;
+    
+    return gs_random;
+}
+
+/**
+ * @brief     fault roll a chance
+ * @param[in] ppm chance in ppm
+ * @return    1 when it hits
+ * @note      none
+ */
+static uint8_t a_fault_roll(uint32_t ppm)
+{
+    if (ppm == 0)
+    {
+        return 0;
+    }
+    
+    return ((a_fault_random() % 1000000U) < ppm) ? 1 : 0;
+}
+
+/**
+ * @brief  fault decide whether one transaction fails
+ * @return 1 when the transaction fails
+ * @note   a stuck sda fails every transaction until stuck_us has passed
+ */
+static uint8_t a_fault_check(void)
+{
+    uint32_t now;
+    
+    gs_counter.transaction++;
+    now = (gs_handle->get_time_us != NULL) ? gs_handle->get_time_us() : 0;
+    if (gs_stuck != 0)
+    {
+        if ((gs_handle->get_time_us != NULL) && ((now - gs_stuck_time) < gs_config.stuck_us))
+        {
+            gs_counter.stuck++;
+            
+            return 1;
+        }
+        gs_stuck = 0;
+    }
+    if (a_fault_roll(gs_config.stuck_ppm) != 0)
+    {
+        gs_stuck = 1;
+        gs_stuck_time = now;
+        gs_counter.stuck++;
+        
+        return 1;
+    }
+    if (a_fault_roll(gs_config.nak_ppm) != 0)
+    {
+        gs_counter.nak++;
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     fault maybe corrupt a read payload
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @note      one random bit is flipped
+ */
+static void a_fault_corrupt(uint8_t *buf, uint16_t len)
+{
+    uint32_t bit;
+    
+    if ((len != 0) && (a_fault_roll(gs_config.corrupt_ppm) != 0))
+    {
+        bit = a_fault_random() % ((uint32_t)len * 8);
+        buf[bit / 8] ^= (uint8_t)(1 << (bit % 8));
+        gs_counter.corrupt++;
+    }
+}
+
+/**
+ * @brief     fault iic_write
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    1 on an injected fault or the status code of the real iic_write
+ * @note      none
+ */
+static uint8_t a_fault_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    if (a_fault_check() != 0)
+    {
+        return 1;
+    }
+    
+    return gs_iic_write(addr, reg, buf, len);
+}
+
+/**
+ * @brief      fault iic_read
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     1 on an injected fault or the status code of the real iic_read
+ * @note       none
+ */
+static uint8_t a_fault_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    if ((a_fault_check() != 0) || (gs_iic_read(addr, reg, buf, len) != 0))
+    {
+        return 1;
+    }
+    a_fault_corrupt(buf, len);
+    
+    return 0;
+}
+
+/**
+ * @brief      fault iic_read_cmd
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     1 on an injected fault or the status code of the real iic_read_cmd
+ * @note       none
+ */
+static uint8_t a_fault_iic_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    if ((a_fault_check() != 0) || (gs_iic_read_cmd(addr, buf, len) != 0))
+    {
+        return 1;
+    }
+    a_fault_corrupt(buf, len);
+    
+    return 0;
+}
+
+/**
+ * @brief      fault iic_read_batch
+ * @param[in]  *addr pointer to an iic device write address list
+ * @param[in]  *reg pointer to an iic register address list
+ * @param[out] *buf pointer to a data buffer, len bytes per device
+ * @param[in]  len data length of one device
+ * @param[in]  num device number
+ * @return     1 on an injected fault or the status code of the real iic_read_batch
+ * @note       none
+ */
+static uint8_t a_fault_iic_read_batch(uint8_t *addr, uint8_t *reg, uint8_t *buf, uint16_t len, uint16_t num)
+{
+    uint16_t i;
+    
+    /* every device transfer can fail on its own */
+    for (i = 0; i < num; i++)
+    {
+        if (a_fault_check() != 0)
+        {
+            return 1;
+        }
+    }
+    if (gs_iic_read_batch(addr, reg, buf, len, num) != 0)
+    {
+        return 1;
+    }
+    for (i = 0; i < num; i++)
+    {
+        a_fault_corrupt(&buf[(uint32_t)i * len], len);
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     fault set the fault models
+ * @param[in] *config pointer to a fault config structure
+ * @note      the random sequence restarts from the seed and the counter is cleared
+ */
+void mcp9808_fault_set_config(const mcp9808_fault_config_t *config)
+{
+    memcpy(&gs_config, config, sizeof(mcp9808_fault_config_t));
+    gs_random = (config->seed != 0) ? config->seed : 1;
+    gs_stuck = 0;
+    memset(&gs_counter, 0, sizeof(gs_counter));
+}
+
+/**
+ * @brief      fault get the counter
+ * @param[out] *counter pointer to a fault counter structure
+ * @note       none
+ */
+void mcp9808_fault_get_counter(mcp9808_fault_counter_t *counter)
+{
+    memcpy(counter, &gs_counter, sizeof(mcp9808_fault_counter_t));
+}
+
+/**
+ * @brief     fault attach the shim to a handle
+ * @param[in] *handle pointer to a mcp9808 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 attach failed
+ * @note      the iic_write, iic_read, iic_read_cmd and iic_read_batch links are wrapped,
+ *            a nak or a stuck bus fails the call without reaching the real bus,
+ *            a corrupted read reaches the real bus and flips one payload bit afterwards,
+ *            the stuck time is measured with get_time_us, only one handle can be attached
+ *            and the ctx links are not supported
+ */
+uint8_t mcp9808_fault_attach(mcp9808_handle_t *handle)
+{
+    if ((handle == NULL) || (gs_handle != NULL) ||
+        (handle->iic_write == NULL) || (handle->iic_read == NULL) || (handle->iic_read_cmd == NULL))
+    {
+        return 1;
+    }
+    if ((handle->iic_write_ctx != NULL) || (handle->iic_read_ctx != NULL) ||
+        (handle->iic_read_cmd_ctx != NULL) || (handle->iic_read_batch_ctx != NULL))
+    {
+        return 1;
+    }
+    
+    /* wrap the links */
+    gs_handle = handle;
+    gs_iic_write = handle->iic_write;
+    gs_iic_read = handle->iic_read;
+    gs_iic_read_cmd = handle->iic_read_cmd;
+    gs_iic_read_batch = handle->iic_read_batch;
+    DRIVER_MCP9808_LINK_IIC_WRITE(handle, a_fault_iic_write);
+    DRIVER_MCP9808_LINK_IIC_READ(handle, a_fault_iic_read);
+    DRIVER_MCP9808_LINK_IIC_READ_CMD(handle, a_fault_iic_read_cmd);
+    if (gs_iic_read_batch != NULL)
+    {
+        DRIVER_MCP9808_LINK_IIC_READ_BATCH(handle, a_fault_iic_read_batch);
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     fault detach the shim from a handle
+ * @param[in] *handle pointer to a mcp9808 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 detach failed
+ * @note      the original links of the handle are restored
+ */
+uint8_t mcp9808_fault_detach(mcp9808_handle_t *handle)
+{
+    if ((handle == NULL) || (handle != gs_handle))
+    {
+        return 1;
+    }
+    
+    /* restore the links */
+    DRIVER_MCP9808_LINK_IIC_WRITE(handle, gs_iic_write);
+    DRIVER_MCP9808_LINK_IIC_READ(handle, gs_iic_read);
+    DRIVER_MCP9808_LINK_IIC_READ_CMD(handle, gs_iic_read_cmd);
+    DRIVER_MCP9808_LINK_IIC_READ_BATCH(handle, gs_iic_read_batch);
+    gs_handle = NULL;
+    
+    return 0;
+}
@@ -0,0 +1,121 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mcp9808_fault.h
+ * @brief     driver mcp9808 fault header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-01-25
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/01/25  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_MCP9808_FAULT_H
+#define DRIVER_MCP9808_FAULT_H
+
+#include "driver_mcp9808.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup mcp9808_fault mcp9808 fault function
+ * @brief    mcp9808 iic fault injection modules
+ * @{
+ */
+
+/**
+ * @brief mcp9808 fault config structure definition
+ */
+typedef struct mcp9808_fault_config_s
+{
+    uint32_t nak_ppm;            /**< chance in ppm that one transaction is not acknowledged */
+    uint32_t stuck_ppm;          /**< chance in ppm that one transaction leaves sda stuck low */
+    uint32_t stuck_us;           /**< time a stuck sda needs to recover */
+    uint32_t corrupt_ppm;        /**< chance in ppm that one bit of a read payload flips */
+    uint32_t seed;               /**< random seed, 0 uses 1 */
+} mcp9808_fault_config_t;
+
+/**
+ * @brief mcp9808 fault counter structure definition
+ */
+typedef struct mcp9808_fault_counter_s
+{
+    uint32_t transaction;        /**< transactions seen by the shim */
+    uint32_t nak;                /**< injected naks */
+    uint32_t stuck;              /**< transactions failed on a stuck bus */
+    uint32_t corrupt;            /**< corrupted reads */
+} mcp9808_fault_counter_t;
+
+/**
+ * @brief     fault set the fault models
+ * @param[in] *config pointer to a fault config structure
+ * @note      the random sequence restarts from the seed and the counter is cleared
+ */
+void mcp9808_fault_set_config(const mcp9808_fault_config_t *config);
+
+/**
+ * @brief      fault get the counter
+ * @param[out] *counter pointer to a fault counter structure
+ * @note       none
+ */
+void mcp9808_fault_get_counter(mcp9808_fault_counter_t *counter);
+
+/**
+ * @brief     fault attach the shim to a handle
+ * @param[in] *handle pointer to a mcp9808 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 attach failed
+ * @note      the iic_write, iic_read, iic_read_cmd and iic_read_batch links are wrapped,
+ *            a nak or a stuck bus fails the call without reaching the real bus,
+ *            a corrupted read reaches the real bus and flips one payload bit afterwards,
+ *            the stuck time is measured with get_time_us, only one handle can be attached
+ *            and the ctx links are not supported
+ */
+uint8_t mcp9808_fault_attach(mcp9808_handle_t *handle);
+
+/**
+ * @brief     fault detach the shim from a handle
+ * @param[in] *handle pointer to a mcp9808 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 detach failed
+ * @note      the original links of the handle are restored
+ */
+uint8_t mcp9808_fault_detach(mcp9808_handle_t *handle);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,291 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mcp9808_fault_test.c
+ * @brief     driver mcp9808 fault test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-01-25
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/01/25  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_mcp9808_fault_test.h"
+#include "driver_mcp9808_fault.h"
+#include "driver_mcp9808_simulator.h"
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief fault test definition
+ */
+#define FAULT_TEST_FAIL_CLOCK        11          /**< scl clocks of a failed transaction, start, address byte and stop */
+#define FAULT_TEST_TEMPERATURE       25500       /**< simulated temperature in mC */
+#define FAULT_TEST_STUCK_US          5000        /**< time a stuck sda needs to recover */
+
+/**
+ * @brief fault test model enumeration definition
+ */
+typedef enum
+{
+    FAULT_TEST_MODEL_NONE    = 0x00,        /**< no fault */
+    FAULT_TEST_MODEL_NAK     = 0x01,        /**< not acknowledged transactions */
+    FAULT_TEST_MODEL_STUCK   = 0x02,        /**< sda stuck low for FAULT_TEST_STUCK_US */
+    FAULT_TEST_MODEL_CORRUPT = 0x03,        /**< one flipped bit in a read payload */
+} fault_test_model_t;
+
+/**
+ * @brief fault test policy structure definition
+ */
+typedef struct fault_test_policy_s
+{
+    uint8_t times;                 /**< retry times */
+    uint16_t backoff_ms;           /**< retry backoff */
+} fault_test_policy_t;
+
+static mcp9808_handle_t gs_handle;                                /**< mcp9808 handle */
+static uint32_t gs_latency[MCP9808_FAULT_TEST_MAX_SAMPLE];        /**< latency of every sample in us */
+static const char *const gs_model[] =
+{
+    "none", "nak", "stuck", "corrupt",
+};                                                                /**< fault model names */
+static const uint32_t gs_rate_ppm[] =
+{
+    1000, 10000, 50000, 100000, 200000,
+};                                                                /**< fault rates of every model */
+static const fault_test_policy_t gs_policy[] =
+{
+    {0, 0}, {3, 1},
+};                                                                /**< retry policies */
+
+/**
+ * @brief     fault test silent print
+ * @param[in] fmt format data
+ * @note      the driver reports every failed read, the table is printed instead
+ */
+static void a_fault_test_debug_print(const char *const fmt, ...)
+{
+    (void)fmt;
+}
+
+/**
+ * @brief     fault test latency compare
+ * @param[in] *a pointer to a latency
+ * @param[in] *b pointer to another latency
+ * @return    compare result
+ * @note      none
+ */
+static int a_fault_test_compare(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+    
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief     fault test run one fault model at one rate with one policy
+ * @param[in] model fault model
+ * @param[in] rate_ppm fault rate in ppm
+ * @param[in] *policy pointer to a retry policy
+ * @param[in] times sample number
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      only the given fault model is injected
+ */
+static uint8_t a_fault_test_run(fault_test_model_t model, uint32_t rate_ppm, const fault_test_policy_t *policy, uint32_t times)
+{
+    uint8_t res;
+    uint32_t i;
+    uint32_t ok;
+    uint32_t bad;
+    uint32_t fail;
+    uint32_t clock;
+    uint64_t start;
+    uint64_t begin;
+    int16_t raw;
+    int32_t temperature_mc;
+    mcp9808_fault_config_t config;
+    mcp9808_fault_counter_t fault;
+    mcp9808_simulator_counter_t counter;
+    mcp9808_retry_counter_t retry;
+    
+    /* a clean device */
+    mcp9808_simulator_reset();
+    (void)mcp9808_simulator_attach(0, MCP9808_ADDRESS_A2A1A0_000);
+    (void)mcp9808_simulator_set_temperature(0, MCP9808_ADDRESS_A2A1A0_000, FAULT_TEST_TEMPERATURE);
+    DRIVER_MCP9808_LINK_INIT(&gs_handle, mcp9808_handle_t);
+    DRIVER_MCP9808_LINK_IIC_INIT(&gs_handle, mcp9808_simulator_iic_init);
+    DRIVER_MCP9808_LINK_IIC_DEINIT(&gs_handle, mcp9808_simulator_iic_deinit);
+    DRIVER_MCP9808_LINK_IIC_READ(&gs_handle, mcp9808_simulator_iic_read);
+    DRIVER_MCP9808_LINK_IIC_READ_CMD(&gs_handle, mcp9808_simulator_iic_read_cmd);
+    DRIVER_MCP9808_LINK_IIC_WRITE(&gs_handle, mcp9808_simulator_iic_write);
+    DRIVER_MCP9808_LINK_DELAY_MS(&gs_handle, mcp9808_simulator_delay_ms);
+    DRIVER_MCP9808_LINK_GET_TIME_US(&gs_handle, mcp9808_simulator_time_us);
+    DRIVER_MCP9808_LINK_DEBUG_PRINT(&gs_handle, a_fault_test_debug_print);
+    DRIVER_MCP9808_LINK_RECEIVE_CALLBACK(&gs_handle, mcp9808_interface_receive_callback);
+    if ((mcp9808_set_addr(&gs_handle, MCP9808_ADDRESS_A2A1A0_000) != 0) ||
+        (mcp9808_init(&gs_handle) != 0) ||
+        (mcp9808_set_retry(&gs_handle, policy->times, policy->backoff_ms) != 0))
+    {
+        mcp9808_interface_debug_print("mcp9808: set up failed.\n");
+        
+        return 1;
+    }
+    mcp9808_simulator_delay_ms(300);
+    
+    /* put the shim between the driver and the bus, the same seed for every policy */
+    if (mcp9808_fault_attach(&gs_handle) != 0)
+    {
+        mcp9808_interface_debug_print("mcp9808: fault attach failed.\n");
+        
+        return 1;
+    }
+    memset(&config, 0, sizeof(mcp9808_fault_config_t));
+    config.nak_ppm = (model == FAULT_TEST_MODEL_NAK) ? rate_ppm : 0;
+    config.stuck_ppm = (model == FAULT_TEST_MODEL_STUCK) ? rate_ppm : 0;
+    config.stuck_us = FAULT_TEST_STUCK_US;
+    config.corrupt_ppm = (model == FAULT_TEST_MODEL_CORRUPT) ? rate_ppm : 0;
+    config.seed = rate_ppm + 1;
+    mcp9808_fault_set_config(&config);
+    
+    /* read back to back, failed transactions and backoff take bus time */
+    ok = 0;
+    bad = 0;
+    fail = 0;
+    begin = mcp9808_simulator_get_time_us();
+    for (i = 0; i < times; i++)
+    {
+        start = mcp9808_simulator_get_time_us();
+        mcp9808_simulator_get_counter(&counter);
+        clock = counter.clock;
+        mcp9808_fault_get_counter(&fault);
+        clock += (fault.nak + fault.stuck) * FAULT_TEST_FAIL_CLOCK;
+        res = mcp9808_read_milli_c(&gs_handle, &raw, &temperature_mc);
+        mcp9808_simulator_get_counter(&counter);
+        mcp9808_fault_get_counter(&fault);
+        clock = counter.clock + (fault.nak + fault.stuck) * FAULT_TEST_FAIL_CLOCK - clock;
+        mcp9808_simulator_advance_us((clock * 5 + 1) / 2);
+        gs_latency[i] = (uint32_t)(mcp9808_simulator_get_time_us() - start);
+        if (res != 0)
+        {
+            fail++;
+        }
+        else if (temperature_mc != FAULT_TEST_TEMPERATURE)
+        {
+            bad++;
+        }
+        else
+        {
+            ok++;
+        }
+    }
+    (void)mcp9808_fault_detach(&gs_handle);
+    (void)mcp9808_get_retry_counter(&gs_handle, &retry);
+    qsort(gs_latency, times, sizeof(uint32_t), a_fault_test_compare);
+    
+    /* output */
+    mcp9808_interface_debug_print("mcp9808: %s %0.1f percent retry %d ok %d fail %d bad %d retried %d recovered %d "
+                                  "throughput %0.1f/s p50 %dus p99 %dus max %dus.\n",
+                                  gs_model[model], (double)rate_ppm / 10000.0, policy->times, ok, fail, bad,
+                                  retry.retry, retry.recovered,
+                                  (double)ok * 1000000.0 / (double)(mcp9808_simulator_get_time_us() - begin),
+                                  gs_latency[times / 2], gs_latency[(times * 99) / 100], gs_latency[times - 1]);
+    
+    /* every injected failure must be seen by the driver as one failed read */
+    if ((retry.read_error != fault.nak + fault.stuck) || (fail != retry.exhausted) ||
+        ((model == FAULT_TEST_MODEL_NONE) && (ok != times)))
+    {
+        mcp9808_interface_debug_print("mcp9808: check counter error.\n");
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     fault test
+ * @param[in] times sample number of every fault rate
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      runs on the host against the simulator behind the fault shim, no hardware is needed,
+ *            a clean bus and then every fault model at every rate is read without retries and with 3 retries from a 1ms backoff,
+ *            bus time is counted at 400kHz, bad samples are corrupted reads the driver can not detect,
+ *            times below MCP9808_FAULT_TEST_MIN_SAMPLE is raised to it so p99 and throughput stay meaningful
+ */
+uint8_t mcp9808_fault_test(uint32_t times)
+{
+    uint32_t i;
+    uint32_t j;
+    uint32_t m;
+    
+    if (times > MCP9808_FAULT_TEST_MAX_SAMPLE)
+    {
+        mcp9808_interface_debug_print("mcp9808: times is invalid.\n");
+        
+        return 1;
+    }
+    if (times < MCP9808_FAULT_TEST_MIN_SAMPLE)
+    {
+        mcp9808_interface_debug_print("mcp9808: times is raised to %d.\n", MCP9808_FAULT_TEST_MIN_SAMPLE);
+        times = MCP9808_FAULT_TEST_MIN_SAMPLE;
+    }
+    
+    /* start fault test */
+    mcp9808_interface_debug_print("mcp9808: start fault test.\n");
+    mcp9808_interface_debug_print("mcp9808: %d samples of every rate, a stuck sda recovers after %dus.\n",
+                                  times, FAULT_TEST_STUCK_US);
+    for (m = FAULT_TEST_MODEL_NONE; m <= FAULT_TEST_MODEL_CORRUPT; m++)
+    {
+        for (i = 0; i < sizeof(gs_rate_ppm) / sizeof(gs_rate_ppm[0]); i++)
+        {
+            for (j = 0; j < sizeof(gs_policy) / sizeof(gs_policy[0]); j++)
+            {
+                if (a_fault_test_run((fault_test_model_t)m, (m == FAULT_TEST_MODEL_NONE) ? 0 : gs_rate_ppm[i],
+                                     &gs_policy[j], times) != 0)
+                {
+                    mcp9808_simulator_reset();
+                    
+                    return 1;
+                }
+            }
+            if (m == FAULT_TEST_MODEL_NONE)
+            {
+                break;
+            }
+        }
+    }
+    mcp9808_simulator_reset();
+    
+    /* finish fault test */
+    mcp9808_interface_debug_print("mcp9808: finish fault test.\n");
+    
+    return 0;
+}
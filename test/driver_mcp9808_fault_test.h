@@ -0,0 +1,77 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mcp9808_fault_test.h
+ * @brief     driver mcp9808 fault test header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-01-25
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/01/25  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_MCP9808_FAULT_TEST_H
+#define DRIVER_MCP9808_FAULT_TEST_H
+
+#include "driver_mcp9808_interface.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @addtogroup mcp9808_test_driver
+ * @{
+ */
+
+/**
+ * @brief mcp9808 fault test definition
+ */
+#define MCP9808_FAULT_TEST_MIN_SAMPLE        1000         /**< min samples of one fault rate */
+#define MCP9808_FAULT_TEST_MAX_SAMPLE        10000        /**< max samples of one fault rate */
+
+/**
+ * @brief     fault test
+ * @param[in] times sample number of every fault rate
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      runs on the host against the simulator behind the fault shim, no hardware is needed,
+ *            nak, stuck sda and corruption are swept one model at a time,
+ *            times below MCP9808_FAULT_TEST_MIN_SAMPLE is raised to it
+ */
+uint8_t mcp9808_fault_test(uint32_t times);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
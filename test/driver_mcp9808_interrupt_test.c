@@ -48,6 +48,9 @@ static void a_callback(uint8_t type)
 {
     int16_t raw;
     float temperature_deg = 0.0f;
+#if (MCP9808_USE_FLOAT != 1)
+    int32_t temperature_mc = 0;
+#endif
     
     switch (type)
     {
@@ -55,9 +58,15 @@ static void a_callback(uint8_t type)
         {
             mcp9808_interface_debug_print("mcp9808: irq critical temperature.\n");
             gs_flag = 1;
+            mcp9808_interface_event_notify();
             
             /* read temperature */
+#if (MCP9808_USE_FLOAT == 1)
             (void)mcp9808_read(&gs_handle, &raw, &temperature_deg);
+#else
+            (void)mcp9808_read_milli_c(&gs_handle, &raw, &temperature_mc);
+            temperature_deg = (float)raw * 0.0625f;
+#endif
             
             /* output */
             mcp9808_interface_debug_print("mcp9808: temperature is %0.2fC.\n", temperature_deg);
@@ -68,9 +77,15 @@ static void a_callback(uint8_t type)
         {
             mcp9808_interface_debug_print("mcp9808: irq temperature upper boundary.\n");
             gs_flag = 1;
+            mcp9808_interface_event_notify();
             
             /* read temperature */
+#if (MCP9808_USE_FLOAT == 1)
             (void)mcp9808_read(&gs_handle, &raw, &temperature_deg);
+#else
+            (void)mcp9808_read_milli_c(&gs_handle, &raw, &temperature_mc);
+            temperature_deg = (float)raw * 0.0625f;
+#endif
             
             /* output */
             mcp9808_interface_debug_print("mcp9808: temperature is %0.2fC.\n", temperature_deg);
@@ -81,9 +96,15 @@ static void a_callback(uint8_t type)
         {
             mcp9808_interface_debug_print("mcp9808: irq temperature lower boundary.\n");
             gs_flag = 1;
+            mcp9808_interface_event_notify();
             
             /* read temperature */
+#if (MCP9808_USE_FLOAT == 1)
             (void)mcp9808_read(&gs_handle, &raw, &temperature_deg);
+#else
+            (void)mcp9808_read_milli_c(&gs_handle, &raw, &temperature_mc);
+            temperature_deg = (float)raw * 0.0625f;
+#endif
             
             /* output */
             mcp9808_interface_debug_print("mcp9808: temperature is %0.2fC.\n", temperature_deg);
@@ -141,8 +162,10 @@ uint8_t mcp9808_interrupt_test(mcp9808_address_t addr, float low, float high,
     DRIVER_MCP9808_LINK_IIC_INIT(&gs_handle, mcp9808_interface_iic_init);
     DRIVER_MCP9808_LINK_IIC_DEINIT(&gs_handle, mcp9808_interface_iic_deinit);
     DRIVER_MCP9808_LINK_IIC_READ(&gs_handle, mcp9808_interface_iic_read);
+    DRIVER_MCP9808_LINK_IIC_READ_CMD(&gs_handle, mcp9808_interface_iic_read_cmd);
     DRIVER_MCP9808_LINK_IIC_WRITE(&gs_handle, mcp9808_interface_iic_write);
     DRIVER_MCP9808_LINK_DELAY_MS(&gs_handle, mcp9808_interface_delay_ms);
+    DRIVER_MCP9808_LINK_GET_TIME_US(&gs_handle, mcp9808_interface_get_time_us);
     DRIVER_MCP9808_LINK_DEBUG_PRINT(&gs_handle, mcp9808_interface_debug_print);
     DRIVER_MCP9808_LINK_RECEIVE_CALLBACK(&gs_handle, a_callback);
     
@@ -270,7 +293,11 @@ uint8_t mcp9808_interrupt_test(mcp9808_address_t addr, float low, float high,
     }
     
     /* temperature convert to register */
+#if (MCP9808_USE_FLOAT == 1)
     res = mcp9808_temperature_convert_to_register(&gs_handle, high, &reg);
+#else
+    res = mcp9808_temperature_convert_to_register_milli_c(&gs_handle, (int32_t)(high * 1000.0f), &reg);
+#endif
     if (res != 0)
     {
         mcp9808_interface_debug_print("mcp9808: temperature convert to register failed.\n");
@@ -290,7 +317,11 @@ uint8_t mcp9808_interrupt_test(mcp9808_address_t addr, float low, float high,
     }
     
     /* temperature convert to register */
+#if (MCP9808_USE_FLOAT == 1)
     res = mcp9808_temperature_convert_to_register(&gs_handle, low, &reg);
+#else
+    res = mcp9808_temperature_convert_to_register_milli_c(&gs_handle, (int32_t)(low * 1000.0f), &reg);
+#endif
     if (res != 0)
     {
         mcp9808_interface_debug_print("mcp9808: temperature convert to register failed.\n");
@@ -310,7 +341,11 @@ uint8_t mcp9808_interrupt_test(mcp9808_address_t addr, float low, float high,
     }
     
     /* temperature convert to register */
+#if (MCP9808_USE_FLOAT == 1)
     res = mcp9808_temperature_convert_to_register(&gs_handle, critical_temperature, &reg);
+#else
+    res = mcp9808_temperature_convert_to_register_milli_c(&gs_handle, (int32_t)(critical_temperature * 1000.0f), &reg);
+#endif
     if (res != 0)
     {
         mcp9808_interface_debug_print("mcp9808: temperature convert to register failed.\n");
@@ -354,8 +389,9 @@ uint8_t mcp9808_interrupt_test(mcp9808_address_t addr, float low, float high,
     {
         while (gs_flag == 0)
         {
-            gs_flag = 0;
+            (void)mcp9808_interface_event_wait(MCP9808_INTERFACE_WAIT_FOREVER);
         }
+        gs_flag = 0;
         
         /* output */
         mcp9808_interface_debug_print("mcp9808: find interrupt.\n");
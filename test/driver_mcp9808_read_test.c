@@ -35,8 +35,29 @@
  */
 
 #include "driver_mcp9808_read_test.h"
+#include "driver_mcp9808_async.h"
 
-static mcp9808_handle_t gs_handle;        /**< mcp9808 handle */
+static mcp9808_handle_t gs_handle;              /**< mcp9808 handle */
+static mcp9808_async_handle_t gs_async;         /**< mcp9808 async handle */
+static volatile uint8_t gs_async_done;          /**< async done flag */
+static volatile uint8_t gs_async_res;           /**< async result */
+static volatile uint16_t gs_async_value;        /**< async value */
+
+/**
+ * @brief     async completion callback
+ * @param[in] *async pointer to a mcp9808 async handle structure
+ * @param[in] res operation result
+ * @param[in] value operation value
+ * @note      none
+ */
+static void a_mcp9808_read_test_async_done(mcp9808_async_handle_t *async, uint8_t res, uint16_t value)
+{
+    (void)async;
+    
+    gs_async_res = res;
+    gs_async_value = value;
+    gs_async_done = 1;
+}
 
 /**
  * @brief     read test
@@ -58,8 +79,10 @@ uint8_t mcp9808_read_test(mcp9808_address_t addr, uint32_t times)
     DRIVER_MCP9808_LINK_IIC_INIT(&gs_handle, mcp9808_interface_iic_init);
     DRIVER_MCP9808_LINK_IIC_DEINIT(&gs_handle, mcp9808_interface_iic_deinit);
     DRIVER_MCP9808_LINK_IIC_READ(&gs_handle, mcp9808_interface_iic_read);
+    DRIVER_MCP9808_LINK_IIC_READ_CMD(&gs_handle, mcp9808_interface_iic_read_cmd);
     DRIVER_MCP9808_LINK_IIC_WRITE(&gs_handle, mcp9808_interface_iic_write);
     DRIVER_MCP9808_LINK_DELAY_MS(&gs_handle, mcp9808_interface_delay_ms);
+    DRIVER_MCP9808_LINK_GET_TIME_US(&gs_handle, mcp9808_interface_get_time_us);
     DRIVER_MCP9808_LINK_DEBUG_PRINT(&gs_handle, mcp9808_interface_debug_print);
     DRIVER_MCP9808_LINK_RECEIVE_CALLBACK(&gs_handle, mcp9808_interface_receive_callback);
     
@@ -213,12 +236,20 @@ uint8_t mcp9808_read_test(mcp9808_address_t addr, uint32_t times)
     {
         int16_t raw;
         float temperature_deg;
+#if (MCP9808_USE_FLOAT != 1)
+        int32_t temperature_mc;
+#endif
         
         /* delay 1000ms */
         mcp9808_interface_delay_ms(1000);
         
         /* read data */
+#if (MCP9808_USE_FLOAT == 1)
         res = mcp9808_read(&gs_handle, &raw, &temperature_deg);
+#else
+        res = mcp9808_read_milli_c(&gs_handle, &raw, &temperature_mc);
+        temperature_deg = (float)raw * 0.0625f;
+#endif
         if (res != 0)
         {
             mcp9808_interface_debug_print("mcp9808: read failed.\n");
@@ -248,12 +279,20 @@ uint8_t mcp9808_read_test(mcp9808_address_t addr, uint32_t times)
     {
         int16_t raw;
         float temperature_deg;
+#if (MCP9808_USE_FLOAT != 1)
+        int32_t temperature_mc;
+#endif
         
         /* delay 1000ms */
         mcp9808_interface_delay_ms(1000);
         
         /* read data */
+#if (MCP9808_USE_FLOAT == 1)
         res = mcp9808_read(&gs_handle, &raw, &temperature_deg);
+#else
+        res = mcp9808_read_milli_c(&gs_handle, &raw, &temperature_mc);
+        temperature_deg = (float)raw * 0.0625f;
+#endif
         if (res != 0)
         {
             mcp9808_interface_debug_print("mcp9808: read failed.\n");
@@ -283,12 +322,20 @@ uint8_t mcp9808_read_test(mcp9808_address_t addr, uint32_t times)
     {
         int16_t raw;
         float temperature_deg;
+#if (MCP9808_USE_FLOAT != 1)
+        int32_t temperature_mc;
+#endif
         
         /* delay 1000ms */
         mcp9808_interface_delay_ms(1000);
         
         /* read data */
+#if (MCP9808_USE_FLOAT == 1)
         res = mcp9808_read(&gs_handle, &raw, &temperature_deg);
+#else
+        res = mcp9808_read_milli_c(&gs_handle, &raw, &temperature_mc);
+        temperature_deg = (float)raw * 0.0625f;
+#endif
         if (res != 0)
         {
             mcp9808_interface_debug_print("mcp9808: read failed.\n");
@@ -318,12 +365,20 @@ uint8_t mcp9808_read_test(mcp9808_address_t addr, uint32_t times)
     {
         int16_t raw;
         float temperature_deg;
+#if (MCP9808_USE_FLOAT != 1)
+        int32_t temperature_mc;
+#endif
         
         /* delay 1000ms */
         mcp9808_interface_delay_ms(1000);
         
         /* read data */
+#if (MCP9808_USE_FLOAT == 1)
         res = mcp9808_read(&gs_handle, &raw, &temperature_deg);
+#else
+        res = mcp9808_read_milli_c(&gs_handle, &raw, &temperature_mc);
+        temperature_deg = (float)raw * 0.0625f;
+#endif
         if (res != 0)
         {
             mcp9808_interface_debug_print("mcp9808: read failed.\n");
@@ -336,6 +391,135 @@ uint8_t mcp9808_read_test(mcp9808_address_t addr, uint32_t times)
         mcp9808_interface_debug_print("mcp9808: temperature is %0.2fC.\n", temperature_deg);
     }
     
+    /* millidegree read */
+    mcp9808_interface_debug_print("mcp9808: millidegree read.\n");
+    
+    for (i = 0; i < times; i++)
+    {
+        int16_t raw;
+        int32_t temperature_mc;
+        
+        /* delay 1000ms */
+        mcp9808_interface_delay_ms(1000);
+        
+        /* read data */
+        res = mcp9808_read_milli_c(&gs_handle, &raw, &temperature_mc);
+        if (res != 0)
+        {
+            mcp9808_interface_debug_print("mcp9808: read failed.\n");
+            (void)mcp9808_deinit(&gs_handle);
+            
+            return 1;
+        }
+        
+        /* output */
+        mcp9808_interface_debug_print("mcp9808: temperature is %dmC.\n", (int)temperature_mc);
+    }
+    
+    /* scheduled read */
+    mcp9808_interface_debug_print("mcp9808: scheduled read.\n");
+    
+    i = 0;
+    while (i < times)
+    {
+        int16_t raw;
+        uint32_t next_us;
+        uint32_t now_us;
+        mcp9808_bool_t fresh;
+        
+        /* read data */
+        res = mcp9808_read_scheduled(&gs_handle, &raw, &fresh, &next_us);
+        if ((res != 0) && (res != 5))
+        {
+            mcp9808_interface_debug_print("mcp9808: read failed.\n");
+            (void)mcp9808_deinit(&gs_handle);
+            
+            return 1;
+        }
+        
+        /* output */
+        if ((res == 0) && (fresh == MCP9808_BOOL_TRUE))
+        {
+            mcp9808_interface_debug_print("mcp9808: temperature is %0.2fC.\n", (float)(raw) * 0.0625f);
+            i++;
+        }
+        
+        /* sleep until the next fresh sample */
+        now_us = mcp9808_interface_get_time_us();
+        if ((int32_t)(next_us - now_us) > 0)
+        {
+            mcp9808_interface_delay_ms((next_us - now_us) / 1000 + 1);
+        }
+    }
+    
+    /* async read */
+    mcp9808_interface_debug_print("mcp9808: async read.\n");
+    
+    /* link async interface function */
+    DRIVER_MCP9808_ASYNC_LINK_INIT(&gs_async, mcp9808_async_handle_t);
+    DRIVER_MCP9808_ASYNC_LINK_IIC_READ_START(&gs_async, mcp9808_interface_iic_read_start);
+    DRIVER_MCP9808_ASYNC_LINK_IIC_WRITE_START(&gs_async, mcp9808_interface_iic_write_start);
+    DRIVER_MCP9808_ASYNC_LINK_IIC_STATUS(&gs_async, mcp9808_interface_iic_status);
+    DRIVER_MCP9808_ASYNC_LINK_GET_TIME_US(&gs_async, mcp9808_interface_get_time_us);
+    
+    /* async init */
+    res = mcp9808_async_init(&gs_async, &gs_handle);
+    if (res != 0)
+    {
+        mcp9808_interface_debug_print("mcp9808: async init failed.\n");
+        (void)mcp9808_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    for (i = 0; i < times; i++)
+    {
+        /* queue a 1000ms delay and a temperature read */
+        gs_async_done = 0;
+        res = mcp9808_async_delay(&gs_async, 1000, NULL);
+        if (res != 0)
+        {
+            mcp9808_interface_debug_print("mcp9808: async delay failed.\n");
+            (void)mcp9808_deinit(&gs_handle);
+            
+            return 1;
+        }
+        res = mcp9808_async_read_temperature(&gs_async, a_mcp9808_read_test_async_done);
+        if (res != 0)
+        {
+            mcp9808_interface_debug_print("mcp9808: async read temperature failed.\n");
+            (void)mcp9808_deinit(&gs_handle);
+            
+            return 1;
+        }
+        
+        /* poll until done */
+        while (gs_async_done == 0)
+        {
+            res = mcp9808_async_poll(&gs_async);
+            if (res != 0)
+            {
+                mcp9808_interface_debug_print("mcp9808: async poll failed.\n");
+                (void)mcp9808_deinit(&gs_handle);
+                
+                return 1;
+            }
+        }
+        if (gs_async_res != 0)
+        {
+            mcp9808_interface_debug_print("mcp9808: read failed.\n");
+            (void)mcp9808_deinit(&gs_handle);
+            
+            return 1;
+        }
+        
+        /* output */
+        mcp9808_interface_debug_print("mcp9808: temperature is %0.2fC.\n", (float)((int16_t)gs_async_value) * 0.0625f);
+    }
+    
+    /* async deinit */
+    (void)mcp9808_async_deinit(&gs_async);
+    
     /* finish read test */
     mcp9808_interface_debug_print("mcp9808: finish read test.\n");
     (void)mcp9808_deinit(&gs_handle);
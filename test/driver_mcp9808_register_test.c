@@ -53,8 +53,12 @@ uint8_t mcp9808_register_test(mcp9808_address_t addr)
     uint8_t revision;
     uint16_t reg;
     uint16_t reg_check;
+#if (MCP9808_USE_FLOAT == 1)
     float temperature_deg;
     float temperature_deg_check;
+#endif
+    int32_t temperature_mc;
+    int32_t temperature_mc_check;
     mcp9808_info_t info;
     mcp9808_address_t addr_pin;
     mcp9808_bool_t enable;
@@ -63,14 +67,18 @@ uint8_t mcp9808_register_test(mcp9808_address_t addr)
     mcp9808_alert_output_polarity_t polarity;
     mcp9808_alert_output_mode_t mode;
     mcp9808_resolution_t resolution;
+    mcp9808_config_t config;
+    mcp9808_config_t config_check;
 
     /* link interface function */
     DRIVER_MCP9808_LINK_INIT(&gs_handle, mcp9808_handle_t); 
     DRIVER_MCP9808_LINK_IIC_INIT(&gs_handle, mcp9808_interface_iic_init);
     DRIVER_MCP9808_LINK_IIC_DEINIT(&gs_handle, mcp9808_interface_iic_deinit);
     DRIVER_MCP9808_LINK_IIC_READ(&gs_handle, mcp9808_interface_iic_read);
+    DRIVER_MCP9808_LINK_IIC_READ_CMD(&gs_handle, mcp9808_interface_iic_read_cmd);
     DRIVER_MCP9808_LINK_IIC_WRITE(&gs_handle, mcp9808_interface_iic_write);
     DRIVER_MCP9808_LINK_DELAY_MS(&gs_handle, mcp9808_interface_delay_ms);
+    DRIVER_MCP9808_LINK_GET_TIME_US(&gs_handle, mcp9808_interface_get_time_us);
     DRIVER_MCP9808_LINK_DEBUG_PRINT(&gs_handle, mcp9808_interface_debug_print);
     DRIVER_MCP9808_LINK_RECEIVE_CALLBACK(&gs_handle, mcp9808_interface_receive_callback);
     
@@ -766,6 +774,7 @@ uint8_t mcp9808_register_test(mcp9808_address_t addr)
     }
     mcp9808_interface_debug_print("mcp9808: check resolution %s.\n", (resolution == MCP9808_RESOLUTION_0P0625) ? "ok" : "error");
     
+#if (MCP9808_USE_FLOAT == 1)
     /* mcp9808_temperature_convert_to_register/mcp9808_temperature_convert_to_data test */
     mcp9808_interface_debug_print("mcp9808: mcp9808_temperature_convert_to_register/mcp9808_temperature_convert_to_data test.\n");
     
@@ -808,6 +817,215 @@ uint8_t mcp9808_register_test(mcp9808_address_t addr)
         return 1;
     }
     mcp9808_interface_debug_print("mcp9808: check temperature %0.3fC.\n", temperature_deg_check);
+#endif
+    
+    /* mcp9808_temperature_convert_to_register_milli_c/mcp9808_temperature_convert_to_data_milli_c test */
+    mcp9808_interface_debug_print("mcp9808: mcp9808_temperature_convert_to_register_milli_c/mcp9808_temperature_convert_to_data_milli_c test.\n");
+    
+    temperature_mc = (rand() % 40) * 250;
+    res = mcp9808_temperature_convert_to_register_milli_c(&gs_handle, temperature_mc, &reg);
+    if (res != 0)
+    {
+        mcp9808_interface_debug_print("mcp9808: temperature convert to register failed.\n");
+        (void)mcp9808_deinit(&gs_handle);
+        
+        return 1;
+    }
+    mcp9808_interface_debug_print("mcp9808: set temperature %dmC.\n", (int)temperature_mc);
+    res = mcp9808_temperature_convert_to_data_milli_c(&gs_handle, reg, &temperature_mc_check);
+    if (res != 0)
+    {
+        mcp9808_interface_debug_print("mcp9808: temperature convert to data failed.\n");
+        (void)mcp9808_deinit(&gs_handle);
+        
+        return 1;
+    }
+    mcp9808_interface_debug_print("mcp9808: check temperature %s.\n", (temperature_mc == temperature_mc_check) ? "ok" : "error");
+    
+    temperature_mc = -(rand() % 40) * 250;
+    res = mcp9808_temperature_convert_to_register_milli_c(&gs_handle, temperature_mc, &reg);
+    if (res != 0)
+    {
+        mcp9808_interface_debug_print("mcp9808: temperature convert to register failed.\n");
+        (void)mcp9808_deinit(&gs_handle);
+        
+        return 1;
+    }
+    mcp9808_interface_debug_print("mcp9808: set temperature %dmC.\n", (int)temperature_mc);
+    res = mcp9808_temperature_convert_to_data_milli_c(&gs_handle, reg, &temperature_mc_check);
+    if (res != 0)
+    {
+        mcp9808_interface_debug_print("mcp9808: temperature convert to data failed.\n");
+        (void)mcp9808_deinit(&gs_handle);
+        
+        return 1;
+    }
+    mcp9808_interface_debug_print("mcp9808: check temperature %s.\n", (temperature_mc == temperature_mc_check) ? "ok" : "error");
+    
+    /* mcp9808_set_cache/mcp9808_get_cache test */
+    mcp9808_interface_debug_print("mcp9808: mcp9808_set_cache/mcp9808_get_cache test.\n");
+    
+    /* enable cache */
+    res = mcp9808_set_cache(&gs_handle, MCP9808_BOOL_TRUE);
+    if (res != 0)
+    {
+        mcp9808_interface_debug_print("mcp9808: set cache failed.\n");
+        (void)mcp9808_deinit(&gs_handle);
+        
+        return 1;
+    }
+    mcp9808_interface_debug_print("mcp9808: enable cache.\n");
+    res = mcp9808_get_cache(&gs_handle, &enable);
+    if (res != 0)
+    {
+        mcp9808_interface_debug_print("mcp9808: get cache failed.\n");
+        (void)mcp9808_deinit(&gs_handle);
+        
+        return 1;
+    }
+    mcp9808_interface_debug_print("mcp9808: check cache %s.\n", (enable == MCP9808_BOOL_TRUE) ? "ok" : "error");
+    
+    /* set alert output polarity high with the cache */
+    res = mcp9808_set_alert_output_polarity(&gs_handle, MCP9808_ALERT_OUTPUT_POLARITY_HIGH);
+    if (res != 0)
+    {
+        mcp9808_interface_debug_print("mcp9808: set alert output polarity failed.\n");
+        (void)mcp9808_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* set alert output polarity low with the cache */
+    res = mcp9808_set_alert_output_polarity(&gs_handle, MCP9808_ALERT_OUTPUT_POLARITY_LOW);
+    if (res != 0)
+    {
+        mcp9808_interface_debug_print("mcp9808: set alert output polarity failed.\n");
+        (void)mcp9808_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* mcp9808_resync_cache test */
+    mcp9808_interface_debug_print("mcp9808: mcp9808_resync_cache test.\n");
+    
+    /* resync cache */
+    res = mcp9808_resync_cache(&gs_handle);
+    if (res != 0)
+    {
+        mcp9808_interface_debug_print("mcp9808: resync cache failed.\n");
+        (void)mcp9808_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = mcp9808_get_alert_output_polarity(&gs_handle, &polarity);
+    if (res != 0)
+    {
+        mcp9808_interface_debug_print("mcp9808: get alert output polarity failed.\n");
+        (void)mcp9808_deinit(&gs_handle);
+        
+        return 1;
+    }
+    mcp9808_interface_debug_print("mcp9808: check resync cache %s.\n", (polarity == MCP9808_ALERT_OUTPUT_POLARITY_LOW) ? "ok" : "error");
+    
+    /* mcp9808_invalidate_cache test */
+    mcp9808_interface_debug_print("mcp9808: mcp9808_invalidate_cache test.\n");
+    
+    /* invalidate cache */
+    res = mcp9808_invalidate_cache(&gs_handle);
+    if (res != 0)
+    {
+        mcp9808_interface_debug_print("mcp9808: invalidate cache failed.\n");
+        (void)mcp9808_deinit(&gs_handle);
+        
+        return 1;
+    }
+    mcp9808_interface_debug_print("mcp9808: check invalidate cache %s.\n", (res == 0) ? "ok" : "error");
+    
+    /* disable cache */
+    res = mcp9808_set_cache(&gs_handle, MCP9808_BOOL_FALSE);
+    if (res != 0)
+    {
+        mcp9808_interface_debug_print("mcp9808: set cache failed.\n");
+        (void)mcp9808_deinit(&gs_handle);
+        
+        return 1;
+    }
+    mcp9808_interface_debug_print("mcp9808: disable cache.\n");
+    res = mcp9808_get_cache(&gs_handle, &enable);
+    if (res != 0)
+    {
+        mcp9808_interface_debug_print("mcp9808: get cache failed.\n");
+        (void)mcp9808_deinit(&gs_handle);
+        
+        return 1;
+    }
+    mcp9808_interface_debug_print("mcp9808: check cache %s.\n", (enable == MCP9808_BOOL_FALSE) ? "ok" : "error");
+    
+    /* mcp9808_apply_config/mcp9808_get_config test */
+    mcp9808_interface_debug_print("mcp9808: mcp9808_apply_config/mcp9808_get_config test.\n");
+    
+    /* apply config */
+    config.hysteresis = MCP9808_HYSTERESIS_1P5;
+    config.shutdown = MCP9808_BOOL_FALSE;
+    config.critical_temperature_lock = MCP9808_BOOL_FALSE;
+    config.temperature_threshold_lock = MCP9808_BOOL_FALSE;
+    config.alert_output = MCP9808_BOOL_TRUE;
+    config.alert_output_select = MCP9808_ALERT_OUTPUT_SELECT_ALL;
+    config.alert_output_polarity = MCP9808_ALERT_OUTPUT_POLARITY_LOW;
+    config.alert_output_mode = MCP9808_ALERT_OUTPUT_MODE_INTERRUPT;
+    config.high_threshold = rand() % 0x07FFU;
+    config.low_threshold = rand() % 0x07FFU;
+    config.critical_temperature = rand() % 0x07FFU;
+    res = mcp9808_apply_config(&gs_handle, &config);
+    if (res != 0)
+    {
+        mcp9808_interface_debug_print("mcp9808: apply config failed.\n");
+        (void)mcp9808_deinit(&gs_handle);
+        
+        return 1;
+    }
+    mcp9808_interface_debug_print("mcp9808: apply config.\n");
+    res = mcp9808_get_config(&gs_handle, &config_check);
+    if (res != 0)
+    {
+        mcp9808_interface_debug_print("mcp9808: get config failed.\n");
+        (void)mcp9808_deinit(&gs_handle);
+        
+        return 1;
+    }
+    mcp9808_interface_debug_print("mcp9808: check config %s.\n", ((config.hysteresis == config_check.hysteresis) &&
+                                  (config.shutdown == config_check.shutdown) &&
+                                  (config.critical_temperature_lock == config_check.critical_temperature_lock) &&
+                                  (config.temperature_threshold_lock == config_check.temperature_threshold_lock) &&
+                                  (config.alert_output == config_check.alert_output) &&
+                                  (config.alert_output_select == config_check.alert_output_select) &&
+                                  (config.alert_output_polarity == config_check.alert_output_polarity) &&
+                                  (config.alert_output_mode == config_check.alert_output_mode) &&
+                                  (config.high_threshold == config_check.high_threshold) &&
+                                  (config.low_threshold == config_check.low_threshold) &&
+                                  (config.critical_temperature == config_check.critical_temperature)) ? "ok" : "error");
+    
+    /* disable alert output with the config */
+    config.alert_output = MCP9808_BOOL_FALSE;
+    config.hysteresis = MCP9808_HYSTERESIS_0P0;
+    res = mcp9808_apply_config(&gs_handle, &config);
+    if (res != 0)
+    {
+        mcp9808_interface_debug_print("mcp9808: apply config failed.\n");
+        (void)mcp9808_deinit(&gs_handle);
+        
+        return 1;
+    }
+    mcp9808_interface_debug_print("mcp9808: disable alert output with the config.\n");
+    res = mcp9808_get_alert_output(&gs_handle, &enable);
+    if (res != 0)
+    {
+        mcp9808_interface_debug_print("mcp9808: get alert output failed.\n");
+        (void)mcp9808_deinit(&gs_handle);
+        
+        return 1;
+    }
+    mcp9808_interface_debug_print("mcp9808: check alert output %s.\n", (enable == MCP9808_BOOL_FALSE) ? "ok" : "error");
     
     /* mcp9808_set_critical_temperature_lock/mcp9808_get_critical_temperature_lock test */
     mcp9808_interface_debug_print("mcp9808: mcp9808_set_critical_temperature_lock/mcp9808_get_critical_temperature_lock test.\n");
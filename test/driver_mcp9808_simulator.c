@@ -0,0 +1,1138 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mcp9808_simulator.c
+ * @brief     driver mcp9808 simulator source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-01-25
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/01/25  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_mcp9808_simulator.h"
+
+/**
+ * @brief simulator register definition
+ */
+#define SIMULATOR_REG_CONFIG                 0x01        /**< config register */
+#define SIMULATOR_REG_ALERT_UPPER            0x02        /**< alert upper register */
+#define SIMULATOR_REG_ALERT_LOWER            0x03        /**< alert lower register */
+#define SIMULATOR_REG_CRIT                   0x04        /**< critical temperature register */
+#define SIMULATOR_REG_TEMPERATURE            0x05        /**< temperature register */
+#define SIMULATOR_REG_MANUFACTURER_ID        0x06        /**< manufacturer id register */
+#define SIMULATOR_REG_DEVICE_ID              0x07        /**< device id register */
+#define SIMULATOR_REG_RESOLUTION             0x08        /**< resolution register */
+
+/**
+ * @brief simulator config bit definition
+ */
+#define SIMULATOR_CONFIG_MODE                (1U << 0)   /**< interrupt output mode */
+#define SIMULATOR_CONFIG_POLARITY            (1U << 1)   /**< active high output */
+#define SIMULATOR_CONFIG_SELECT              (1U << 2)   /**< critical temperature only */
+#define SIMULATOR_CONFIG_CONTROL             (1U << 3)   /**< alert output enable */
+#define SIMULATOR_CONFIG_STATUS              (1U << 4)   /**< alert output asserted */
+#define SIMULATOR_CONFIG_CLEAR               (1U << 5)   /**< interrupt clear */
+#define SIMULATOR_CONFIG_WINDOW_LOCK         (1U << 6)   /**< alarm window lock */
+#define SIMULATOR_CONFIG_CRIT_LOCK           (1U << 7)   /**< critical temperature lock */
+#define SIMULATOR_CONFIG_SHUTDOWN            (1U << 8)   /**< shutdown */
+#define SIMULATOR_CONFIG_WRITE_MASK          0x07CFU     /**< bits held by the config register */
+#define SIMULATOR_CONFIG_LOCKED_MASK         0x060BU     /**< bits frozen by either lock bit */
+#define SIMULATOR_THRESHOLD_MASK             0x1FFCU     /**< bits held by a limit register */
+
+/**
+ * @brief simulator device structure definition
+ */
+typedef struct simulator_device_s
+{
+    uint8_t present;                                                  /**< device acknowledges its address */
+    uint8_t pointer;                                                  /**< register pointer */
+    uint8_t resolution;                                               /**< resolution register */
+    uint8_t state;                                                    /**< comparator state, status flag bits */
+    uint8_t latch;                                                    /**< interrupt mode event */
+    uint8_t level;                                                    /**< alert pin level */
+    uint16_t config;                                                  /**< config register */
+    uint16_t upper;                                                   /**< alert upper register */
+    uint16_t lower;                                                   /**< alert lower register */
+    uint16_t crit;                                                    /**< critical temperature register */
+    uint16_t temperature;                                             /**< temperature register without flags */
+    uint64_t conversion_start;                                        /**< start time of the running conversion */
+    uint64_t waveform_start;                                          /**< start time of the waveform */
+    mcp9808_simulator_point_t point[MCP9808_SIMULATOR_MAX_POINT];     /**< waveform points */
+    uint8_t point_num;                                                /**< waveform point number */
+    uint8_t repeat;                                                   /**< waveform repeat flag */
+    mcp9808_simulator_temperature_t function;                         /**< temperature function */
+} simulator_device_t;
+
+/**
+ * @brief simulator bus structure definition
+ */
+typedef struct simulator_bus_s
+{
+    uint8_t index;                                                    /**< bus index */
+    simulator_device_t device[MCP9808_SIMULATOR_MAX_DEVICE];          /**< devices on the bus */
+} simulator_bus_t;
+
+static simulator_bus_t gs_bus[MCP9808_SIMULATOR_MAX_BUS];        /**< simulated buses */
+static uint64_t gs_time_us;                                      /**< virtual clock */
+static mcp9808_simulator_alert_t gs_alert;                       /**< alert callback */
+static uint8_t gs_alert_busy;                                    /**< alert callback running flag */
+static mcp9808_simulator_counter_t gs_counter;                   /**< bus counter */
+
+/**
+ * @brief conversion time definition
+ */
+static const uint32_t gs_conversion_time_us[4] =
+{
+    30000, 65000, 130000, 250000,
+};
+
+/**
+ * @brief hysteresis definition in 0.0625C
+ */
+static const int16_t gs_hysteresis[4] =
+{
+    0, 24, 48, 96,
+};
+
+/**
+ * @brief     find a device
+ * @param[in] *bus pointer to a bus structure
+ * @param[in] addr iic device write address
+ * @return    pointer to a device, NULL if no device acknowledges
+ * @note      none
+ */
+static simulator_device_t *a_simulator_find(simulator_bus_t *bus, uint8_t addr)
+{
+    uint8_t index;
+    
+    if ((bus == NULL) || ((addr & 0x01) != 0) ||
+        (addr < MCP9808_ADDRESS_A2A1A0_000) || (addr > MCP9808_ADDRESS_A2A1A0_111))
+    {
+        return NULL;
+    }
+    index = (uint8_t)((addr - MCP9808_ADDRESS_A2A1A0_000) >> 1);
+    if (bus->device[index].present == 0)
+    {
+        return NULL;
+    }
+    
+    return &bus->device[index];
+}
+
+/**
+ * @brief     count one transaction
+ * @param[in] byte bytes on the wire
+ * @param[in] condition start, repeated start and stop number
+ * @note      none
+ */
+static void a_simulator_count(uint16_t byte, uint8_t condition)
+{
+    gs_counter.transaction++;
+    gs_counter.byte += byte;
+    gs_counter.clock += (uint32_t)byte * 9 + condition;
+}
+
+/**
+ * @brief     get a device
+ * @param[in] bus bus index
+ * @param[in] addr iic device write address
+ * @return    pointer to a device, NULL if the device is not attached
+ * @note      none
+ */
+static simulator_device_t *a_simulator_get(uint8_t bus, uint8_t addr)
+{
+    if (bus >= MCP9808_SIMULATOR_MAX_BUS)
+    {
+        return NULL;
+    }
+    
+    return a_simulator_find(&gs_bus[bus], addr);
+}
+
+/**
+ * @brief     sign extend a 13 bit temperature code
+ * @param[in] code register value
+ * @return    signed value in 0.0625C
+ * @note      the flag bits are dropped
+ */
+static int16_t a_simulator_signed(uint16_t code)
+{
+    code &= 0x1FFFU;
+    if ((code & 0x1000U) != 0)
+    {
+        code |= 0xE000U;
+    }
+    
+    return (int16_t)code;
+}
+
+/**
+ * @brief     get the simulated temperature
+ * @param[in] *bus pointer to a bus structure
+ * @param[in] *device pointer to a device structure
+ * @param[in] time_us virtual time
+ * @return    temperature in mC
+ * @note      none
+ */
+static int32_t a_simulator_temperature(simulator_bus_t *bus, simulator_device_t *device, uint64_t time_us)
+{
+    uint8_t i;
+    uint64_t t;
+    uint64_t t0;
+    uint64_t t1;
+    uint64_t period;
+    const mcp9808_simulator_point_t *p;
+    
+    if (device->function != NULL)
+    {
+        return device->function(bus->index,
+                                (uint8_t)(MCP9808_ADDRESS_A2A1A0_000 + ((device - bus->device) << 1)),
+                                time_us);
+    }
+    
+    /* position inside the waveform */
+    p = device->point;
+    t = time_us - device->waveform_start;
+    period = (uint64_t)p[device->point_num - 1].time_ms * 1000;
+    if ((device->repeat != 0) && (period != 0))
+    {
+        t %= period;
+    }
+    if (t <= (uint64_t)p[0].time_ms * 1000)
+    {
+        return p[0].temperature_mc;
+    }
+    
+    /* interpolate between two points */
+    for (i = 1; i < device->point_num; i++)
+    {
+        t0 = (uint64_t)p[i - 1].time_ms * 1000;
+        t1 = (uint64_t)p[i].time_ms * 1000;
+        if (t < t1)
+        {
+            return p[i - 1].temperature_mc +
+                   (int32_t)(((int64_t)p[i].temperature_mc - p[i - 1].temperature_mc) *
+                             (int64_t)(t - t0) / (int64_t)(t1 - t0));
+        }
+    }
+    
+    return p[device->point_num - 1].temperature_mc;
+}
+
+/**
+ * @brief     quantize a temperature
+ * @param[in] temperature_mc temperature in mC
+ * @param[in] resolution resolution register value
+ * @return    temperature register code without flags
+ * @note      the code is rounded down to the resolution like the adc
+ */
+static uint16_t a_simulator_quantize(int32_t temperature_mc, uint8_t resolution)
+{
+    int64_t raw;
+    
+    raw = (int64_t)temperature_mc * 16;
+    raw = (raw >= 0) ? (raw / 1000) : -((-raw + 999) / 1000);
+    if (raw > 4095)
+    {
+        raw = 4095;
+    }
+    if (raw < -4096)
+    {
+        raw = -4096;
+    }
+    raw &= ~(int64_t)((1 << (3 - (resolution & 0x03))) - 1);
+    
+    return (uint16_t)((uint16_t)raw & 0x1FFFU);
+}
+
+/**
+ * @brief     update the alert output
+ * @param[in] *bus pointer to a bus structure
+ * @param[in] *device pointer to a device structure
+ * @note      the alert callback runs when the pin level changes
+ */
+static void a_simulator_output(simulator_bus_t *bus, simulator_device_t *device)
+{
+    uint8_t asserted;
+    uint8_t level;
+    
+    /* asserted state of the output */
+    if ((device->config & SIMULATOR_CONFIG_CONTROL) == 0)
+    {
+        asserted = 0;
+    }
+    else if ((device->config & SIMULATOR_CONFIG_SELECT) != 0)
+    {
+        asserted = ((device->state & MCP9808_STATUS_FLAG_CRIT) != 0) ? 1 : 0;
+    }
+    else if ((device->config & SIMULATOR_CONFIG_MODE) != 0)
+    {
+        asserted = ((device->latch != 0) || ((device->state & MCP9808_STATUS_FLAG_CRIT) != 0)) ? 1 : 0;
+    }
+    else
+    {
+        asserted = (device->state != 0) ? 1 : 0;
+    }
+    
+    /* alert status bit follows the output */
+    if (asserted != 0)
+    {
+        device->config |= SIMULATOR_CONFIG_STATUS;
+    }
+    else
+    {
+        device->config &= (uint16_t)(~SIMULATOR_CONFIG_STATUS);
+    }
+    
+    /* pin level */
+    level = ((device->config & SIMULATOR_CONFIG_POLARITY) != 0) ? asserted : (uint8_t)(!asserted);
+    if (level != device->level)
+    {
+        device->level = level;
+        if ((gs_alert != NULL) && (gs_alert_busy == 0))
+        {
+            gs_alert_busy = 1;
+            gs_alert(bus->index, (uint8_t)(MCP9808_ADDRESS_A2A1A0_000 + ((device - bus->device) << 1)), level);
+            gs_alert_busy = 0;
+        }
+    }
+}
+
+/**
+ * @brief     compare the temperature with the limits
+ * @param[in] *bus pointer to a bus structure
+ * @param[in] *device pointer to a device structure
+ * @note      limits are left with hysteresis, upper and lower crossings latch the interrupt
+ */
+static void a_simulator_compare(simulator_bus_t *bus, simulator_device_t *device)
+{
+    int16_t t;
+    int16_t h;
+    uint8_t state;
+    uint8_t changed;
+    
+    t = a_simulator_signed(device->temperature);
+    h = gs_hysteresis[(device->config >> 9) & 0x03];
+    state = device->state;
+    
+    /* critical temperature */
+    if (t >= a_simulator_signed(device->crit))
+    {
+        state |= MCP9808_STATUS_FLAG_CRIT;
+    }
+    else if (t < a_simulator_signed(device->crit) - h)
+    {
+        state &= (uint8_t)(~MCP9808_STATUS_FLAG_CRIT);
+    }
+    else
+    {
+        /* keep the state inside the hysteresis */
+    }
+    
+    /* upper boundary */
+    if (t > a_simulator_signed(device->upper))
+    {
+        state |= MCP9808_STATUS_FLAG_T_UPPER;
+    }
+    else if (t <= a_simulator_signed(device->upper) - h)
+    {
+        state &= (uint8_t)(~MCP9808_STATUS_FLAG_T_UPPER);
+    }
+    else
+    {
+        /* keep the state inside the hysteresis */
+    }
+    
+    /* lower boundary */
+    if (t < a_simulator_signed(device->lower))
+    {
+        state |= MCP9808_STATUS_FLAG_T_LOWER;
+    }
+    else if (t >= a_simulator_signed(device->lower) + h)
+    {
+        state &= (uint8_t)(~MCP9808_STATUS_FLAG_T_LOWER);
+    }
+    else
+    {
+        /* keep the state inside the hysteresis */
+    }
+    
+    /* every window crossing is an interrupt event */
+    changed = (uint8_t)(state ^ device->state);
+    if ((changed & (MCP9808_STATUS_FLAG_T_UPPER | MCP9808_STATUS_FLAG_T_LOWER)) != 0)
+    {
+        device->latch = 1;
+    }
+    device->state = state;
+    a_simulator_output(bus, device);
+}
+
+/**
+ * @brief     run the finished conversions
+ * @param[in] *bus pointer to a bus structure
+ * @param[in] *device pointer to a device structure
+ * @note      nothing is converted in shutdown
+ */
+static void a_simulator_update(simulator_bus_t *bus, simulator_device_t *device)
+{
+    uint64_t end;
+    
+    if ((device->config & SIMULATOR_CONFIG_SHUTDOWN) != 0)
+    {
+        return;
+    }
+    while (1)
+    {
+        end = device->conversion_start + gs_conversion_time_us[device->resolution & 0x03];
+        if (end > gs_time_us)
+        {
+            break;
+        }
+        
+        /* the next conversion starts before the callback can read the result */
+        device->conversion_start = end;
+        device->temperature = a_simulator_quantize(a_simulator_temperature(bus, device, end), device->resolution);
+        a_simulator_compare(bus, device);
+    }
+}
+
+/**
+ * @brief     power on reset one device
+ * @param[in] *device pointer to a device structure
+ * @note      none
+ */
+static void a_simulator_power_on(simulator_device_t *device)
+{
+    memset(device, 0, sizeof(simulator_device_t));
+    device->present = 1;
+    device->resolution = MCP9808_RESOLUTION_0P0625;
+    device->level = 1;
+    device->conversion_start = gs_time_us;
+    device->waveform_start = gs_time_us;
+    device->point[0].time_ms = 0;
+    device->point[0].temperature_mc = MCP9808_SIMULATOR_DEFAULT_MC;
+    device->point_num = 1;
+}
+
+/**
+ * @brief     write the config register
+ * @param[in] *bus pointer to a bus structure
+ * @param[in] *device pointer to a device structure
+ * @param[in] config written value
+ * @note      models the datasheet lock rules
+ */
+static void a_simulator_config_write(simulator_bus_t *bus, simulator_device_t *device, uint16_t config)
+{
+    uint16_t prev;
+    uint16_t clear;
+    
+    prev = device->config;
+    clear = config & SIMULATOR_CONFIG_CLEAR;
+    config &= SIMULATOR_CONFIG_WRITE_MASK;
+    if ((prev & (SIMULATOR_CONFIG_CRIT_LOCK | SIMULATOR_CONFIG_WINDOW_LOCK)) != 0)
+    {
+        /* hysteresis, alert control, polarity and mode are frozen, shutdown can only be cleared */
+        config = (uint16_t)((config & (uint16_t)(~SIMULATOR_CONFIG_LOCKED_MASK)) | (prev & SIMULATOR_CONFIG_LOCKED_MASK));
+        config &= (uint16_t)(prev | (uint16_t)(~SIMULATOR_CONFIG_SHUTDOWN));
+    }
+    if ((prev & SIMULATOR_CONFIG_WINDOW_LOCK) != 0)
+    {
+        /* alert select is frozen by the window lock only */
+        config = (uint16_t)((config & (uint16_t)(~SIMULATOR_CONFIG_SELECT)) | (prev & SIMULATOR_CONFIG_SELECT));
+    }
+    
+    /* lock bits are cleared by a power on reset only */
+    config |= prev & (SIMULATOR_CONFIG_CRIT_LOCK | SIMULATOR_CONFIG_WINDOW_LOCK);
+    
+    /* a wake up starts a new conversion */
+    if (((prev & SIMULATOR_CONFIG_SHUTDOWN) != 0) && ((config & SIMULATOR_CONFIG_SHUTDOWN) == 0))
+    {
+        device->conversion_start = gs_time_us;
+    }
+    device->config = (uint16_t)(config | (prev & SIMULATOR_CONFIG_STATUS));
+    
+    /* the interrupt clear bit always reads back as 0 */
+    if (clear != 0)
+    {
+        device->latch = 0;
+    }
+    a_simulator_output(bus, device);
+}
+
+/**
+ * @brief     write one register
+ * @param[in] *bus pointer to a bus structure
+ * @param[in] *device pointer to a device structure
+ * @param[in] reg register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len data length
+ * @note      a short write only moves the register pointer
+ */
+static void a_simulator_write(simulator_bus_t *bus, simulator_device_t *device, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    uint16_t value;
+    
+    device->pointer = reg;
+    if ((reg == SIMULATOR_REG_RESOLUTION) && (len >= 1))
+    {
+        device->resolution = buf[0] & 0x03;
+        
+        return;
+    }
+    if (len < 2)
+    {
+        return;
+    }
+    value = (uint16_t)((uint16_t)buf[0] << 8) | buf[1];
+    switch (reg)
+    {
+        case SIMULATOR_REG_CONFIG:
+        {
+            a_simulator_config_write(bus, device, value);
+            
+            break;
+        }
+        case SIMULATOR_REG_ALERT_UPPER:
+        {
+            if ((device->config & SIMULATOR_CONFIG_WINDOW_LOCK) == 0)
+            {
+                device->upper = value & SIMULATOR_THRESHOLD_MASK;
+            }
+            
+            break;
+        }
+        case SIMULATOR_REG_ALERT_LOWER:
+        {
+            if ((device->config & SIMULATOR_CONFIG_WINDOW_LOCK) == 0)
+            {
+                device->lower = value & SIMULATOR_THRESHOLD_MASK;
+            }
+            
+            break;
+        }
+        case SIMULATOR_REG_CRIT:
+        {
+            if ((device->config & SIMULATOR_CONFIG_CRIT_LOCK) == 0)
+            {
+                device->crit = value & SIMULATOR_THRESHOLD_MASK;
+            }
+            
+            break;
+        }
+        default:
+        {
+            /* read only or reserved register */
+            
+            break;
+        }
+    }
+}
+
+/**
+ * @brief      read one register
+ * @param[in]  *device pointer to a device structure
+ * @param[in]  reg register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len data length
+ * @note       the register bytes repeat when len is longer than the register
+ */
+static void a_simulator_read(simulator_device_t *device, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    uint16_t i;
+    uint16_t value;
+    uint8_t width;
+    uint8_t data[2];
+    
+    width = 2;
+    switch (reg)
+    {
+        case SIMULATOR_REG_CONFIG:
+        {
+            value = device->config;
+            
+            break;
+        }
+        case SIMULATOR_REG_ALERT_UPPER:
+        {
+            value = device->upper;
+            
+            break;
+        }
+        case SIMULATOR_REG_ALERT_LOWER:
+        {
+            value = device->lower;
+            
+            break;
+        }
+        case SIMULATOR_REG_CRIT:
+        {
+            value = device->crit;
+            
+            break;
+        }
+        case SIMULATOR_REG_TEMPERATURE:
+        {
+            value = (uint16_t)(device->temperature | ((uint16_t)device->state << 13));
+            
+            break;
+        }
+        case SIMULATOR_REG_MANUFACTURER_ID:
+        {
+            value = 0x0054U;
+            
+            break;
+        }
+        case SIMULATOR_REG_DEVICE_ID:
+        {
+            value = 0x0400U;
+            
+            break;
+        }
+        case SIMULATOR_REG_RESOLUTION:
+        {
+            value = device->resolution;
+            width = 1;
+            
+            break;
+        }
+        default:
+        {
+            value = 0x0000U;
+            
+            break;
+        }
+    }
+    if (width == 2)
+    {
+        data[0] = (uint8_t)(value >> 8);
+        data[1] = (uint8_t)(value & 0xFF);
+    }
+    else
+    {
+        data[0] = (uint8_t)value;
+    }
+    for (i = 0; i < len; i++)
+    {
+        buf[i] = data[i % width];
+    }
+}
+
+/**
+ * @brief  simulator power on reset every bus and the virtual clock
+ * @note   all devices are detached and the alert callback is removed
+ */
+void mcp9808_simulator_reset(void)
+{
+    uint8_t i;
+    
+    memset(gs_bus, 0, sizeof(gs_bus));
+    for (i = 0; i < MCP9808_SIMULATOR_MAX_BUS; i++)
+    {
+        gs_bus[i].index = i;
+    }
+    gs_time_us = 0;
+    memset(&gs_counter, 0, sizeof(gs_counter));
+    gs_alert = NULL;
+    gs_alert_busy = 0;
+}
+
+/**
+ * @brief     simulator attach one device
+ * @param[in] bus bus index
+ * @param[in] addr iic device write address
+ * @return    status code
+ *            - 0 success
+ *            - 1 attach failed
+ * @note      the device starts from its power on state at MCP9808_SIMULATOR_DEFAULT_MC
+ */
+uint8_t mcp9808_simulator_attach(uint8_t bus, uint8_t addr)
+{
+    if ((bus >= MCP9808_SIMULATOR_MAX_BUS) || ((addr & 0x01) != 0) ||
+        (addr < MCP9808_ADDRESS_A2A1A0_000) || (addr > MCP9808_ADDRESS_A2A1A0_111))
+    {
+        return 1;
+    }
+    gs_bus[bus].index = bus;
+    a_simulator_power_on(&gs_bus[bus].device[(addr - MCP9808_ADDRESS_A2A1A0_000) >> 1]);
+    
+    return 0;
+}
+
+/**
+ * @brief     simulator detach one device
+ * @param[in] bus bus index
+ * @param[in] addr iic device write address
+ * @return    status code
+ *            - 0 success
+ *            - 1 detach failed
+ * @note      a detached device does not acknowledge its address
+ */
+uint8_t mcp9808_simulator_detach(uint8_t bus, uint8_t addr)
+{
+    simulator_device_t *device;
+    
+    device = a_simulator_get(bus, addr);
+    if (device == NULL)
+    {
+        return 1;
+    }
+    device->present = 0;
+    
+    return 0;
+}
+
+/**
+ * @brief     simulator set a constant temperature
+ * @param[in] bus bus index
+ * @param[in] addr iic device write address
+ * @param[in] temperature_mc temperature in mC
+ * @return    status code
+ *            - 0 success
+ *            - 1 set failed
+ * @note      the temperature register follows at the end of the next conversion
+ */
+uint8_t mcp9808_simulator_set_temperature(uint8_t bus, uint8_t addr, int32_t temperature_mc)
+{
+    mcp9808_simulator_point_t point;
+    
+    point.time_ms = 0;
+    point.temperature_mc = temperature_mc;
+    
+    return mcp9808_simulator_set_waveform(bus, addr, &point, 1, MCP9808_BOOL_FALSE);
+}
+
+/**
+ * @brief     simulator set a piecewise linear waveform
+ * @param[in] bus bus index
+ * @param[in] addr iic device write address
+ * @param[in] *point pointer to a point array sorted by time
+ * @param[in] num point number
+ * @param[in] repeat MCP9808_BOOL_TRUE restarts the waveform after the last point
+ * @return    status code
+ *            - 0 success
+ *            - 1 set failed
+ * @note      the waveform starts at the current virtual time and holds the last point when it does not repeat
+ */
+uint8_t mcp9808_simulator_set_waveform(uint8_t bus, uint8_t addr, const mcp9808_simulator_point_t *point,
+                                       uint8_t num, mcp9808_bool_t repeat)
+{
+    uint8_t i;
+    simulator_device_t *device;
+    
+    device = a_simulator_get(bus, addr);
+    if ((device == NULL) || (point == NULL) || (num == 0) || (num > MCP9808_SIMULATOR_MAX_POINT))
+    {
+        return 1;
+    }
+    for (i = 1; i < num; i++)
+    {
+        if (point[i].time_ms <= point[i - 1].time_ms)
+        {
+            return 1;
+        }
+    }
+    
+    /* finish the conversions of the old waveform */
+    a_simulator_update(&gs_bus[bus], device);
+    memcpy(device->point, point, sizeof(mcp9808_simulator_point_t) * num);
+    device->point_num = num;
+    device->repeat = (repeat == MCP9808_BOOL_TRUE) ? 1 : 0;
+    device->waveform_start = gs_time_us;
+    
+    return 0;
+}
+
+/**
+ * @brief     simulator set a temperature function
+ * @param[in] bus bus index
+ * @param[in] addr iic device write address
+ * @param[in] function temperature function called at the end of every conversion
+ * @return    status code
+ *            - 0 success
+ *            - 1 set failed
+ * @note      the function overrides any waveform, NULL goes back to the waveform
+ */
+uint8_t mcp9808_simulator_set_function(uint8_t bus, uint8_t addr, mcp9808_simulator_temperature_t function)
+{
+    simulator_device_t *device;
+    
+    device = a_simulator_get(bus, addr);
+    if (device == NULL)
+    {
+        return 1;
+    }
+    a_simulator_update(&gs_bus[bus], device);
+    device->function = function;
+    
+    return 0;
+}
+
+/**
+ * @brief     simulator set the alert callback
+ * @param[in] callback callback run on every alert pin level change, it can be NULL
+ * @note      the callback may access the simulator, level changes caused inside it are not reported again
+ */
+void mcp9808_simulator_set_alert_callback(mcp9808_simulator_alert_t callback)
+{
+    gs_alert = callback;
+}
+
+/**
+ * @brief      simulator get the alert pin level
+ * @param[in]  bus bus index
+ * @param[in]  addr iic device write address
+ * @param[out] *level pointer to a level buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       the level includes the output polarity
+ */
+uint8_t mcp9808_simulator_get_alert(uint8_t bus, uint8_t addr, uint8_t *level)
+{
+    simulator_device_t *device;
+    
+    device = a_simulator_get(bus, addr);
+    if (device == NULL)
+    {
+        return 1;
+    }
+    a_simulator_update(&gs_bus[bus], device);
+    *level = device->level;
+    
+    return 0;
+}
+
+/**
+ * @brief     simulator advance the virtual clock
+ * @param[in] us time step
+ * @note      finished conversions update the temperature register and the alert output
+ */
+void mcp9808_simulator_advance_us(uint32_t us)
+{
+    uint8_t i;
+    uint8_t j;
+    uint32_t step;
+    
+    while (us != 0)
+    {
+        /* short steps keep alert callbacks in time order across devices */
+        step = (us > MCP9808_SIMULATOR_STEP_US) ? MCP9808_SIMULATOR_STEP_US : us;
+        us -= step;
+        gs_time_us += step;
+        for (i = 0; i < MCP9808_SIMULATOR_MAX_BUS; i++)
+        {
+            for (j = 0; j < MCP9808_SIMULATOR_MAX_DEVICE; j++)
+            {
+                if (gs_bus[i].device[j].present != 0)
+                {
+                    a_simulator_update(&gs_bus[i], &gs_bus[i].device[j]);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief  simulator get the virtual time
+ * @return time in us
+ * @note   none
+ */
+uint64_t mcp9808_simulator_get_time_us(void)
+{
+    return gs_time_us;
+}
+
+/**
+ * @brief      simulator get the bus counter
+ * @param[out] *counter pointer to a counter structure
+ * @note       the counter covers every bus since the last clear
+ */
+void mcp9808_simulator_get_counter(mcp9808_simulator_counter_t *counter)
+{
+    *counter = gs_counter;
+}
+
+/**
+ * @brief simulator clear the bus counter
+ * @note  none
+ */
+void mcp9808_simulator_clear_counter(void)
+{
+    memset(&gs_counter, 0, sizeof(gs_counter));
+}
+
+/**
+ * @brief     simulator get the bus context
+ * @param[in] bus bus index
+ * @return    pointer to a bus context, NULL if the bus is invalid
+ * @note      the context is used by the ctx link functions
+ */
+void *mcp9808_simulator_get_bus(uint8_t bus)
+{
+    if (bus >= MCP9808_SIMULATOR_MAX_BUS)
+    {
+        return NULL;
+    }
+    gs_bus[bus].index = bus;
+    
+    return &gs_bus[bus];
+}
+
+/**
+ * @brief  simulator iic bus init
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+uint8_t mcp9808_simulator_iic_init(void)
+{
+    return 0;
+}
+
+/**
+ * @brief  simulator iic bus deinit
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+uint8_t mcp9808_simulator_iic_deinit(void)
+{
+    return 0;
+}
+
+/**
+ * @brief     simulator iic bus write
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      bus 0 is used
+ */
+uint8_t mcp9808_simulator_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    return mcp9808_simulator_bus_iic_write(&gs_bus[0], addr, reg, buf, len);
+}
+
+/**
+ * @brief      simulator iic bus read
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       bus 0 is used
+ */
+uint8_t mcp9808_simulator_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    return mcp9808_simulator_bus_iic_read(&gs_bus[0], addr, reg, buf, len);
+}
+
+/**
+ * @brief      simulator iic bus read without the register address
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       bus 0 is used
+ */
+uint8_t mcp9808_simulator_iic_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    return mcp9808_simulator_bus_iic_read_cmd(&gs_bus[0], addr, buf, len);
+}
+
+/**
+ * @brief      simulator iic bus read from many devices
+ * @param[in]  *addr pointer to an iic device write address array
+ * @param[in]  *reg pointer to an iic register address array
+ * @param[out] *buf pointer to a data buffer, len bytes per device
+ * @param[in]  len data length of one device
+ * @param[in]  num device number
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       bus 0 is used
+ */
+uint8_t mcp9808_simulator_iic_read_batch(uint8_t *addr, uint8_t *reg, uint8_t *buf, uint16_t len, uint16_t num)
+{
+    return mcp9808_simulator_bus_iic_read_batch(&gs_bus[0], addr, reg, buf, len, num);
+}
+
+/**
+ * @brief     simulator iic bus context write
+ * @param[in] *bus pointer to a bus context
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+uint8_t mcp9808_simulator_bus_iic_write(void *bus, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    simulator_bus_t *b = (simulator_bus_t *)bus;
+    simulator_device_t *device;
+    
+    device = a_simulator_find(b, addr);
+    if ((device == NULL) || (reg > 0x0F))
+    {
+        /* the address or the register byte is not acknowledged */
+        a_simulator_count((device == NULL) ? 1 : 2, 2);
+        
+        return 1;
+    }
+    a_simulator_count((uint16_t)(2 + len), 2);
+    a_simulator_update(b, device);
+    a_simulator_write(b, device, reg, buf, len);
+    
+    return 0;
+}
+
+/**
+ * @brief      simulator iic bus context read
+ * @param[in]  *bus pointer to a bus context
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t mcp9808_simulator_bus_iic_read(void *bus, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    simulator_bus_t *b = (simulator_bus_t *)bus;
+    simulator_device_t *device;
+    
+    device = a_simulator_find(b, addr);
+    if ((device == NULL) || (reg > 0x0F))
+    {
+        /* the address or the register byte is not acknowledged */
+        a_simulator_count((device == NULL) ? 1 : 2, 2);
+        
+        return 1;
+    }
+    a_simulator_count((uint16_t)(3 + len), 3);
+    a_simulator_update(b, device);
+    device->pointer = reg;
+    a_simulator_read(device, reg, buf, len);
+    
+    return 0;
+}
+
+/**
+ * @brief      simulator iic bus context read without the register address
+ * @param[in]  *bus pointer to a bus context
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t mcp9808_simulator_bus_iic_read_cmd(void *bus, uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    simulator_bus_t *b = (simulator_bus_t *)bus;
+    simulator_device_t *device;
+    
+    device = a_simulator_find(b, addr);
+    if (device == NULL)
+    {
+        /* the address is not acknowledged */
+        a_simulator_count(1, 2);
+        
+        return 1;
+    }
+    a_simulator_count((uint16_t)(1 + len), 2);
+    a_simulator_update(b, device);
+    a_simulator_read(device, device->pointer, buf, len);
+    
+    return 0;
+}
+
+/**
+ * @brief      simulator iic bus context read from many devices
+ * @param[in]  *bus pointer to a bus context
+ * @param[in]  *addr pointer to an iic device write address array
+ * @param[in]  *reg pointer to an iic register address array
+ * @param[out] *buf pointer to a data buffer, len bytes per device
+ * @param[in]  len data length of one device
+ * @param[in]  num device number
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the transfer stops at the first device that does not acknowledge
+ */
+uint8_t mcp9808_simulator_bus_iic_read_batch(void *bus, uint8_t *addr, uint8_t *reg, uint8_t *buf, uint16_t len, uint16_t num)
+{
+    uint16_t i;
+    
+    for (i = 0; i < num; i++)
+    {
+        if (mcp9808_simulator_bus_iic_read(bus, addr[i], reg[i], buf + (uint32_t)i * len, len) != 0)
+        {
+            return 1;
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     simulator delay ms
+ * @param[in] ms time
+ * @note      the virtual clock is advanced without sleeping
+ */
+void mcp9808_simulator_delay_ms(uint32_t ms)
+{
+    while (ms != 0)
+    {
+        mcp9808_simulator_advance_us(1000);
+        ms--;
+    }
+}
+
+/**
+ * @brief  simulator get the monotonic time
+ * @return time in microseconds
+ * @note   low 32 bits of the virtual clock
+ */
+uint32_t mcp9808_simulator_time_us(void)
+{
+    return (uint32_t)gs_time_us;
+}
@@ -0,0 +1,358 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mcp9808_simulator.h
+ * @brief     driver mcp9808 simulator header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-01-25
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/01/25  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_MCP9808_SIMULATOR_H
+#define DRIVER_MCP9808_SIMULATOR_H
+
+#include "driver_mcp9808.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup mcp9808_simulator mcp9808 simulator function
+ * @brief    mcp9808 register accurate simulated device modules
+ * @{
+ */
+
+/**
+ * @brief mcp9808 simulator default definition
+ */
+#define MCP9808_SIMULATOR_MAX_BUS          4             /**< max simulated bus number */
+#define MCP9808_SIMULATOR_MAX_DEVICE       8             /**< max device number of one bus */
+#define MCP9808_SIMULATOR_MAX_POINT        16            /**< max point number of one waveform */
+#define MCP9808_SIMULATOR_DEFAULT_MC       25000         /**< power on temperature in mC */
+#define MCP9808_SIMULATOR_STEP_US          1000          /**< max virtual clock step between two device updates */
+#define MCP9808_SIMULATOR_POLL_US          10            /**< virtual time cost of one interface time query */
+
+/**
+ * @brief mcp9808 simulator waveform point structure definition
+ */
+typedef struct mcp9808_simulator_point_s
+{
+    uint32_t time_ms;              /**< time from the waveform start */
+    int32_t temperature_mc;        /**< temperature at this time */
+} mcp9808_simulator_point_t;
+
+/**
+ * @brief mcp9808 simulator bus counter structure definition
+ */
+typedef struct mcp9808_simulator_counter_s
+{
+    uint32_t transaction;          /**< iic transactions */
+    uint32_t byte;                 /**< bytes on the wire, address and register bytes included */
+    uint32_t clock;                /**< scl clocks, 9 per byte and 1 per start, repeated start or stop */
+} mcp9808_simulator_counter_t;
+
+/**
+ * @brief mcp9808 simulator temperature function type definition
+ */
+typedef int32_t (*mcp9808_simulator_temperature_t)(uint8_t bus, uint8_t addr, uint64_t time_us);
+
+/**
+ * @brief mcp9808 simulator alert callback type definition
+ */
+typedef void (*mcp9808_simulator_alert_t)(uint8_t bus, uint8_t addr, uint8_t level);
+
+/**
+ * @brief  simulator power on reset every bus and the virtual clock
+ * @note   all devices are detached and the alert callback is removed
+ */
+void mcp9808_simulator_reset(void);
+
+/**
+ * @brief     simulator attach one device
+ * @param[in] bus bus index
+ * @param[in] addr iic device write address
+ * @return    status code
+ *            - 0 success
+ *            - 1 attach failed
+ * @note      the device starts from its power on state at MCP9808_SIMULATOR_DEFAULT_MC
+ */
+uint8_t mcp9808_simulator_attach(uint8_t bus, uint8_t addr);
+
+/**
+ * @brief     simulator detach one device
+ * @param[in] bus bus index
+ * @param[in] addr iic device write address
+ * @return    status code
+ *            - 0 success
+ *            - 1 detach failed
+ * @note      a detached device does not acknowledge its address
+ */
+uint8_t mcp9808_simulator_detach(uint8_t bus, uint8_t addr);
+
+/**
+ * @brief     simulator set a constant temperature
+ * @param[in] bus bus index
+ * @param[in] addr iic device write address
+ * @param[in] temperature_mc temperature in mC
+ * @return    status code
+ *            - 0 success
+ *            - 1 set failed
+ * @note      the temperature register follows at the end of the next conversion
+ */
+uint8_t mcp9808_simulator_set_temperature(uint8_t bus, uint8_t addr, int32_t temperature_mc);
+
+/**
+ * @brief     simulator set a piecewise linear waveform
+ * @param[in] bus bus index
+ * @param[in] addr iic device write address
+ * @param[in] *point pointer to a point array sorted by time
+ * @param[in] num point number
+ * @param[in] repeat MCP9808_BOOL_TRUE restarts the waveform after the last point
+ * @return    status code
+ *            - 0 success
+ *            - 1 set failed
+ * @note      the waveform starts at the current virtual time and holds the last point when it does not repeat
+ */
+uint8_t mcp9808_simulator_set_waveform(uint8_t bus, uint8_t addr, const mcp9808_simulator_point_t *point,
+                                       uint8_t num, mcp9808_bool_t repeat);
+
+/**
+ * @brief     simulator set a temperature function
+ * @param[in] bus bus index
+ * @param[in] addr iic device write address
+ * @param[in] function temperature function called at the end of every conversion
+ * @return    status code
+ *            - 0 success
+ *            - 1 set failed
+ * @note      the function overrides any waveform, NULL goes back to the waveform
+ */
+uint8_t mcp9808_simulator_set_function(uint8_t bus, uint8_t addr, mcp9808_simulator_temperature_t function);
+
+/**
+ * @brief     simulator set the alert callback
+ * @param[in] callback callback run on every alert pin level change, it can be NULL
+ * @note      the callback may access the simulator, level changes caused inside it are not reported again
+ */
+void mcp9808_simulator_set_alert_callback(mcp9808_simulator_alert_t callback);
+
+/**
+ * @brief      simulator get the alert pin level
+ * @param[in]  bus bus index
+ * @param[in]  addr iic device write address
+ * @param[out] *level pointer to a level buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       the level includes the output polarity
+ */
+uint8_t mcp9808_simulator_get_alert(uint8_t bus, uint8_t addr, uint8_t *level);
+
+/**
+ * @brief     simulator advance the virtual clock
+ * @param[in] us time step
+ * @note      finished conversions update the temperature register and the alert output
+ */
+void mcp9808_simulator_advance_us(uint32_t us);
+
+/**
+ * @brief  simulator get the virtual time
+ * @return time in us
+ * @note   none
+ */
+uint64_t mcp9808_simulator_get_time_us(void);
+
+/**
+ * @brief      simulator get the bus counter
+ * @param[out] *counter pointer to a counter structure
+ * @note       the counter covers every bus since the last clear
+ */
+void mcp9808_simulator_get_counter(mcp9808_simulator_counter_t *counter);
+
+/**
+ * @brief simulator clear the bus counter
+ * @note  none
+ */
+void mcp9808_simulator_clear_counter(void);
+
+/**
+ * @brief     simulator get the bus context
+ * @param[in] bus bus index
+ * @return    pointer to a bus context, NULL if the bus is invalid
+ * @note      the context is used by the ctx link functions
+ */
+void *mcp9808_simulator_get_bus(uint8_t bus);
+
+/**
+ * @brief  simulator iic bus init
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+uint8_t mcp9808_simulator_iic_init(void);
+
+/**
+ * @brief  simulator iic bus deinit
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+uint8_t mcp9808_simulator_iic_deinit(void);
+
+/**
+ * @brief     simulator iic bus write
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      bus 0 is used
+ */
+uint8_t mcp9808_simulator_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief      simulator iic bus read
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       bus 0 is used
+ */
+uint8_t mcp9808_simulator_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief      simulator iic bus read without the register address
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       bus 0 is used
+ */
+uint8_t mcp9808_simulator_iic_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief      simulator iic bus read from many devices
+ * @param[in]  *addr pointer to an iic device write address array
+ * @param[in]  *reg pointer to an iic register address array
+ * @param[out] *buf pointer to a data buffer, len bytes per device
+ * @param[in]  len data length of one device
+ * @param[in]  num device number
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       bus 0 is used
+ */
+uint8_t mcp9808_simulator_iic_read_batch(uint8_t *addr, uint8_t *reg, uint8_t *buf, uint16_t len, uint16_t num);
+
+/**
+ * @brief     simulator iic bus context write
+ * @param[in] *bus pointer to a bus context
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+uint8_t mcp9808_simulator_bus_iic_write(void *bus, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief      simulator iic bus context read
+ * @param[in]  *bus pointer to a bus context
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t mcp9808_simulator_bus_iic_read(void *bus, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief      simulator iic bus context read without the register address
+ * @param[in]  *bus pointer to a bus context
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t mcp9808_simulator_bus_iic_read_cmd(void *bus, uint8_t addr, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief      simulator iic bus context read from many devices
+ * @param[in]  *bus pointer to a bus context
+ * @param[in]  *addr pointer to an iic device write address array
+ * @param[in]  *reg pointer to an iic register address array
+ * @param[out] *buf pointer to a data buffer, len bytes per device
+ * @param[in]  len data length of one device
+ * @param[in]  num device number
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the transfer stops at the first device that does not acknowledge
+ */
+uint8_t mcp9808_simulator_bus_iic_read_batch(void *bus, uint8_t *addr, uint8_t *reg, uint8_t *buf, uint16_t len, uint16_t num);
+
+/**
+ * @brief     simulator delay ms
+ * @param[in] ms time
+ * @note      the virtual clock is advanced without sleeping
+ */
+void mcp9808_simulator_delay_ms(uint32_t ms);
+
+/**
+ * @brief  simulator get the monotonic time
+ * @return time in microseconds
+ * @note   low 32 bits of the virtual clock
+ */
+uint32_t mcp9808_simulator_time_us(void);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,387 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mcp9808_stats_test.c
+ * @brief     driver mcp9808 stats test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-01-25
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/01/25  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_mcp9808_stats_test.h"
+#include "driver_mcp9808_fault.h"
+#include "driver_mcp9808_simulator.h"
+
+#if (MCP9808_USE_STATS == 1)
+static mcp9808_handle_t gs_handle[2];        /**< mcp9808 handles on one simulated bus */
+static uint32_t gs_callback;                 /**< callbacks seen by the test */
+static const char *const gs_name[4] =
+{
+    "read", "write", "batch", "irq",
+};                                           /**< operation names */
+
+/**
+ * @brief     stats receive callback
+ * @param[in] type interrupt type
+ * @note      none
+ */
+static void a_stats_test_receive_callback(uint8_t type)
+{
+    (void)type;
+    gs_callback++;
+}
+
+/**
+ * @brief     stats test silent print
+ * @param[in] fmt format data
+ * @note      the driver reports every injected failure
+ */
+static void a_stats_test_debug_print(const char *const fmt, ...)
+{
+    (void)fmt;
+}
+
+/**
+ * @brief  stats test time
+ * @return time in us
+ * @note   virtual time plus the bus time at 400kHz, so every transaction takes as long as on the wire
+ */
+static uint32_t a_stats_test_time_us(void)
+{
+    mcp9808_simulator_counter_t counter;
+    
+    mcp9808_simulator_get_counter(&counter);
+    
+    return mcp9808_simulator_time_us() + (uint32_t)(((uint64_t)counter.clock * 5) / 2);
+}
+
+/**
+ * @brief     stats test percentile upper bound
+ * @param[in] *histogram pointer to a histogram
+ * @param[in] percent percentile
+ * @return    upper bound of the bucket holding the percentile in us
+ * @note      the last bucket returns its lower bound
+ */
+static uint32_t a_stats_test_percentile(const uint32_t *histogram, uint32_t percent)
+{
+    uint32_t i;
+    uint32_t total;
+    uint32_t sum;
+    
+    total = 0;
+    for (i = 0; i < MCP9808_STATS_BUCKET; i++)
+    {
+        total += histogram[i];
+    }
+    sum = 0;
+    for (i = 0; i < MCP9808_STATS_BUCKET - 1; i++)
+    {
+        sum += histogram[i];
+        if ((uint64_t)sum * 100 >= (uint64_t)total * percent)
+        {
+            break;
+        }
+    }
+    
+    return (i == MCP9808_STATS_BUCKET - 1) ? (1UL << (i - 1)) : (1UL << i);
+}
+
+/**
+ * @brief     stats test print and check the histograms
+ * @param[in] index handle index
+ * @param[in] *stats pointer to a stats structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 check failed
+ * @note      every counted operation must be timed once
+ */
+static uint8_t a_stats_test_histogram(uint8_t index, const mcp9808_stats_t *stats)
+{
+    uint32_t i;
+    uint32_t j;
+    uint32_t total;
+    const uint32_t count[4] = {stats->read, stats->write, stats->batch, stats->irq};
+    
+    for (i = 0; i < 4; i++)
+    {
+        total = 0;
+        for (j = 0; j < MCP9808_STATS_BUCKET; j++)
+        {
+            total += stats->histogram[i][j];
+        }
+        if (total != count[i])
+        {
+            mcp9808_interface_debug_print("mcp9808: handle %d %s histogram holds %d of %d.\n",
+                                          index, gs_name[i], total, count[i]);
+            
+            return 1;
+        }
+        if (total != 0)
+        {
+            mcp9808_interface_debug_print("mcp9808: handle %d %s p50 <= %dus p99 <= %dus max %dus.\n", index, gs_name[i],
+                                          a_stats_test_percentile(stats->histogram[i], 50),
+                                          a_stats_test_percentile(stats->histogram[i], 99),
+                                          stats->max_us[i]);
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  stats test set up two devices on a fresh simulator
+ * @return status code
+ *         - 0 success
+ *         - 1 set up failed
+ * @note   the first device alerts above 30C
+ */
+static uint8_t a_stats_test_setup(void)
+{
+    uint8_t i;
+    
+    mcp9808_simulator_reset();
+    for (i = 0; i < 2; i++)
+    {
+        (void)mcp9808_simulator_attach(0, (uint8_t)(MCP9808_ADDRESS_A2A1A0_000 + (i << 1)));
+        (void)mcp9808_simulator_set_temperature(0, (uint8_t)(MCP9808_ADDRESS_A2A1A0_000 + (i << 1)), 25500);
+        
+        /* link the simulator */
+        DRIVER_MCP9808_LINK_INIT(&gs_handle[i], mcp9808_handle_t);
+        DRIVER_MCP9808_LINK_IIC_INIT(&gs_handle[i], mcp9808_simulator_iic_init);
+        DRIVER_MCP9808_LINK_IIC_DEINIT(&gs_handle[i], mcp9808_simulator_iic_deinit);
+        DRIVER_MCP9808_LINK_IIC_READ(&gs_handle[i], mcp9808_simulator_iic_read);
+        DRIVER_MCP9808_LINK_IIC_READ_CMD(&gs_handle[i], mcp9808_simulator_iic_read_cmd);
+        DRIVER_MCP9808_LINK_IIC_READ_BATCH(&gs_handle[i], mcp9808_simulator_iic_read_batch);
+        DRIVER_MCP9808_LINK_IIC_WRITE(&gs_handle[i], mcp9808_simulator_iic_write);
+        DRIVER_MCP9808_LINK_DELAY_MS(&gs_handle[i], mcp9808_simulator_delay_ms);
+        DRIVER_MCP9808_LINK_GET_TIME_US(&gs_handle[i], mcp9808_simulator_time_us);
+        DRIVER_MCP9808_LINK_STATS_TIME_US(&gs_handle[i], a_stats_test_time_us);
+        DRIVER_MCP9808_LINK_DEBUG_PRINT(&gs_handle[i], a_stats_test_debug_print);
+        DRIVER_MCP9808_LINK_RECEIVE_CALLBACK(&gs_handle[i], a_stats_test_receive_callback);
+        if ((mcp9808_set_addr(&gs_handle[i], (mcp9808_address_t)(MCP9808_ADDRESS_A2A1A0_000 + (i << 1))) != 0) ||
+            (mcp9808_init(&gs_handle[i]) != 0))
+        {
+            return 1;
+        }
+    }
+    
+    /* alert on the first device so irq handling fires callbacks */
+    if ((mcp9808_set_temperature_high_threshold(&gs_handle[0], 0x01E0) != 0) ||
+        (mcp9808_set_temperature_low_threshold(&gs_handle[0], 0x0140) != 0) ||
+        (mcp9808_set_critical_temperature(&gs_handle[0], 0x0280) != 0) ||
+        (mcp9808_set_alert_output_mode(&gs_handle[0], MCP9808_ALERT_OUTPUT_MODE_INTERRUPT) != 0) ||
+        (mcp9808_set_alert_output(&gs_handle[0], MCP9808_BOOL_TRUE) != 0))
+    {
+        return 1;
+    }
+    mcp9808_simulator_delay_ms(300);
+    
+    return 0;
+}
+
+/**
+ * @brief     stats test run the workload
+ * @param[in] times rounds
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      every round reads, batch reads, writes and handles one irq on a crossed threshold
+ */
+static uint8_t a_stats_test_run(uint32_t times)
+{
+    uint32_t i;
+    int16_t raw[2];
+    int32_t temperature_mc;
+    mcp9808_handle_t *batch[2];
+    
+    batch[0] = &gs_handle[0];
+    batch[1] = &gs_handle[1];
+    for (i = 0; i < times; i++)
+    {
+        (void)mcp9808_simulator_set_temperature(0, MCP9808_ADDRESS_A2A1A0_000, ((i % 2) != 0) ? 25500 : 35000);
+        mcp9808_simulator_delay_ms(300);
+        if ((mcp9808_read_milli_c(&gs_handle[0], &raw[0], &temperature_mc) != 0) ||
+            (mcp9808_read_batch(batch, 2, raw) != 0) ||
+            (mcp9808_set_shutdown(&gs_handle[1], MCP9808_BOOL_FALSE) != 0) ||
+            (mcp9808_irq_handler(&gs_handle[0]) != 0))
+        {
+            return 1;
+        }
+    }
+    
+    return 0;
+}
+#endif
+
+/**
+ * @brief     stats test
+ * @param[in] times rounds of reads, batch reads, writes and irqs
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      runs on the host against the simulator, no hardware is needed,
+ *            latency is virtual bus time at 400kHz, the counters must match the simulator and the fault shim,
+ *            the test is skipped and passes when MCP9808_USE_STATS is 0
+ */
+uint8_t mcp9808_stats_test(uint32_t times)
+{
+#if (MCP9808_USE_STATS == 1)
+    uint8_t res;
+    uint32_t i;
+    uint32_t failure;
+    int16_t raw;
+    int32_t temperature_mc;
+    mcp9808_stats_t stats[2];
+    mcp9808_simulator_counter_t start;
+    mcp9808_simulator_counter_t stop;
+    mcp9808_fault_config_t config;
+    mcp9808_fault_counter_t fault;
+    
+    /* start stats test */
+    mcp9808_interface_debug_print("mcp9808: start stats test.\n");
+    
+    /* clean workload */
+    mcp9808_interface_debug_print("mcp9808: clean bus.\n");
+    if (a_stats_test_setup() != 0)
+    {
+        mcp9808_interface_debug_print("mcp9808: set up failed.\n");
+        mcp9808_simulator_reset();
+        
+        return 1;
+    }
+    (void)mcp9808_reset_stats(&gs_handle[0]);
+    (void)mcp9808_reset_stats(&gs_handle[1]);
+    gs_callback = 0;
+    mcp9808_simulator_get_counter(&start);
+    res = a_stats_test_run(times);
+    mcp9808_simulator_get_counter(&stop);
+    (void)mcp9808_get_stats(&gs_handle[0], &stats[0]);
+    (void)mcp9808_get_stats(&gs_handle[1], &stats[1]);
+    if (res != 0)
+    {
+        mcp9808_interface_debug_print("mcp9808: run failed.\n");
+        mcp9808_simulator_reset();
+        
+        return 1;
+    }
+    mcp9808_interface_debug_print("mcp9808: read %d write %d batch %d read byte %d write byte %d irq %d callback %d.\n",
+                                  stats[0].read + stats[1].read, stats[0].write + stats[1].write,
+                                  stats[0].batch + stats[1].batch, stats[0].read_byte + stats[1].read_byte,
+                                  stats[0].write_byte + stats[1].write_byte, stats[0].irq, stats[0].callback);
+    
+    /* the counters must match the bus and the callbacks */
+    if ((stats[0].read + stats[1].read + stats[0].write + stats[1].write + (stats[0].batch * 2) !=
+         stop.transaction - start.transaction) ||
+        (stats[0].batch != times) || (stats[1].batch != 0) ||
+        (stats[0].irq != times) || (stats[1].irq != 0) ||
+        (stats[0].callback != gs_callback) || (gs_callback == 0))
+    {
+        mcp9808_interface_debug_print("mcp9808: check counter error.\n");
+        mcp9808_simulator_reset();
+        
+        return 1;
+    }
+    for (i = 0; i < 8; i++)
+    {
+        if ((stats[0].failure[i] != 0) || (stats[1].failure[i] != 0))
+        {
+            mcp9808_interface_debug_print("mcp9808: check failure error.\n");
+            mcp9808_simulator_reset();
+            
+            return 1;
+        }
+    }
+    if ((a_stats_test_histogram(0, &stats[0]) != 0) || (a_stats_test_histogram(1, &stats[1]) != 0))
+    {
+        mcp9808_simulator_reset();
+        
+        return 1;
+    }
+    
+    /* faulty workload */
+    mcp9808_interface_debug_print("mcp9808: 5 percent nak bus.\n");
+    (void)mcp9808_reset_stats(&gs_handle[0]);
+    if (mcp9808_fault_attach(&gs_handle[0]) != 0)
+    {
+        mcp9808_interface_debug_print("mcp9808: fault attach failed.\n");
+        mcp9808_simulator_reset();
+        
+        return 1;
+    }
+    config.nak_ppm = 50000;
+    config.stuck_ppm = 0;
+    config.stuck_us = 0;
+    config.corrupt_ppm = 0;
+    config.seed = 1;
+    mcp9808_fault_set_config(&config);
+    for (i = 0; i < times; i++)
+    {
+        (void)mcp9808_read_milli_c(&gs_handle[0], &raw, &temperature_mc);
+    }
+    mcp9808_fault_get_counter(&fault);
+    (void)mcp9808_fault_detach(&gs_handle[0]);
+    (void)mcp9808_get_stats(&gs_handle[0], &stats[0]);
+    failure = 0;
+    for (i = 0; i < 8; i++)
+    {
+        failure += stats[0].failure[i];
+    }
+    mcp9808_interface_debug_print("mcp9808: read %d failure %d nak %d.\n", stats[0].read, failure, fault.nak);
+    if ((stats[0].read != fault.transaction) || (stats[0].failure[1] != fault.nak) || (failure != fault.nak))
+    {
+        mcp9808_interface_debug_print("mcp9808: check failure error.\n");
+        mcp9808_simulator_reset();
+        
+        return 1;
+    }
+    
+    /* reset */
+    (void)mcp9808_reset_stats(&gs_handle[0]);
+    (void)mcp9808_get_stats(&gs_handle[0], &stats[0]);
+    if ((stats[0].read != 0) || (stats[0].max_us[MCP9808_STATS_OPERATION_READ] != 0) ||
+        (stats[0].histogram[MCP9808_STATS_OPERATION_READ][0] != 0))
+    {
+        mcp9808_interface_debug_print("mcp9808: check reset error.\n");
+        mcp9808_simulator_reset();
+        
+        return 1;
+    }
+    mcp9808_simulator_reset();
+    
+    /* finish stats test */
+    mcp9808_interface_debug_print("mcp9808: finish stats test.\n");
+    
+    return 0;
+#else
+    (void)times;
+    mcp9808_interface_debug_print("mcp9808: stats are disabled, skip stats test.\n");
+    
+    return 0;
+#endif
+}
@@ -0,0 +1,667 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mcp9808_trace.c
+ * @brief     driver mcp9808 trace source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-01-25
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/01/25  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_mcp9808_trace.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+/**
+ * @brief trace header flag definition
+ */
+#define TRACE_FLAG_BATCH        (1 << 0)        /**< iic_read_batch was linked while recording */
+
+static FILE *gs_record_file;                                                                        /**< record file */
+static uint32_t gs_record_count;                                                                    /**< record number */
+static uint32_t gs_record_start_us;                                                                 /**< time of the recording start */
+static uint8_t gs_record_flags;                                                                     /**< header flags */
+static uint8_t gs_record_error;                                                                     /**< file write error flag */
+static uint8_t (*gs_record_iic_write)(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);       /**< real iic_write */
+static uint8_t (*gs_record_iic_read)(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);        /**< real iic_read */
+static uint8_t (*gs_record_iic_read_cmd)(uint8_t addr, uint8_t *buf, uint16_t len);                 /**< real iic_read_cmd */
+static uint8_t (*gs_record_iic_read_batch)(uint8_t *addr, uint8_t *reg, uint8_t *buf,
+                                           uint16_t len, uint16_t num);                             /**< real iic_read_batch */
+static uint32_t (*gs_record_get_time_us)(void);                                                     /**< real get_time_us */
+static uint8_t *gs_replay_buf;                                                                      /**< loaded trace */
+static uint32_t gs_replay_size;                                                                     /**< loaded trace size */
+static uint32_t gs_replay_pos;                                                                      /**< next record offset */
+static uint8_t gs_replay_flags;                                                                     /**< header flags */
+static mcp9808_trace_info_t gs_replay_info;                                                         /**< loaded trace info */
+static mcp9808_trace_status_t gs_replay_status;                                                     /**< replay status */
+
+/**
+ * @brief     trace put a little endian 16 bit value
+ * @param[in] *buf pointer to a buffer
+ * @param[in] value put value
+ * @note      none
+ */
+static void a_trace_put16(uint8_t *buf, uint16_t value)
+{
+    buf[0] = (uint8_t)(value & 0xFF);
+    buf[1] = (uint8_t)(value >> 8);
+}
+
+/**
+ * @brief     trace put a little endian 32 bit value
+ * @param[in] *buf pointer to a buffer
+ * @param[in] value put value
+ * @note      none
+ */
+static void a_trace_put32(uint8_t *buf, uint32_t value)
+{
+    a_trace_put16(buf, (uint16_t)(value & 0xFFFF));
+    a_trace_put16(buf + 2, (uint16_t)(value >> 16));
+}
+
+/**
+ * @brief     trace get a little endian 16 bit value
+ * @param[in] *buf pointer to a buffer
+ * @return    got value
+ * @note      none
+ */
+static uint16_t a_trace_get16(const uint8_t *buf)
+{
+    return (uint16_t)((uint16_t)buf[0] | ((uint16_t)buf[1] << 8));
+}
+
+/**
+ * @brief     trace get a little endian 32 bit value
+ * @param[in] *buf pointer to a buffer
+ * @return    got value
+ * @note      none
+ */
+static uint32_t a_trace_get32(const uint8_t *buf)
+{
+    return (uint32_t)a_trace_get16(buf) | ((uint32_t)a_trace_get16(buf + 2) << 16);
+}
+
+/**
+ * @brief     trace write the file header
+ * @param[in] *fp pointer to a file
+ * @param[in] tag user tag
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+static uint8_t a_trace_write_header(FILE *fp, uint32_t tag)
+{
+    uint8_t header[MCP9808_TRACE_HEADER_SIZE];
+    
+    memset(header, 0, sizeof(header));
+    memcpy(header, "M9TR", 4);
+    header[4] = MCP9808_TRACE_VERSION;
+    header[5] = gs_record_flags;
+    a_trace_put32(&header[8], gs_record_count);
+    a_trace_put32(&header[12], tag);
+    if (fwrite(header, 1, sizeof(header), fp) != sizeof(header))
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     trace append one record
+ * @param[in] type record type
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] res transaction result
+ * @param[in] *buf pointer to a payload buffer
+ * @param[in] len payload length
+ * @note      a write error is kept and reported when the recording stops
+ */
+static void a_trace_append(mcp9808_trace_type_t type, uint8_t addr, uint8_t reg, uint8_t res,
+                           const uint8_t *buf, uint16_t len)
+{
+    uint8_t head[MCP9808_TRACE_RECORD_SIZE];
+    uint32_t time_us;
+    
+    time_us = (gs_record_get_time_us != NULL) ? (gs_record_get_time_us() - gs_record_start_us) : 0;
+    head[0] = (uint8_t)type;
+    head[1] = addr;
+    head[2] = reg;
+    head[3] = res;
+    a_trace_put32(&head[4], time_us);
+    a_trace_put16(&head[8], len);
+    if ((fwrite(head, 1, sizeof(head), gs_record_file) != sizeof(head)) ||
+        ((len != 0) && (fwrite(buf, 1, len, gs_record_file) != len)))
+    {
+        gs_record_error = 1;
+    }
+    gs_record_count++;
+}
+
+/**
+ * @brief     trace record iic_write
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code of the real iic_write
+ * @note      none
+ */
+static uint8_t a_trace_record_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    uint8_t res;
+    
+    res = gs_record_iic_write(addr, reg, buf, len);
+    a_trace_append(MCP9808_TRACE_TYPE_WRITE, addr, reg, res, buf, len);
+    
+    return res;
+}
+
+/**
+ * @brief      trace record iic_read
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code of the real iic_read
+ * @note       none
+ */
+static uint8_t a_trace_record_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    uint8_t res;
+    
+    res = gs_record_iic_read(addr, reg, buf, len);
+    a_trace_append(MCP9808_TRACE_TYPE_READ, addr, reg, res, buf, len);
+    
+    return res;
+}
+
+/**
+ * @brief      trace record iic_read_cmd
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code of the real iic_read_cmd
+ * @note       none
+ */
+static uint8_t a_trace_record_iic_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    uint8_t res;
+    
+    res = gs_record_iic_read_cmd(addr, buf, len);
+    a_trace_append(MCP9808_TRACE_TYPE_READ_CMD, addr, 0xFF, res, buf, len);
+    
+    return res;
+}
+
+/**
+ * @brief      trace record iic_read_batch
+ * @param[in]  *addr pointer to an iic device write address list
+ * @param[in]  *reg pointer to an iic register address list
+ * @param[out] *buf pointer to a data buffer, len bytes per device
+ * @param[in]  len data length of one device
+ * @param[in]  num device number
+ * @return     status code of the real iic_read_batch
+ * @note       every device is recorded as one read with the batch result
+ */
+static uint8_t a_trace_record_iic_read_batch(uint8_t *addr, uint8_t *reg, uint8_t *buf, uint16_t len, uint16_t num)
+{
+    uint8_t res;
+    uint16_t i;
+    
+    res = gs_record_iic_read_batch(addr, reg, buf, len, num);
+    for (i = 0; i < num; i++)
+    {
+        a_trace_append(MCP9808_TRACE_TYPE_READ, addr[i], reg[i], res, &buf[(uint32_t)i * len], len);
+    }
+    
+    return res;
+}
+
+/**
+ * @brief      trace play the next record
+ * @param[in]  type expected record type
+ * @param[in]  addr expected iic device write address
+ * @param[in]  reg expected iic register address
+ * @param[in]  len expected payload length
+ * @param[out] **payload pointer to a payload pointer
+ * @return     recorded result or 1 when the driver left the trace
+ * @note       after the first mismatch every call fails
+ */
+static uint8_t a_trace_play(mcp9808_trace_type_t type, uint8_t addr, uint8_t reg, uint16_t len, const uint8_t **payload)
+{
+    const uint8_t *head;
+    
+    if ((gs_replay_status.mismatch != 0) || (gs_replay_buf == NULL))
+    {
+        return 1;
+    }
+    head = &gs_replay_buf[gs_replay_pos];
+    if ((gs_replay_pos >= gs_replay_size) || (head[0] != (uint8_t)type) ||
+        (head[1] != addr) || (head[2] != reg) || (a_trace_get16(&head[8]) != len))
+    {
+        gs_replay_status.mismatch = gs_replay_status.played + 1;
+        
+        return 1;
+    }
+    *payload = head + MCP9808_TRACE_RECORD_SIZE;
+    gs_replay_pos += MCP9808_TRACE_RECORD_SIZE + len;
+    gs_replay_status.played++;
+    
+    return head[3];
+}
+
+/**
+ * @brief  trace replay iic_init
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+static uint8_t a_trace_replay_iic_init(void)
+{
+    return 0;
+}
+
+/**
+ * @brief  trace replay iic_deinit
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+static uint8_t a_trace_replay_iic_deinit(void)
+{
+    return 0;
+}
+
+/**
+ * @brief     trace replay iic_write
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    recorded result or 1 when the written data differs
+ * @note      none
+ */
+static uint8_t a_trace_replay_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    uint8_t res;
+    const uint8_t *payload;
+    
+    res = a_trace_play(MCP9808_TRACE_TYPE_WRITE, addr, reg, len, &payload);
+    if ((gs_replay_status.mismatch == 0) && (len != 0) && (memcmp(payload, buf, len) != 0))
+    {
+        gs_replay_status.mismatch = gs_replay_status.played;
+        
+        return 1;
+    }
+    
+    return res;
+}
+
+/**
+ * @brief      trace replay iic_read
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     recorded result or 1 when the driver left the trace
+ * @note       none
+ */
+static uint8_t a_trace_replay_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    uint8_t res;
+    const uint8_t *payload;
+    
+    res = a_trace_play(MCP9808_TRACE_TYPE_READ, addr, reg, len, &payload);
+    if (gs_replay_status.mismatch == 0)
+    {
+        memcpy(buf, payload, len);
+    }
+    
+    return res;
+}
+
+/**
+ * @brief      trace replay iic_read_cmd
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     recorded result or 1 when the driver left the trace
+ * @note       none
+ */
+static uint8_t a_trace_replay_iic_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    uint8_t res;
+    const uint8_t *payload;
+    
+    res = a_trace_play(MCP9808_TRACE_TYPE_READ_CMD, addr, 0xFF, len, &payload);
+    if (gs_replay_status.mismatch == 0)
+    {
+        memcpy(buf, payload, len);
+    }
+    
+    return res;
+}
+
+/**
+ * @brief      trace replay iic_read_batch
+ * @param[in]  *addr pointer to an iic device write address list
+ * @param[in]  *reg pointer to an iic register address list
+ * @param[out] *buf pointer to a data buffer, len bytes per device
+ * @param[in]  len data length of one device
+ * @param[in]  num device number
+ * @return     recorded result or 1 when the driver left the trace
+ * @note       none
+ */
+static uint8_t a_trace_replay_iic_read_batch(uint8_t *addr, uint8_t *reg, uint8_t *buf, uint16_t len, uint16_t num)
+{
+    uint8_t res;
+    uint16_t i;
+    
+    res = 0;
+    for (i = 0; i < num; i++)
+    {
+        res = a_trace_replay_iic_read(addr[i], reg[i], &buf[(uint32_t)i * len], len);
+    }
+    
+    return res;
+}
+
+/**
+ * @brief     trace replay delay_ms
+ * @param[in] ms time
+ * @note      none
+ */
+static void a_trace_replay_delay_ms(uint32_t ms)
+{
+    (void)ms;
+}
+
+/**
+ * @brief  trace replay get_time_us
+ * @return recorded time of the next record
+ * @note   none
+ */
+static uint32_t a_trace_replay_get_time_us(void)
+{
+    if ((gs_replay_buf == NULL) || (gs_replay_pos >= gs_replay_size))
+    {
+        return gs_replay_info.duration_us;
+    }
+    
+    return a_trace_get32(&gs_replay_buf[gs_replay_pos + 4]);
+}
+
+/**
+ * @brief     trace start recording a handle
+ * @param[in] *handle pointer to a mcp9808 handle structure
+ * @param[in] *path pointer to a trace file path
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ * @note      the iic_write, iic_read, iic_read_cmd and iic_read_batch links of the handle are wrapped,
+ *            every wrapped call still reaches the real bus and is appended to the trace,
+ *            a batch read is recorded as one read per device,
+ *            only one handle can be recorded at a time and the ctx links are not supported
+ */
+uint8_t mcp9808_trace_record_start(mcp9808_handle_t *handle, const char *path)
+{
+    if ((handle == NULL) || (path == NULL) || (gs_record_file != NULL) ||
+        (handle->iic_write == NULL) || (handle->iic_read == NULL) || (handle->iic_read_cmd == NULL))
+    {
+        return 1;
+    }
+    if ((handle->iic_write_ctx != NULL) || (handle->iic_read_ctx != NULL) ||
+        (handle->iic_read_cmd_ctx != NULL) || (handle->iic_read_batch_ctx != NULL))
+    {
+        return 1;
+    }
+    gs_record_file = fopen(path, "wb");
+    if (gs_record_file == NULL)
+    {
+        return 1;
+    }
+    
+    /* the header is rewritten with the record number when the recording stops */
+    gs_record_count = 0;
+    gs_record_error = 0;
+    gs_record_flags = (handle->iic_read_batch != NULL) ? TRACE_FLAG_BATCH : 0;
+    if (a_trace_write_header(gs_record_file, 0) != 0)
+    {
+        (void)fclose(gs_record_file);
+        gs_record_file = NULL;
+        
+        return 1;
+    }
+    
+    /* wrap the links */
+    gs_record_iic_write = handle->iic_write;
+    gs_record_iic_read = handle->iic_read;
+    gs_record_iic_read_cmd = handle->iic_read_cmd;
+    gs_record_iic_read_batch = handle->iic_read_batch;
+    gs_record_get_time_us = handle->get_time_us;
+    gs_record_start_us = (gs_record_get_time_us != NULL) ? gs_record_get_time_us() : 0;
+    DRIVER_MCP9808_LINK_IIC_WRITE(handle, a_trace_record_iic_write);
+    DRIVER_MCP9808_LINK_IIC_READ(handle, a_trace_record_iic_read);
+    DRIVER_MCP9808_LINK_IIC_READ_CMD(handle, a_trace_record_iic_read_cmd);
+    if (gs_record_iic_read_batch != NULL)
+    {
+        DRIVER_MCP9808_LINK_IIC_READ_BATCH(handle, a_trace_record_iic_read_batch);
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     trace stop recording
+ * @param[in] *handle pointer to a mcp9808 handle structure
+ * @param[in] tag user tag saved in the header
+ * @return    status code
+ *            - 0 success
+ *            - 1 stop failed
+ * @note      the original links of the handle are restored
+ */
+uint8_t mcp9808_trace_record_stop(mcp9808_handle_t *handle, uint32_t tag)
+{
+    uint8_t res;
+    
+    if ((handle == NULL) || (gs_record_file == NULL))
+    {
+        return 1;
+    }
+    
+    /* restore the links */
+    DRIVER_MCP9808_LINK_IIC_WRITE(handle, gs_record_iic_write);
+    DRIVER_MCP9808_LINK_IIC_READ(handle, gs_record_iic_read);
+    DRIVER_MCP9808_LINK_IIC_READ_CMD(handle, gs_record_iic_read_cmd);
+    DRIVER_MCP9808_LINK_IIC_READ_BATCH(handle, gs_record_iic_read_batch);
+    
+    /* finish the header */
+    res = gs_record_error;
+    if ((fseek(gs_record_file, 0, SEEK_SET) != 0) || (a_trace_write_header(gs_record_file, tag) != 0))
+    {
+        res = 1;
+    }
+    if (fclose(gs_record_file) != 0)
+    {
+        res = 1;
+    }
+    gs_record_file = NULL;
+    
+    return res;
+}
+
+/**
+ * @brief      trace load a trace file for replay
+ * @param[in]  *path pointer to a trace file path
+ * @param[out] *info pointer to a trace info structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 load failed
+ * @note       the whole file is checked and kept in memory so replay never touches the file system
+ */
+uint8_t mcp9808_trace_replay_load(const char *path, mcp9808_trace_info_t *info)
+{
+    FILE *fp;
+    long size;
+    uint32_t pos;
+    uint32_t count;
+    
+    if ((path == NULL) || (info == NULL))
+    {
+        return 1;
+    }
+    mcp9808_trace_replay_unload();
+    
+    /* read the whole file */
+    fp = fopen(path, "rb");
+    if (fp == NULL)
+    {
+        return 1;
+    }
+    if ((fseek(fp, 0, SEEK_END) != 0) || ((size = ftell(fp)) < MCP9808_TRACE_HEADER_SIZE) ||
+        (fseek(fp, 0, SEEK_SET) != 0))
+    {
+        (void)fclose(fp);
+        
+        return 1;
+    }
+    gs_replay_buf = (uint8_t *)malloc((size_t)size);
+    if (gs_replay_buf == NULL)
+    {
+        (void)fclose(fp);
+        
+        return 1;
+    }
+    if (fread(gs_replay_buf, 1, (size_t)size, fp) != (size_t)size)
+    {
+        (void)fclose(fp);
+        mcp9808_trace_replay_unload();
+        
+        return 1;
+    }
+    (void)fclose(fp);
+    gs_replay_size = (uint32_t)size;
+    
+    /* check the header and walk every record */
+    if ((memcmp(gs_replay_buf, "M9TR", 4) != 0) || (gs_replay_buf[4] != MCP9808_TRACE_VERSION))
+    {
+        mcp9808_trace_replay_unload();
+        
+        return 1;
+    }
+    gs_replay_flags = gs_replay_buf[5];
+    gs_replay_info.record = a_trace_get32(&gs_replay_buf[8]);
+    gs_replay_info.tag = a_trace_get32(&gs_replay_buf[12]);
+    gs_replay_info.duration_us = 0;
+    count = 0;
+    pos = MCP9808_TRACE_HEADER_SIZE;
+    while (pos < gs_replay_size)
+    {
+        if ((gs_replay_size - pos < MCP9808_TRACE_RECORD_SIZE) ||
+            (gs_replay_buf[pos] > MCP9808_TRACE_TYPE_READ_CMD) ||
+            (gs_replay_size - pos - MCP9808_TRACE_RECORD_SIZE < a_trace_get16(&gs_replay_buf[pos + 8])))
+        {
+            mcp9808_trace_replay_unload();
+            
+            return 1;
+        }
+        gs_replay_info.duration_us = a_trace_get32(&gs_replay_buf[pos + 4]);
+        pos += MCP9808_TRACE_RECORD_SIZE + a_trace_get16(&gs_replay_buf[pos + 8]);
+        count++;
+    }
+    if (count != gs_replay_info.record)
+    {
+        mcp9808_trace_replay_unload();
+        
+        return 1;
+    }
+    mcp9808_trace_replay_rewind();
+    memcpy(info, &gs_replay_info, sizeof(mcp9808_trace_info_t));
+    
+    return 0;
+}
+
+/**
+ * @brief  trace unload the loaded trace
+ * @note   none
+ */
+void mcp9808_trace_replay_unload(void)
+{
+    free(gs_replay_buf);
+    gs_replay_buf = NULL;
+    gs_replay_size = 0;
+    gs_replay_pos = 0;
+    gs_replay_flags = 0;
+    memset(&gs_replay_info, 0, sizeof(gs_replay_info));
+    memset(&gs_replay_status, 0, sizeof(gs_replay_status));
+}
+
+/**
+ * @brief  trace rewind the replay to the first record
+ * @note   the status is cleared
+ */
+void mcp9808_trace_replay_rewind(void)
+{
+    gs_replay_pos = MCP9808_TRACE_HEADER_SIZE;
+    memset(&gs_replay_status, 0, sizeof(gs_replay_status));
+}
+
+/**
+ * @brief      trace get the replay status
+ * @param[out] *status pointer to a trace status structure
+ * @note       none
+ */
+void mcp9808_trace_replay_get_status(mcp9808_trace_status_t *status)
+{
+    memcpy(status, &gs_replay_status, sizeof(mcp9808_trace_status_t));
+}
+
+/**
+ * @brief     trace link the replay backend to a handle
+ * @param[in] *handle pointer to a mcp9808 handle structure
+ * @note      every iic link, delay_ms and get_time_us are replaced,
+ *            get_time_us returns the recorded time of the next record and delay_ms returns at once
+ */
+void mcp9808_trace_replay_link(mcp9808_handle_t *handle)
+{
+    DRIVER_MCP9808_LINK_IIC_INIT(handle, a_trace_replay_iic_init);
+    DRIVER_MCP9808_LINK_IIC_DEINIT(handle, a_trace_replay_iic_deinit);
+    DRIVER_MCP9808_LINK_IIC_WRITE(handle, a_trace_replay_iic_write);
+    DRIVER_MCP9808_LINK_IIC_READ(handle, a_trace_replay_iic_read);
+    DRIVER_MCP9808_LINK_IIC_READ_CMD(handle, a_trace_replay_iic_read_cmd);
+    DRIVER_MCP9808_LINK_IIC_READ_BATCH(handle, ((gs_replay_flags & TRACE_FLAG_BATCH) != 0) ? a_trace_replay_iic_read_batch : NULL);
+    DRIVER_MCP9808_LINK_IIC_WRITE_CTX(handle, NULL);
+    DRIVER_MCP9808_LINK_IIC_READ_CTX(handle, NULL);
+    DRIVER_MCP9808_LINK_IIC_READ_CMD_CTX(handle, NULL);
+    DRIVER_MCP9808_LINK_IIC_READ_BATCH_CTX(handle, NULL);
+    DRIVER_MCP9808_LINK_DELAY_MS(handle, a_trace_replay_delay_ms);
+    DRIVER_MCP9808_LINK_GET_TIME_US(handle, a_trace_replay_get_time_us);
+}
@@ -0,0 +1,162 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mcp9808_trace.h
+ * @brief     driver mcp9808 trace header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-01-25
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/01/25  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_MCP9808_TRACE_H
+#define DRIVER_MCP9808_TRACE_H
+
+#include "driver_mcp9808.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup mcp9808_trace mcp9808 trace function
+ * @brief    mcp9808 iic transaction record and replay modules
+ * @{
+ */
+
+/**
+ * @brief mcp9808 trace file definition
+ * @note  all fields are little endian, the file starts with a 16 byte header (magic "M9TR", version, flags, 2 reserved bytes,
+ *        record number, tag) and every record is a 10 byte head (type, address, register, result, time_us, len)
+ *        followed by len payload bytes
+ */
+#define MCP9808_TRACE_VERSION            0x01        /**< trace format version */
+#define MCP9808_TRACE_HEADER_SIZE        16          /**< file header size */
+#define MCP9808_TRACE_RECORD_SIZE        10          /**< record head size */
+
+/**
+ * @brief mcp9808 trace record type enumeration definition
+ */
+typedef enum
+{
+    MCP9808_TRACE_TYPE_WRITE    = 0x00,        /**< iic_write, the payload is the written data */
+    MCP9808_TRACE_TYPE_READ     = 0x01,        /**< iic_read, the payload is the read data */
+    MCP9808_TRACE_TYPE_READ_CMD = 0x02,        /**< iic_read_cmd, the register is 0xFF */
+} mcp9808_trace_type_t;
+
+/**
+ * @brief mcp9808 trace info structure definition
+ */
+typedef struct mcp9808_trace_info_s
+{
+    uint32_t record;             /**< record number */
+    uint32_t tag;                /**< user tag saved by the recorder */
+    uint32_t duration_us;        /**< time of the last record */
+} mcp9808_trace_info_t;
+
+/**
+ * @brief mcp9808 trace replay status structure definition
+ */
+typedef struct mcp9808_trace_status_s
+{
+    uint32_t played;             /**< records played since the last rewind */
+    uint32_t mismatch;           /**< 0 or the 1 based index of the first record the driver did not repeat */
+} mcp9808_trace_status_t;
+
+/**
+ * @brief     trace start recording a handle
+ * @param[in] *handle pointer to a mcp9808 handle structure
+ * @param[in] *path pointer to a trace file path
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ * @note      the iic_write, iic_read, iic_read_cmd and iic_read_batch links of the handle are wrapped,
+ *            every wrapped call still reaches the real bus and is appended to the trace,
+ *            a batch read is recorded as one read per device,
+ *            only one handle can be recorded at a time and the ctx links are not supported
+ */
+uint8_t mcp9808_trace_record_start(mcp9808_handle_t *handle, const char *path);
+
+/**
+ * @brief     trace stop recording
+ * @param[in] *handle pointer to a mcp9808 handle structure
+ * @param[in] tag user tag saved in the header
+ * @return    status code
+ *            - 0 success
+ *            - 1 stop failed
+ * @note      the original links of the handle are restored
+ */
+uint8_t mcp9808_trace_record_stop(mcp9808_handle_t *handle, uint32_t tag);
+
+/**
+ * @brief      trace load a trace file for replay
+ * @param[in]  *path pointer to a trace file path
+ * @param[out] *info pointer to a trace info structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 load failed
+ * @note       the whole file is checked and kept in memory so replay never touches the file system
+ */
+uint8_t mcp9808_trace_replay_load(const char *path, mcp9808_trace_info_t *info);
+
+/**
+ * @brief  trace unload the loaded trace
+ * @note   none
+ */
+void mcp9808_trace_replay_unload(void);
+
+/**
+ * @brief  trace rewind the replay to the first record
+ * @note   the status is cleared
+ */
+void mcp9808_trace_replay_rewind(void);
+
+/**
+ * @brief      trace get the replay status
+ * @param[out] *status pointer to a trace status structure
+ * @note       none
+ */
+void mcp9808_trace_replay_get_status(mcp9808_trace_status_t *status);
+
+/**
+ * @brief     trace link the replay backend to a handle
+ * @param[in] *handle pointer to a mcp9808 handle structure
+ * @note      every iic link, delay_ms and get_time_us are replaced,
+ *            get_time_us returns the recorded time of the next record and delay_ms returns at once
+ */
+void mcp9808_trace_replay_link(mcp9808_handle_t *handle);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
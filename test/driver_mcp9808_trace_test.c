@@ -0,0 +1,246 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mcp9808_trace_test.c
+ * @brief     driver mcp9808 trace test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-01-25
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/01/25  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_mcp9808_trace_test.h"
+#include "driver_mcp9808_trace.h"
+#include <time.h>
+
+static mcp9808_handle_t gs_handle;        /**< mcp9808 handle */
+
+/**
+ * @brief     trace test session
+ * @param[in] addr iic device address
+ * @param[in] times read times
+ * @param[in] print print the temperature
+ * @return    status code
+ *            - 0 success
+ *            - 1 session failed
+ * @note      the record and the replay run this same sequence
+ */
+static uint8_t a_trace_test_session(mcp9808_address_t addr, uint32_t times, uint8_t print)
+{
+    uint8_t res;
+    uint32_t i;
+    int16_t raw;
+    int32_t temperature_mc;
+    
+    /* set address pin */
+    res = mcp9808_set_addr(&gs_handle, addr);
+    if (res != 0)
+    {
+        mcp9808_interface_debug_print("mcp9808: set addr failed.\n");
+        
+        return 1;
+    }
+    
+    /* mcp9808 init */
+    res = mcp9808_init(&gs_handle);
+    if (res != 0)
+    {
+        mcp9808_interface_debug_print("mcp9808: init failed.\n");
+        
+        return 1;
+    }
+    
+    /* disable shutdown */
+    res = mcp9808_set_shutdown(&gs_handle, MCP9808_BOOL_FALSE);
+    if (res != 0)
+    {
+        mcp9808_interface_debug_print("mcp9808: set shutdown failed.\n");
+        (void)mcp9808_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    for (i = 0; i < times; i++)
+    {
+        /* delay 1000ms */
+        gs_handle.delay_ms(1000);
+        
+        /* read data */
+        res = mcp9808_read_milli_c(&gs_handle, &raw, &temperature_mc);
+        if (res != 0)
+        {
+            mcp9808_interface_debug_print("mcp9808: read failed.\n");
+            (void)mcp9808_deinit(&gs_handle);
+            
+            return 1;
+        }
+        if (print != 0)
+        {
+            mcp9808_interface_debug_print("mcp9808: temperature is %dmC.\n", temperature_mc);
+        }
+    }
+    
+    /* mcp9808 deinit */
+    res = mcp9808_deinit(&gs_handle);
+    if (res != 0)
+    {
+        mcp9808_interface_debug_print("mcp9808: deinit failed.\n");
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     trace record test
+ * @param[in] addr iic device address
+ * @param[in] *path pointer to a trace file path
+ * @param[in] times read times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      init, times reads one second apart and deinit run on the real bus and are saved to the trace
+ */
+uint8_t mcp9808_trace_record_test(mcp9808_address_t addr, const char *path, uint32_t times)
+{
+    uint8_t res;
+    
+    /* link interface function */
+    DRIVER_MCP9808_LINK_INIT(&gs_handle, mcp9808_handle_t);
+    DRIVER_MCP9808_LINK_IIC_INIT(&gs_handle, mcp9808_interface_iic_init);
+    DRIVER_MCP9808_LINK_IIC_DEINIT(&gs_handle, mcp9808_interface_iic_deinit);
+    DRIVER_MCP9808_LINK_IIC_READ(&gs_handle, mcp9808_interface_iic_read);
+    DRIVER_MCP9808_LINK_IIC_READ_CMD(&gs_handle, mcp9808_interface_iic_read_cmd);
+    DRIVER_MCP9808_LINK_IIC_WRITE(&gs_handle, mcp9808_interface_iic_write);
+    DRIVER_MCP9808_LINK_DELAY_MS(&gs_handle, mcp9808_interface_delay_ms);
+    DRIVER_MCP9808_LINK_GET_TIME_US(&gs_handle, mcp9808_interface_get_time_us);
+    DRIVER_MCP9808_LINK_DEBUG_PRINT(&gs_handle, mcp9808_interface_debug_print);
+    DRIVER_MCP9808_LINK_RECEIVE_CALLBACK(&gs_handle, mcp9808_interface_receive_callback);
+    
+    /* start trace record test */
+    mcp9808_interface_debug_print("mcp9808: start trace record test.\n");
+    
+    /* start recording */
+    res = mcp9808_trace_record_start(&gs_handle, path);
+    if (res != 0)
+    {
+        mcp9808_interface_debug_print("mcp9808: record start failed.\n");
+        
+        return 1;
+    }
+    
+    /* run the session, the read times is kept as the tag */
+    res = a_trace_test_session(addr, times, 1);
+    if (mcp9808_trace_record_stop(&gs_handle, times) != 0)
+    {
+        mcp9808_interface_debug_print("mcp9808: record stop failed.\n");
+        
+        return 1;
+    }
+    if (res != 0)
+    {
+        return 1;
+    }
+    mcp9808_interface_debug_print("mcp9808: trace is saved to %s.\n", path);
+    
+    /* finish trace record test */
+    mcp9808_interface_debug_print("mcp9808: finish trace record test.\n");
+    
+    return 0;
+}
+
+/**
+ * @brief     trace replay test
+ * @param[in] addr iic device address
+ * @param[in] *path pointer to a trace file path
+ * @param[in] times replay times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the recorded session runs times against the trace without hardware,
+ *            every run must repeat every record exactly
+ */
+uint8_t mcp9808_trace_replay_test(mcp9808_address_t addr, const char *path, uint32_t times)
+{
+    uint8_t res;
+    uint32_t i;
+    clock_t start;
+    double seconds;
+    mcp9808_trace_info_t info;
+    mcp9808_trace_status_t status;
+    
+    /* start trace replay test */
+    mcp9808_interface_debug_print("mcp9808: start trace replay test.\n");
+    
+    /* load the trace */
+    res = mcp9808_trace_replay_load(path, &info);
+    if (res != 0)
+    {
+        mcp9808_interface_debug_print("mcp9808: load %s failed.\n", path);
+        
+        return 1;
+    }
+    mcp9808_interface_debug_print("mcp9808: trace has %d records, %d reads and %dus.\n",
+                                  info.record, info.tag, info.duration_us);
+    
+    /* link the replay backend */
+    DRIVER_MCP9808_LINK_INIT(&gs_handle, mcp9808_handle_t);
+    DRIVER_MCP9808_LINK_DEBUG_PRINT(&gs_handle, mcp9808_interface_debug_print);
+    DRIVER_MCP9808_LINK_RECEIVE_CALLBACK(&gs_handle, mcp9808_interface_receive_callback);
+    mcp9808_trace_replay_link(&gs_handle);
+    
+    start = clock();
+    for (i = 0; i < times; i++)
+    {
+        /* replay once */
+        mcp9808_trace_replay_rewind();
+        res = a_trace_test_session(addr, info.tag, 0);
+        mcp9808_trace_replay_get_status(&status);
+        if ((res != 0) || (status.mismatch != 0) || (status.played != info.record))
+        {
+            mcp9808_interface_debug_print("mcp9808: run %d played %d/%d records, mismatch at %d.\n",
+                                          i + 1, status.played, info.record, status.mismatch);
+            mcp9808_trace_replay_unload();
+            
+            return 1;
+        }
+    }
+    seconds = (double)(clock() - start) / (double)CLOCKS_PER_SEC;
+    mcp9808_trace_replay_unload();
+    mcp9808_interface_debug_print("mcp9808: replay %d times in %0.3fs.\n", times, seconds);
+    if (seconds > 0.0)
+    {
+        mcp9808_interface_debug_print("mcp9808: %0.0f runs per second.\n", (double)times / seconds);
+    }
+    
+    /* finish trace replay test */
+    mcp9808_interface_debug_print("mcp9808: finish trace replay test.\n");
+    
+    return 0;
+}
@@ -0,0 +1,84 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mcp9808_trace_test.h
+ * @brief     driver mcp9808 trace test header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-01-25
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/01/25  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_MCP9808_TRACE_TEST_H
+#define DRIVER_MCP9808_TRACE_TEST_H
+
+#include "driver_mcp9808_interface.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @addtogroup mcp9808_test_driver
+ * @{
+ */
+
+/**
+ * @brief     trace record test
+ * @param[in] addr iic device address
+ * @param[in] *path pointer to a trace file path
+ * @param[in] times read times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      init, times reads one second apart and deinit run on the real bus and are saved to the trace
+ */
+uint8_t mcp9808_trace_record_test(mcp9808_address_t addr, const char *path, uint32_t times);
+
+/**
+ * @brief     trace replay test
+ * @param[in] addr iic device address
+ * @param[in] *path pointer to a trace file path
+ * @param[in] times replay times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the recorded session runs times against the trace without hardware,
+ *            every run must repeat every record exactly
+ */
+uint8_t mcp9808_trace_replay_test(mcp9808_address_t addr, const char *path, uint32_t times);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif